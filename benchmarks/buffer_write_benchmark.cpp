@@ -0,0 +1,79 @@
+#include <azgra/io/stream/out_binary_buffer_stream.h>
+#include <azgra/collection/vector_utilities.h>
+#include <azgra/utilities/stopwatch.h>
+#include <cstring>
+
+// Keep the result alive, so that the measured writes aren't removed.
+static volatile size_t sink;
+
+template<typename Function>
+static void print_throughput(const char *name, const size_t byteCount, Function fn)
+{
+    azgra::Stopwatch stopwatch;
+    stopwatch.start();
+    sink = fn();
+    stopwatch.stop();
+    const double seconds = stopwatch.elapsed_milliseconds() / 1000.0;
+    fprintf(stdout, "%-36s %10.1f ms %10.1f MB/s\n", name, seconds * 1000.0,
+            (static_cast<double>(byteCount) / (1024.0 * 1024.0)) / seconds);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t megabytes = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 256;
+    const size_t valueCount = megabytes * 1024 * 1024 / sizeof(azgra::i32);
+    const size_t byteCount = valueCount * sizeof(azgra::i32);
+    std::vector<azgra::i32> values(valueCount);
+    for (size_t i = 0; i < valueCount; ++i)
+    {
+        values[i] = static_cast<azgra::i32>(i * 2654435761u);
+    }
+
+    fprintf(stdout, "message size %lu MB\n", megabytes);
+    print_throughput("memcpy", byteCount, [&]()
+    {
+        azgra::ByteArray buffer(byteCount);
+        std::memcpy(buffer.data(), values.data(), byteCount);
+        return buffer.size();
+    });
+    // Implementation used before the direct writes, buffer had to be presized.
+    print_throughput("int32_to_bytes + vector_insert_at (old)", byteCount, [&]()
+    {
+        azgra::ByteArray buffer(byteCount);
+        size_t position = 0;
+        for (const azgra::i32 value : values)
+        {
+            const azgra::ByteArray bytes = azgra::int32_to_bytes(value);
+            azgra::collection::vector_insert_at(buffer, bytes, position, 0, bytes.size());
+            position += bytes.size();
+        }
+        return buffer.size();
+    });
+    print_throughput("write_int32, growing", byteCount, [&]()
+    {
+        azgra::io::stream::OutBinaryBufferStream stream;
+        for (const azgra::i32 value : values)
+        {
+            stream.write_int32(value);
+        }
+        return stream.release_buffer().size();
+    });
+    print_throughput("write<i32>, reserved", byteCount, [&]()
+    {
+        azgra::io::stream::OutBinaryBufferStream stream;
+        stream.reserve(byteCount);
+        for (const azgra::i32 value : values)
+        {
+            stream.write<azgra::i32>(value);
+        }
+        return stream.release_buffer().size();
+    });
+    print_throughput("write_array, reserved", byteCount, [&]()
+    {
+        azgra::io::stream::OutBinaryBufferStream stream;
+        stream.reserve(byteCount);
+        stream.write_array(values);
+        return stream.release_buffer().size();
+    });
+    return 0;
+}
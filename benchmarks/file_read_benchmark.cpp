@@ -0,0 +1,63 @@
+#include <azgra/io/stream/in_binary_file_stream.h>
+#include <azgra/io/stream/in_mapped_file_stream.h>
+#include <azgra/utilities/stopwatch.h>
+#include <filesystem>
+
+// Keep the result alive, so that the measured read isn't removed.
+static volatile size_t sink;
+
+// Whole file read through the stream iterator, the implementation used before the bulk reads.
+static azgra::ByteArray legacy_consume_whole_file(const std::string &fileName)
+{
+    std::ifstream fileStream(fileName, std::ios::binary | std::ios::in);
+    fileStream.unsetf(std::ios::skipws);
+    azgra::ByteArray result;
+    result.insert(result.begin(), std::istream_iterator<azgra::byte>(fileStream), std::istream_iterator<azgra::byte>());
+    return result;
+}
+
+template<typename Function>
+static void print_throughput(const char *name, const size_t byteCount, Function fn)
+{
+    azgra::Stopwatch stopwatch;
+    stopwatch.start();
+    sink = fn();
+    stopwatch.stop();
+    const double seconds = stopwatch.elapsed_milliseconds() / 1000.0;
+    fprintf(stdout, "%-28s %10.1f ms %10.1f MB/s\n", name, seconds * 1000.0,
+            (static_cast<double>(byteCount) / (1024.0 * 1024.0)) / seconds);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t megabytes = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 256;
+    const size_t byteCount = megabytes * 1024 * 1024;
+    const std::string fileName = (std::filesystem::temp_directory_path() / "azgra_file_read_benchmark.bin").string();
+    {
+        azgra::ByteArray bytes(byteCount);
+        for (size_t i = 0; i < byteCount; ++i)
+        {
+            bytes[i] = static_cast<azgra::byte>(i * 2654435761u >> 24);
+        }
+        std::ofstream out(fileName, std::ios::binary);
+        out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    // File was just written, all reads are served from the page cache.
+    fprintf(stdout, "file size %lu MB\n", megabytes);
+    print_throughput("istream_iterator (old)", byteCount, [&]()
+    { return legacy_consume_whole_file(fileName).size(); });
+    print_throughput("consume_whole_file", byteCount, [&]()
+    { return azgra::io::stream::InBinaryFileStream(fileName).consume_whole_file().size(); });
+    print_throughput("consume_rest_of_file", byteCount, [&]()
+    {
+        azgra::io::stream::InBinaryFileStream stream(fileName);
+        stream.move_to(static_cast<azgra::i64>(byteCount / 2));
+        return stream.consume_rest_of_file().size() * 2;
+    });
+    print_throughput("mapped consume_bytes", byteCount, [&]()
+    { return azgra::io::stream::InMappedFileStream(fileName).consume_bytes(byteCount).size(); });
+
+    std::filesystem::remove(fileName);
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include <azgra/linalg/decomposition.h>
+#include <azgra/utilities/stopwatch.h>
+#include <cstdlib>
+#include <random>
+
+// Gaussian elimination with partial pivoting over at(row, col), as it is usually written by hand.
+template<typename T>
+static std::vector<T> naive_gaussian_elimination(azgra::Matrix<T> a, std::vector<T> b)
+{
+    const size_t n = a.rows();
+    for (size_t col = 0; col < n; ++col)
+    {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < n; ++row)
+        {
+            if (std::abs(a.at(row, col)) > std::abs(a.at(pivot, col)))
+            {
+                pivot = row;
+            }
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            std::swap(a.at(col, i), a.at(pivot, i));
+        }
+        std::swap(b[col], b[pivot]);
+
+        for (size_t row = col + 1; row < n; ++row)
+        {
+            const T factor = a.at(row, col) / a.at(col, col);
+            for (size_t i = col; i < n; ++i)
+            {
+                a.at(row, i) -= factor * a.at(col, i);
+            }
+            b[row] -= factor * b[col];
+        }
+    }
+
+    std::vector<T> x(n);
+    for (size_t row = n; row-- > 0;)
+    {
+        T sum = b[row];
+        for (size_t i = row + 1; i < n; ++i)
+        {
+            sum -= a.at(row, i) * x[i];
+        }
+        x[row] = sum / a.at(row, row);
+    }
+    return x;
+}
+
+template<typename T>
+static azgra::Matrix<T> random_matrix(const size_t size, std::mt19937 &generator)
+{
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::vector<T> data(size * size);
+    for (T &value : data)
+    {
+        value = static_cast<T>(distribution(generator));
+    }
+    return azgra::Matrix<T>(size, size, data);
+}
+
+template<typename T>
+static double max_residual(const azgra::Matrix<T> &a, const std::vector<T> &x, const std::vector<T> &b)
+{
+    double result = 0.0;
+    for (size_t row = 0; row < a.rows(); ++row)
+    {
+        double sum = 0.0;
+        for (size_t col = 0; col < a.cols(); ++col)
+        {
+            sum += static_cast<double>(a.at(row, col)) * static_cast<double>(x[col]);
+        }
+        result = std::max(result, std::abs(sum - static_cast<double>(b[row])));
+    }
+    return result;
+}
+
+template<typename T>
+static void benchmark_type(const char *typeName, const size_t maxNaiveSize)
+{
+    std::mt19937 generator(42);
+    const size_t sizes[] = {128, 256, 512, 1024, 2048};
+
+    fprintf(stdout, "%s\n", typeName);
+    fprintf(stdout, "%8s %12s %12s %12s %12s %12s %10s %12s\n", "size", "naive [ms]", "LU [ms]",
+            "Cholesky [ms]", "QR [ms]", "LU GFLOP/s", "speedup", "LU residual");
+
+    for (const size_t size : sizes)
+    {
+        const auto a = random_matrix<T>(size, generator);
+        azgra::Matrix<T> spd = a.transpose() * a;
+        for (size_t i = 0; i < size; ++i)
+        {
+            spd.at(i, i) += static_cast<T>(size);
+        }
+        std::vector<T> b(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            b[i] = static_cast<T>(i % 7) - static_cast<T>(3);
+        }
+        const double luFlops = (2.0 / 3.0) * static_cast<double>(size) * static_cast<double>(size) *
+                               static_cast<double>(size);
+
+        azgra::Stopwatch stopwatch;
+        stopwatch.start();
+        const std::vector<T> luX = azgra::linalg::solve(a, b);
+        stopwatch.stop();
+        const double luMs = stopwatch.elapsed_milliseconds();
+
+        stopwatch.reset();
+        const azgra::linalg::CholeskyDecomposition<T> cholesky(spd);
+        stopwatch.stop();
+        const double choleskyMs = stopwatch.elapsed_milliseconds();
+
+        stopwatch.reset();
+        const azgra::linalg::QrDecomposition<T> qr(a);
+        stopwatch.stop();
+        const double qrMs = stopwatch.elapsed_milliseconds();
+
+        if (size > maxNaiveSize)
+        {
+            fprintf(stdout, "%8lu %12s %12.2f %12.2f %12.2f %12.2f %10s %12.2e\n", size, "-", luMs, choleskyMs, qrMs,
+                    luFlops / (luMs * 1e6), "-", max_residual(a, luX, b));
+            continue;
+        }
+
+        stopwatch.reset();
+        const std::vector<T> naiveX = naive_gaussian_elimination(azgra::Matrix<T>(a), b);
+        stopwatch.stop();
+        const double naiveMs = stopwatch.elapsed_milliseconds();
+
+        fprintf(stdout, "%8lu %12.2f %12.2f %12.2f %12.2f %12.2f %9.1fx %12.2e\n", size, naiveMs, luMs, choleskyMs, qrMs,
+                luFlops / (luMs * 1e6), naiveMs / luMs, max_residual(a, luX, b));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // Naive elimination of 2048x2048 system takes long, so by default it is only run up to this size.
+    const size_t maxNaiveSize = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 1024;
+
+    benchmark_type<azgra::f32>("f32", maxNaiveSize);
+    benchmark_type<azgra::f64>("f64", maxNaiveSize);
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <azgra/matrix.h>
+#include <azgra/utilities/stopwatch.h>
+#include <cstdlib>
+#include <random>
+
+// Triple loop over at(row, col), as it is usually written by hand.
+template<typename T>
+static azgra::Matrix<T> naive_multiply(const azgra::Matrix<T> &a, const azgra::Matrix<T> &b)
+{
+    azgra::Matrix<T> result(a.rows(), b.cols());
+    for (size_t row = 0; row < a.rows(); ++row)
+    {
+        for (size_t col = 0; col < b.cols(); ++col)
+        {
+            T sum{};
+            for (size_t i = 0; i < a.cols(); ++i)
+            {
+                sum += a.at(row, i) * b.at(i, col);
+            }
+            result.at(row, col) = sum;
+        }
+    }
+    return result;
+}
+
+template<typename T>
+static azgra::Matrix<T> random_matrix(const size_t size, std::mt19937 &generator)
+{
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::vector<T> data(size * size);
+    for (T &value : data)
+    {
+        value = static_cast<T>(distribution(generator));
+    }
+    return azgra::Matrix<T>(size, size, data);
+}
+
+template<typename T>
+static void benchmark_type(const char *typeName, const size_t maxNaiveSize)
+{
+    std::mt19937 generator(42);
+    const size_t sizes[] = {64, 128, 256, 512, 1024, 2048};
+
+    fprintf(stdout, "%s (kernel: %s)\n", typeName, azgra::linalg::select_gemm_kernel<T>().name);
+    fprintf(stdout, "%8s %14s %14s %14s %14s %10s\n", "size", "naive [ms]", "naive GFLOP/s",
+            "blocked [ms]", "blocked GFLOP/s", "speedup");
+
+    for (const size_t size : sizes)
+    {
+        const auto a = random_matrix<T>(size, generator);
+        const auto b = random_matrix<T>(size, generator);
+        const double flops = 2.0 * static_cast<double>(size) * static_cast<double>(size) * static_cast<double>(size);
+
+        azgra::Stopwatch stopwatch;
+        stopwatch.start();
+        const auto blocked = a * b;
+        stopwatch.stop();
+        const double blockedMs = stopwatch.elapsed_milliseconds();
+
+        if (size > maxNaiveSize)
+        {
+            fprintf(stdout, "%8lu %14s %14s %14.2f %14.2f %10s\n", size, "-", "-", blockedMs,
+                    flops / (blockedMs * 1e6), "-");
+            continue;
+        }
+
+        stopwatch.reset();
+        const auto naive = naive_multiply(a, b);
+        stopwatch.stop();
+        const double naiveMs = stopwatch.elapsed_milliseconds();
+
+        fprintf(stdout, "%8lu %14.2f %14.2f %14.2f %14.2f %9.1fx\n", size, naiveMs, flops / (naiveMs * 1e6),
+                blockedMs, flops / (blockedMs * 1e6), naiveMs / blockedMs);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // Naive multiplication of 2048x2048 takes minutes, so by default it is only run up to this size.
+    const size_t maxNaiveSize = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 1024;
+
+    benchmark_type<azgra::f32>("f32", maxNaiveSize);
+    benchmark_type<azgra::f64>("f64", maxNaiveSize);
+    benchmark_type<azgra::i32>("i32", maxNaiveSize);
+    return 0;
+}
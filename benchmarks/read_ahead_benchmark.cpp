@@ -0,0 +1,72 @@
+#include <azgra/io/stream/in_binary_buffer_stream.h>
+#include <azgra/io/stream/in_binary_file_stream.h>
+#include <azgra/utilities/stopwatch.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <filesystem>
+#include <fstream>
+
+// Keep the result alive, so that the measured decode isn't removed.
+static volatile azgra::u64 sink;
+
+// Drop the file from the page cache, so that the reads go to the disk.
+static void drop_cached_pages(const std::string &fileName)
+{
+    const int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+}
+
+// Decode the whole file as u32 values through the buffer stream, with some work per value.
+static void print_throughput(const std::string &fileName, const size_t byteCount, const azgra::u64 bufferSize,
+                             const azgra::u32 depth)
+{
+    drop_cached_pages(fileName);
+    azgra::Stopwatch stopwatch;
+    stopwatch.start();
+    azgra::io::stream::InBinaryFileStream file(fileName);
+    azgra::io::stream::InBinaryBufferStream stream(&file, static_cast<azgra::i64>(bufferSize), depth);
+    azgra::u64 hash = 0;
+    for (size_t i = 0; i < byteCount / sizeof(azgra::u32); ++i)
+    {
+        hash = (hash ^ stream.read<azgra::u32>()) * 0x100000001b3ull;
+    }
+    sink = hash;
+    stopwatch.stop();
+    const double seconds = stopwatch.elapsed_milliseconds() / 1000.0;
+    fprintf(stdout, "buffer %6lu KB depth %u %10.1f ms %10.1f MB/s\n", bufferSize / 1024, depth, seconds * 1000.0,
+            (static_cast<double>(byteCount) / (1024.0 * 1024.0)) / seconds);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t megabytes = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 512;
+    const size_t byteCount = megabytes * 1024 * 1024;
+    const std::string fileName = (std::filesystem::temp_directory_path() / "azgra_read_ahead_benchmark.bin").string();
+    {
+        azgra::ByteArray bytes(byteCount);
+        for (size_t i = 0; i < byteCount; ++i)
+        {
+            bytes[i] = static_cast<azgra::byte>(i * 2654435761u >> 24);
+        }
+        std::ofstream out(fileName, std::ios::binary);
+        out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+    // Written pages have to reach the disk before they can be dropped from the cache.
+    sync();
+
+    fprintf(stdout, "file size %lu MB\n", megabytes);
+    for (const azgra::u64 bufferSize : {500000ul, 4ul * 1024 * 1024})
+    {
+        for (const azgra::u32 depth : {1u, 2u, 3u})
+        {
+            print_throughput(fileName, byteCount, bufferSize, depth);
+        }
+    }
+
+    std::filesystem::remove(fileName);
+    return 0;
+}
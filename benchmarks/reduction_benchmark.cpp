@@ -0,0 +1,91 @@
+#include <azgra/collection/enumerable_functions.h>
+#include <azgra/utilities/stopwatch.h>
+#include <random>
+
+// Keep the result alive, so that the measured loop isn't removed.
+static volatile double sink;
+
+template<typename Function>
+static double measure_ms(const size_t repetitions, Function fn)
+{
+    azgra::Stopwatch stopwatch;
+    stopwatch.start();
+    for (size_t i = 0; i < repetitions; ++i)
+    {
+        sink = static_cast<double>(fn());
+    }
+    stopwatch.stop();
+    return stopwatch.elapsed_milliseconds() / static_cast<double>(repetitions);
+}
+
+static void print_row(const char *name, const double genericMs, const double simdMs)
+{
+    fprintf(stdout, "%-12s %12.3f %12.3f %9.1fx\n", name, genericMs, simdMs, genericMs / simdMs);
+}
+
+template<typename T>
+static void benchmark_type(const char *typeName, const size_t count, const size_t repetitions)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(-1000000, 1000000);
+    std::vector<T> values(count);
+    for (T &value : values)
+    {
+        value = static_cast<T>(distribution(generator));
+    }
+    // Searched value isn't present, so that the whole range is scanned.
+    const T missing = static_cast<T>(2000000);
+
+    fprintf(stdout, "%s, %lu values\n", typeName, count);
+    fprintf(stdout, "%-12s %12s %12s %10s\n", "operation", "generic [ms]", "simd [ms]", "speedup");
+
+    // Generic columns are the iterator loops, which were used before the vector kernels.
+    // Simd columns call the kernels directly, min_max and sum from enumerable_functions.h use them only for integers.
+    print_row("sum",
+              measure_ms(repetitions, [&]()
+              { return std::accumulate(values.begin(), values.end(), T{}); }),
+              measure_ms(repetitions, [&]()
+              { return azgra::collection::simd_sum(values.data(), values.size()); }));
+    print_row("min_max",
+              measure_ms(repetitions, [&]()
+              { return *std::minmax_element(values.begin(), values.end()).second; }),
+              measure_ms(repetitions, [&]()
+              { return azgra::collection::simd_min_max(values.data(), values.size()).second; }));
+    print_row("count",
+              measure_ms(repetitions, [&]()
+              { return std::count(values.begin(), values.end(), missing); }),
+              measure_ms(repetitions, [&]()
+              { return azgra::collection::count(values.begin(), values.end(), missing); }));
+    print_row("contains",
+              measure_ms(repetitions, [&]()
+              { return std::find(values.begin(), values.end(), missing) != values.end(); }),
+              measure_ms(repetitions, [&]()
+              { return azgra::collection::contains(values.begin(), values.end(), missing); }));
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        print_row("sum pairwise",
+                  measure_ms(repetitions, [&]()
+                  { return std::accumulate(values.begin(), values.end(), T{}); }),
+                  measure_ms(repetitions, [&]()
+                  { return azgra::collection::sum(values.begin(), values.end(), azgra::collection::SummationMode_Pairwise); }));
+        print_row("sum kahan",
+                  measure_ms(repetitions, [&]()
+                  { return std::accumulate(values.begin(), values.end(), T{}); }),
+                  measure_ms(repetitions, [&]()
+                  { return azgra::collection::sum(values.begin(), values.end(), azgra::collection::SummationMode_Kahan); }));
+    }
+    fprintf(stdout, "\n");
+}
+
+int main(int argc, char **argv)
+{
+    const size_t count = (argc > 1) ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : (1 << 22);
+    const size_t repetitions = 20;
+
+    fprintf(stdout, "kernels: %s\n\n", azgra::collection::simd_reduction_kernel_name());
+    benchmark_type<azgra::f32>("f32", count, repetitions);
+    benchmark_type<azgra::f64>("f64", count, repetitions);
+    benchmark_type<azgra::i32>("i32", count, repetitions);
+    benchmark_type<azgra::i64>("i64", count, repetitions);
+    return 0;
+}
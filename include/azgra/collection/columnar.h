@@ -0,0 +1,444 @@
+#pragma once
+
+#include "enumerable.h"
+#include "vector_utilities.h"
+#include <azgra/utilities/parallel.h>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace azgra::collection
+{
+    /**
+     * Number of rows described by one word of the selection bitmap.
+     */
+    constexpr size_t ColumnarBitmapWordSize = 64;
+
+    template<typename... Columns>
+    class ColumnarQuery;
+
+    /**
+     * Table of records stored by columns (structure of arrays). Every field has its own contiguous vector,
+     * so the queries read only the columns referenced by their predicates and selectors.
+     * Columns are referenced by their index in the Columns pack.
+     * @tparam Columns Types of the columns.
+     */
+    template<typename... Columns>
+    class ColumnarTable
+    {
+    private:
+        std::tuple<std::vector<Columns>...> m_columns;
+
+        template<size_t... Is>
+        void push_back_impl(std::index_sequence<Is...>, const Columns &... values)
+        {
+            (std::get<Is>(m_columns).push_back(values), ...);
+        }
+
+        template<size_t... Is>
+        void reserve_impl(std::index_sequence<Is...>, const size_t capacity)
+        {
+            (std::get<Is>(m_columns).reserve(capacity), ...);
+        }
+
+    public:
+        template<size_t I>
+        using ColumnType = std::tuple_element_t<I, std::tuple<Columns...>>;
+
+        static constexpr size_t ColumnCount = sizeof...(Columns);
+
+        ColumnarTable() = default;
+
+        /**
+         * Create table from the column vectors, all of them must have the same size.
+         */
+        explicit ColumnarTable(std::vector<Columns>... columns) : m_columns(std::move(columns)...)
+        {
+            std::apply([this](const auto &... cols)
+                       { always_assert(((cols.size() == size()) && ...)); }, m_columns);
+        }
+
+        /**
+         * Split the records into the columns.
+         * @param records Records in the array of structures layout.
+         * @param members Pointers to the stored record members, in the column order.
+         * @return Table with one column for every member.
+         */
+        template<typename Record>
+        static ColumnarTable from_records(const std::vector<Record> &records, Columns Record::*... members)
+        {
+            ColumnarTable table;
+            table.reserve(records.size());
+            for (const Record &record : records)
+            {
+                table.push_back((record.*members)...);
+            }
+            return table;
+        }
+
+        /**
+         * Append one row.
+         */
+        void push_back(const Columns &... values)
+        {
+            push_back_impl(std::index_sequence_for<Columns...>(), values...);
+        }
+
+        void reserve(const size_t capacity)
+        {
+            reserve_impl(std::index_sequence_for<Columns...>(), capacity);
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return std::get<0>(m_columns).size();
+        }
+
+        template<size_t I>
+        const std::vector<ColumnType<I>> &column() const
+        {
+            return std::get<I>(m_columns);
+        }
+
+        /**
+         * Get mutable column. Size of the column mustn't be changed.
+         */
+        template<size_t I>
+        std::vector<ColumnType<I>> &column()
+        {
+            return std::get<I>(m_columns);
+        }
+
+        /**
+         * Get the row as the tuple of the values.
+         */
+        [[nodiscard]] std::tuple<Columns...> row(const size_t index) const
+        {
+            return std::apply([index](const auto &... columns)
+                              { return std::tuple<Columns...>(columns[index]...); }, m_columns);
+        }
+
+        /**
+         * Start the query over all rows. Table must outlive the query.
+         */
+        ColumnarQuery<Columns...> query() const
+        {
+            return ColumnarQuery<Columns...>(*this);
+        }
+
+        template<size_t... Is, typename Predicate>
+        ColumnarQuery<Columns...> where(const Predicate &predicate, const ExecutionPolicy policy = ExecutionPolicy_Sequential) const
+        {
+            return query().template where<Is...>(predicate, policy);
+        }
+    };
+
+    /**
+     * Query over the columnar table. Filters produce the selection vector of the row indices, the rows
+     * aren't copied. Filter over all rows evaluates the predicate into the bitmap by blocks of 64 rows,
+     * the block loop has no branches and it is vectorized for the simple predicates.
+     * Aggregates over all rows of the numeric column use the vectorized reduction kernels.
+     * @tparam Columns Types of the table columns.
+     */
+    template<typename... Columns>
+    class ColumnarQuery
+    {
+    private:
+        using Table = ColumnarTable<Columns...>;
+
+        const Table *m_table;
+        // Selected row indices in ascending order, nullptr when all rows are selected.
+        std::shared_ptr<const std::vector<size_t>> m_selection;
+
+        ColumnarQuery(const Table *table, std::shared_ptr<const std::vector<size_t>> selection)
+                : m_table(table), m_selection(std::move(selection))
+        {
+        }
+
+        template<size_t... Is, typename Predicate>
+        bool test_row(const Predicate &predicate, const size_t row) const
+        {
+            return static_cast<bool>(predicate(m_table->template column<Is>()[row]...));
+        }
+
+        // Call fn(row) for every selected row.
+        template<typename Function>
+        void for_each_row(Function fn) const
+        {
+            if (m_selection)
+            {
+                for (const size_t row : *m_selection)
+                {
+                    fn(row);
+                }
+            }
+            else
+            {
+                for (size_t row = 0; row < m_table->size(); ++row)
+                {
+                    fn(row);
+                }
+            }
+        }
+
+        template<size_t I>
+        const auto *column_data() const
+        {
+            return m_table->template column<I>().data();
+        }
+
+    public:
+        template<size_t I>
+        using ColumnType = typename Table::template ColumnType<I>;
+
+        explicit ColumnarQuery(const Table &table) : m_table(&table)
+        {
+        }
+
+        /**
+         * Keep the rows, which satisfy the predicate. Predicate receives the values of the columns Is... of the row.
+         * Filter over all rows is evaluated by the thread pool with the parallel policy.
+         * @param predicate Predicate on the column values.
+         * @param policy Execution policy of the filter over all rows.
+         * @return Query with the selection of the satisfying rows.
+         */
+        template<size_t... Is, typename Predicate>
+        ColumnarQuery where(const Predicate &predicate, const ExecutionPolicy policy = ExecutionPolicy_Sequential) const
+        {
+            static_assert(sizeof...(Is) > 0, "Predicate must read at least one column.");
+            auto selection = std::make_shared<std::vector<size_t>>();
+            if (m_selection)
+            {
+                // Branchless compaction, every row is written and the position advances only when it satisfies.
+                selection->resize(m_selection->size());
+                size_t count = 0;
+                for (const size_t row : *m_selection)
+                {
+                    (*selection)[count] = row;
+                    count += test_row<Is...>(predicate, row) ? 1 : 0;
+                }
+                selection->resize(count);
+            }
+            else
+            {
+                const std::vector<u64> bitmap = where_bitmap<Is...>(predicate, policy);
+                size_t count = 0;
+                for (const u64 word : bitmap)
+                {
+                    count += static_cast<size_t>(__builtin_popcountll(word));
+                }
+                selection->reserve(count);
+                for (size_t wordIndex = 0; wordIndex < bitmap.size(); ++wordIndex)
+                {
+                    for (u64 word = bitmap[wordIndex]; word != 0; word &= word - 1)
+                    {
+                        selection->push_back(wordIndex * ColumnarBitmapWordSize + static_cast<size_t>(__builtin_ctzll(word)));
+                    }
+                }
+            }
+            return ColumnarQuery(m_table, std::move(selection));
+        }
+
+        /**
+         * Evaluate the predicate for the selected rows into the bitmap, bit (i % 64) of the word (i / 64)
+         * is set when the row i is selected and satisfies the predicate.
+         * @param predicate Predicate on the values of the columns Is....
+         * @param policy Execution policy of the evaluation over all rows.
+         * @return Bitmap of the table rows.
+         */
+        template<size_t... Is, typename Predicate>
+        std::vector<u64> where_bitmap(const Predicate &predicate, const ExecutionPolicy policy = ExecutionPolicy_Sequential) const
+        {
+            const size_t rowCount = m_table->size();
+            std::vector<u64> bitmap((rowCount + ColumnarBitmapWordSize - 1) / ColumnarBitmapWordSize, 0);
+            if (m_selection)
+            {
+                for (const size_t row : *m_selection)
+                {
+                    bitmap[row / ColumnarBitmapWordSize] |= static_cast<u64>(test_row<Is...>(predicate, row))
+                            << (row % ColumnarBitmapWordSize);
+                }
+                return bitmap;
+            }
+
+            const size_t fullWordCount = rowCount / ColumnarBitmapWordSize;
+            parallel_for<u64>(fullWordCount, policy, [&](const size_t from, const size_t to)
+            {
+                for (size_t wordIndex = from; wordIndex < to; ++wordIndex)
+                {
+                    const size_t base = wordIndex * ColumnarBitmapWordSize;
+                    u64 word = 0;
+                    for (size_t bit = 0; bit < ColumnarBitmapWordSize; ++bit)
+                    {
+                        word |= static_cast<u64>(test_row<Is...>(predicate, base + bit)) << bit;
+                    }
+                    bitmap[wordIndex] = word;
+                }
+            });
+            for (size_t row = fullWordCount * ColumnarBitmapWordSize; row < rowCount; ++row)
+            {
+                bitmap[fullWordCount] |= static_cast<u64>(test_row<Is...>(predicate, row)) << (row % ColumnarBitmapWordSize);
+            }
+            return bitmap;
+        }
+
+        /**
+         * Get the bitmap of the selected rows.
+         */
+        [[nodiscard]] std::vector<u64> bitmap() const
+        {
+            std::vector<u64> result((m_table->size() + ColumnarBitmapWordSize - 1) / ColumnarBitmapWordSize, 0);
+            for_each_row([&result](const size_t row)
+                         { result[row / ColumnarBitmapWordSize] |= static_cast<u64>(1) << (row % ColumnarBitmapWordSize); });
+            return result;
+        }
+
+        /**
+         * Get the indices of the selected rows in ascending order.
+         */
+        [[nodiscard]] std::vector<size_t> selection() const
+        {
+            return m_selection ? *m_selection : range(m_table->size());
+        }
+
+        [[nodiscard]] bool is_all_rows() const noexcept
+        {
+            return !m_selection;
+        }
+
+        [[nodiscard]] size_t count() const
+        {
+            return m_selection ? m_selection->size() : m_table->size();
+        }
+
+        [[nodiscard]] bool any() const
+        {
+            return count() > 0;
+        }
+
+        /**
+         * Gather the values of the column I in the selected rows.
+         * @return Enumerable of the column values.
+         */
+        template<size_t I>
+        Enumerable<ColumnType<I>> select() const
+        {
+            if (!m_selection)
+            {
+                return Enumerable<ColumnType<I>>(m_table->template column<I>());
+            }
+            const auto *data = column_data<I>();
+            std::vector<ColumnType<I>> result(m_selection->size());
+            for (size_t i = 0; i < m_selection->size(); ++i)
+            {
+                result[i] = data[(*m_selection)[i]];
+            }
+            return Enumerable<ColumnType<I>>(std::move(result));
+        }
+
+        /**
+         * Project the selected rows by the selector, which receives the values of the columns Is....
+         * @return Enumerable of the projected values.
+         */
+        template<size_t I0, size_t... Is, typename SelectorFunction,
+                typename SelectType = std::decay_t<std::invoke_result_t<SelectorFunction &, const ColumnType<I0> &, const ColumnType<Is> &...>>>
+        Enumerable<SelectType> select(SelectorFunction selector) const
+        {
+            std::vector<SelectType> result;
+            result.reserve(count());
+            for_each_row([&](const size_t row)
+                         { result.push_back(selector(m_table->template column<I0>()[row], m_table->template column<Is>()[row]...)); });
+            return Enumerable<SelectType>(std::move(result));
+        }
+
+        /**
+         * Sum the column I over the selected rows, in the column type.
+         */
+        template<size_t I>
+        ColumnType<I> sum() const
+        {
+            using T = ColumnType<I>;
+            static_assert(std::is_arithmetic_v<T>, "Column must be numeric type");
+            const auto *data = column_data<I>();
+            // Floating point columns always use the sequential loop, so that the result doesn't depend on the selection.
+            if constexpr (has_simd_reduction_v<T> && std::is_integral_v<T>)
+            {
+                if (!m_selection)
+                {
+                    return (count() == 0) ? T{} : simd_sum(data, count());
+                }
+            }
+            T result{};
+            for_each_row([&result, data](const size_t row)
+                         { result += data[row]; });
+            return result;
+        }
+
+        template<size_t I>
+        double average() const noexcept(false)
+        {
+            if (count() == 0)
+            {
+                throw EnumerableError("Enumerable is empty.");
+            }
+            return static_cast<double>(sum<I>()) / static_cast<double>(count());
+        }
+
+        template<size_t I>
+        std::pair<ColumnType<I>, ColumnType<I>> min_max() const noexcept(false)
+        {
+            using T = ColumnType<I>;
+            if (count() == 0)
+            {
+                throw EnumerableError("Enumerable is empty.");
+            }
+            const auto *data = column_data<I>();
+            if constexpr (has_simd_reduction_v<T> && std::is_integral_v<T>)
+            {
+                if (!m_selection)
+                {
+                    return simd_min_max(data, count());
+                }
+            }
+            const size_t first = m_selection ? m_selection->front() : 0;
+            std::pair<T, T> result(data[first], data[first]);
+            for_each_row([&result, data](const size_t row)
+                         {
+                             if (data[row] < result.first)
+                             {
+                                 result.first = data[row];
+                             }
+                             if (result.second < data[row])
+                             {
+                                 result.second = data[row];
+                             }
+                         });
+            return result;
+        }
+
+        template<size_t I>
+        ColumnType<I> min() const noexcept(false)
+        {
+            return min_max<I>().first;
+        }
+
+        template<size_t I>
+        ColumnType<I> max() const noexcept(false)
+        {
+            return min_max<I>().second;
+        }
+
+        /**
+         * Gather the selected rows into the new table, only the selected rows of every column are copied.
+         */
+        Table to_table() const
+        {
+            Table result;
+            result.reserve(count());
+            for_each_row([&](const size_t row)
+                         { std::apply([&result](const auto &... values)
+                                      { result.push_back(values...); }, m_table->row(row)); });
+            return result;
+        }
+    };
+}
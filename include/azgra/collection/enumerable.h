@@ -1,7 +1,10 @@
 #pragma once
 
 #include "enumerable_functions.h"
+#include "enumerable_range.h"
+#include <optional>
 #include <random>
+#include <stdexcept>
 
 namespace azgra::collection
 {
@@ -13,130 +16,198 @@ namespace azgra::collection
         }
     };
 
-    template<typename T>
+    template<typename T, typename Range>
+    class ParallelEnumerable;
+
+    /**
+     * LINQ-like query over the sequence of items. Operators (where, select, take, skip, take_while, reverse)
+     * are lazy, they only compose the range chain, which is evaluated in single pass by the terminal operation
+     * (to_vector, first, sum, count, ...). Terminal operations stop pulling the items as soon as the result
+     * is known, so `take(10)` or `first()` reads only the needed prefix of the source.
+     *
+     * Enumerable<T> owns the vector of items, lazy query is implicitly materialized, when it is assigned to it.
+     * @tparam T Type of the items.
+     * @tparam Range Lazy range producing the items.
+     */
+    template<typename T, typename Range = VectorRange<T>>
     class Enumerable
     {
-        template<typename U>
+        template<typename U, typename OtherRange>
         friend
         class Enumerable;
 
     private:
-        std::vector<T> data;
+        static constexpr bool IsVectorBacked = std::is_same<Range, VectorRange<T>>::value;
+        Range m_range;
+
+        template<typename NewRange>
+        static Enumerable<typename NewRange::ValueType, NewRange> from_range(NewRange range)
+        {
+            return Enumerable<typename NewRange::ValueType, NewRange>(std::move(range));
+        }
+
+        void throw_if_limited_order() const
+        {
+            if (m_range.is_limited())
+            {
+                throw EnumerableError("then_by can't follow take, order the items before taking them.");
+            }
+        }
 
     public:
+        using ValueType = T;
+        using RangeType = Range;
+
         Enumerable() = default;
 
-        explicit Enumerable(std::vector<T> dataSrc)
+        /**
+         * Create query over the range.
+         * @param range Lazy range.
+         */
+        explicit Enumerable(Range range) : m_range(std::move(range))
+        {
+        }
+
+        explicit Enumerable(std::vector<T> dataSrc) : m_range(std::move(dataSrc))
         {
-            data = std::vector<T>(std::move(dataSrc));
         }
 
         template<typename CopyIt>
-        Enumerable(CopyIt srcBegin, CopyIt srcEnd)
+        Enumerable(CopyIt srcBegin, CopyIt srcEnd) : m_range(std::vector<T>(srcBegin, srcEnd))
         {
-            data = std::vector<T>(srcBegin, srcEnd);
         }
 
-        template<typename Predicate>
-        Enumerable<T> where(const Predicate &predicate) const noexcept
+        /**
+         * Materialize the lazy query into the vector backed Enumerable.
+         * @param query Lazy query.
+         */
+        template<typename OtherRange, typename R = Range,
+                typename = std::enable_if_t<std::is_same<R, VectorRange<T>>::value && !std::is_same<OtherRange, R>::value>>
+        Enumerable(const Enumerable<T, OtherRange> &query) : m_range(query.to_vector())
         {
-            Enumerable result;
-            result.data = azgra::collection::where(data.begin(), data.end(), predicate);
-            return result;
         }
 
-        template<typename SelectorFunction, typename SelectType = typename std::result_of<SelectorFunction &(T)>::type>
-        Enumerable<SelectType> select(SelectorFunction selector) const noexcept
+        /**
+         * Get the underlying range of the query.
+         * @return Lazy range.
+         */
+        [[nodiscard]] const Range &range() const noexcept
         {
-            Enumerable<SelectType> result;
-            result.data = azgra::collection::select(data.begin(), data.end(), selector);
-            return result;
+            return m_range;
         }
 
-        std::vector<T> to_vector() const noexcept
+        template<typename Predicate>
+        Enumerable<T, WhereRange<Range, Predicate>> where(const Predicate &predicate) const
         {
-            return data;
+            return from_range(WhereRange<Range, Predicate>(m_range, predicate));
         }
 
-        T first() const noexcept(false)
+        template<typename SelectorFunction, typename SelectType = std::decay_t<typename std::result_of<SelectorFunction &(T)>::type>>
+        Enumerable<SelectType, SelectRange<Range, SelectorFunction>> select(SelectorFunction selector) const
+        {
+            return from_range(SelectRange<Range, SelectorFunction>(m_range, std::move(selector)));
+        }
+
+        std::vector<T> to_vector() const
         {
-            if (data.size() > 0)
+            if constexpr (IsVectorBacked)
             {
-                return data[0];
+                return m_range.vector();
             }
             else
             {
-                throw EnumerableError("Enumerable is empty.");
+                std::vector<T> result;
+                if constexpr (Range::HasKnownSize)
+                {
+                    result.reserve(m_range.size());
+                }
+                auto cursor = m_range.cursor();
+                while (cursor.move_next())
+                {
+                    result.push_back(cursor.current());
+                }
+                return result;
             }
         }
 
-        std::optional<T> first_or_default() const noexcept
+        T first() const noexcept(false)
         {
-            if (data.size() > 0)
+            auto cursor = m_range.cursor();
+            if (cursor.move_next())
             {
-                return data[0];
+                return cursor.current();
             }
-            else
+            throw EnumerableError("Enumerable is empty.");
+        }
+
+        std::optional<T> first_or_default() const
+        {
+            auto cursor = m_range.cursor();
+            if (cursor.move_next())
             {
-                return std::nullopt;
+                return cursor.current();
             }
+            return std::nullopt;
         }
 
         T last() const noexcept(false)
         {
-            if (data.size() > 0)
-            {
-                return data[data.size() - 1];
-            }
-            else
+            const std::optional<T> result = last_or_default();
+            if (result.has_value())
             {
-                throw EnumerableError("Enumerable is empty.");
+                return *result;
             }
+            throw EnumerableError("Enumerable is empty.");
         }
 
-        std::optional<T> last_or_default() const noexcept
+        std::optional<T> last_or_default() const
         {
-            if (data.size() > 0)
+            if constexpr (IsVectorBacked)
             {
-                return data[data.size() - 1];
+                const std::vector<T> &data = m_range.vector();
+                return data.empty() ? std::nullopt : std::optional<T>(data.back());
             }
             else
             {
-                return std::nullopt;
+                std::optional<T> result;
+                auto cursor = m_range.cursor();
+                while (cursor.move_next())
+                {
+                    result = cursor.current();
+                }
+                return result;
             }
         }
 
         template<typename Predicate>
         T first(const Predicate &predicate) const noexcept(false)
         {
-            if (data.size() > 0)
+            bool empty = true;
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
             {
-                for (const T &item : data)
+                empty = false;
+                if (predicate(cursor.current()))
                 {
-                    if (predicate(item))
-                    {
-                        return item;
-                    }
+                    return cursor.current();
                 }
-                throw EnumerableError("Didn't find requested item.");
             }
-            else
+            if (empty)
             {
                 throw EnumerableError("Enumerable is empty.");
             }
+            throw EnumerableError("Didn't find requested item.");
         }
 
         template<typename Predicate>
-        std::optional<T> first_or_default(const Predicate &predicate) const noexcept
+        std::optional<T> first_or_default(const Predicate &predicate) const
         {
-            if (data.size() > 0)
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
             {
-                for (const T &item : data)
+                if (predicate(cursor.current()))
                 {
-                    if (predicate(item))
-                    {
-                        return item;
-                    }
+                    return cursor.current();
                 }
             }
             return std::nullopt;
@@ -145,98 +216,85 @@ namespace azgra::collection
         template<typename Predicate>
         T single(const Predicate &predicate) const noexcept(false)
         {
-            T result;
-            bool found = false;
-            if (data.size() > 0)
+            bool empty = true;
+            std::optional<T> result;
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
             {
-                for (const T &item : data)
+                empty = false;
+                if (predicate(cursor.current()))
                 {
-                    if (predicate(item))
+                    if (result.has_value())
                     {
-                        if (found)
-                        {
-                            throw EnumerableError("More than one item satisfy the condition.");
-                        }
-                        result = item;
-                        found = true;
+                        throw EnumerableError("More than one item satisfy the condition.");
                     }
-                }
-                if (found)
-                {
-                    return result;
-                }
-                else
-                {
-                    throw EnumerableError("No item satisfies the condition.");
+                    result = cursor.current();
                 }
             }
-            else
+            if (empty)
             {
                 throw EnumerableError("Enumerable is empty.");
             }
+            if (!result.has_value())
+            {
+                throw EnumerableError("No item satisfies the condition.");
+            }
+            return *result;
         }
 
         template<typename Predicate>
         std::optional<T> single_or_default(const Predicate &predicate) const noexcept(false)
         {
-            T result;
-            bool found = false;
-            if (data.size() > 0)
+            std::optional<T> result;
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
             {
-                for (const T &item : data)
+                if (predicate(cursor.current()))
                 {
-                    if (predicate(item))
+                    if (result.has_value())
                     {
-                        if (found)
-                        {
-                            throw EnumerableError("More than one item satisfy the condition.");
-                        }
-                        result = item;
-                        found = true;
+                        throw EnumerableError("More than one item satisfy the condition.");
                     }
+                    result = cursor.current();
                 }
-                if (found)
-                {
-                    return result;
-                }
-                else
-                {
-                    return std::nullopt;
-                }
-            }
-            else
-            {
-                return std::nullopt;
             }
+            return result;
         }
 
-        bool any() const noexcept
+        bool any() const
         {
-            return data.size() > 0;
+            if constexpr (Range::HasKnownSize)
+            {
+                return m_range.size() > 0;
+            }
+            else
+            {
+                auto cursor = m_range.cursor();
+                return cursor.move_next();
+            }
         }
 
         template<typename Predicate>
-        bool any(const Predicate &predicate) const noexcept
+        bool any(const Predicate &predicate) const
         {
-            if (data.size() > 0)
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
             {
-                for (const T &item : data)
+                if (predicate(cursor.current()))
                 {
-                    if (predicate(item))
-                    {
-                        return true;
-                    }
+                    return true;
                 }
             }
             return false;
         }
 
         template<typename Predicate>
-        bool all(const Predicate &predicate) const noexcept
+        bool all(const Predicate &predicate) const
         {
-            for (const T &item : data)
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
             {
-                if (!predicate(item))
+                if (!predicate(cursor.current()))
                 {
                     return false;
                 }
@@ -244,198 +302,557 @@ namespace azgra::collection
             return true;
         }
 
-        [[nodiscard]] size_t count() const noexcept
+        [[nodiscard]] size_t count() const
         {
-            return data.size();
+            if constexpr (Range::HasKnownSize)
+            {
+                return m_range.size();
+            }
+            else
+            {
+                size_t result = 0;
+                auto cursor = m_range.cursor();
+                while (cursor.move_next())
+                {
+                    ++result;
+                }
+                return result;
+            }
         }
 
         template<typename Predicate>
-        size_t count(const Predicate &predicate) const noexcept
+        size_t count(const Predicate &predicate) const
         {
-            return azgra::collection::count(data.begin(), data.end(), predicate);
+            size_t result = 0;
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
+            {
+                if (predicate(cursor.current()))
+                {
+                    ++result;
+                }
+            }
+            return result;
         }
 
+        /**
+         * Check whether any item satisfies the predicate, or is equal to the value.
+         * @param predicateOrValue Predicate function or the searched value.
+         * @return True if the item was found.
+         */
         template<typename Predicate>
-        bool contains(const Predicate &predicate) const noexcept
+        bool contains(const Predicate &predicateOrValue) const
         {
-            return azgra::collection::contains(data.begin(), data.end(), predicate);
+            if constexpr (std::is_invocable_r<bool, const Predicate &, const T &>::value)
+            {
+                return any(predicateOrValue);
+            }
+            else if constexpr (std::is_same_v<Range, VectorRange<T>> && std::is_same_v<Predicate, T>)
+            {
+                const std::vector<T> &data = m_range.vector();
+                return azgra::collection::contains(data.begin(), data.end(), predicateOrValue);
+            }
+            else
+            {
+                return any([&predicateOrValue](const T &item)
+                           { return item == predicateOrValue; });
+            }
         }
 
-        double average() const noexcept
+        double average() const
         {
             static_assert(std::is_arithmetic_v<T>, "T must be numeric type");
             double sum = 0.0;
             size_t count = 0;
-            for (const T &item : data)
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
             {
-                sum += item;
+                sum += cursor.current();
                 ++count;
             }
 
             return (sum / static_cast<double>(count));
         }
 
-        auto sum() const noexcept
+        auto sum() const
         {
-            return std::accumulate(data.begin(), data.end(), 0.0);
+            double result = 0.0;
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
+            {
+                result += cursor.current();
+            }
+            return result;
         }
 
         template<typename SelectorFunction, typename SelectType = typename std::result_of<SelectorFunction &(T)>::type>
-        auto sum(SelectorFunction selector) const noexcept
+        auto sum(SelectorFunction selector) const
         {
-            return collection::sum(data.begin(), data.end(), selector);
+            static_assert(std::is_arithmetic<std::decay_t<SelectType>>::value, "T must be numeric type");
+            std::decay_t<SelectType> result{};
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
+            {
+                result += selector(cursor.current());
+            }
+            return result;
         }
 
-        Enumerable<T> reverse() const noexcept
+        T min() const noexcept(false)
         {
-            std::vector<T> reversedData(data.begin(), data.end());
-            std::reverse(reversedData.begin(), reversedData.end());
-            Enumerable<T> result(reversedData);
-            return result;
+            return min_max().first;
         }
 
-        Enumerable<T> take(const size_t count) const noexcept
+        T max() const noexcept(false)
         {
-            size_t takeSize = count < data.size() ? count : data.size();
-            Enumerable<T> result;
-            result.data.resize(takeSize);
-            for (size_t i = 0; i < takeSize; ++i)
-            {
-                result.data[i] = data[i];
-            }
-            return result;
+            return min_max().second;
         }
 
-        template<typename Predicate>
-        Enumerable<T> take_while(const Predicate &predicate) const noexcept
+        std::pair<T, T> min_max() const noexcept(false)
         {
-            Enumerable<T> result;
-            for (const T &item : data)
+            if constexpr (std::is_same_v<Range, VectorRange<T>> &&
+                          is_simd_exactly_reducible<typename std::vector<T>::const_iterator>())
+            {
+                // Vector of integers is reduced by the vector kernels.
+                const std::vector<T> &data = m_range.vector();
+                if (data.empty())
+                {
+                    throw EnumerableError("Enumerable is empty.");
+                }
+                return azgra::collection::min_max(data.begin(), data.end());
+            }
+            auto cursor = m_range.cursor();
+            if (!cursor.move_next())
+            {
+                throw EnumerableError("Enumerable is empty.");
+            }
+            std::pair<T, T> result(cursor.current(), cursor.current());
+            while (cursor.move_next())
             {
-                if (!predicate(item))
+                const auto &item = cursor.current();
+                if (item < result.first)
+                {
+                    result.first = item;
+                }
+                if (result.second < item)
                 {
-                    break;
+                    result.second = item;
                 }
-                result.data.push_back(item);
             }
             return result;
         }
 
-        Enumerable<T> skip(const size_t skipCount) const noexcept
+        /**
+         * Evaluate the rest of the query in parallel. Query, which can't be split into independent chunks
+         * (after take, skip, take_while or reverse), is materialized first.
+         * @return Parallel query.
+         */
+        auto as_parallel() const
         {
-            Enumerable<T> result;
-            if (skipCount >= data.size())
+            if constexpr (Range::IsSplittable)
             {
-                return result;
+                return ParallelEnumerable<T, Range>(m_range);
+            }
+            else
+            {
+                return ParallelEnumerable<T, VectorRange<T>>(VectorRange<T>(to_vector()));
             }
+        }
+
+        Enumerable<T, ReverseRange<Range>> reverse() const
+        {
+            return from_range(ReverseRange<Range>(m_range));
+        }
 
-            for (size_t i = skipCount; i < data.size(); ++i)
+        /**
+         * Take first count items. Take after order_by selects only the count first items by the bounded heap,
+         * instead of sorting the whole source.
+         */
+        auto take(const size_t count) const
+        {
+            if constexpr (is_ordered_range_v<Range>)
             {
-                result.data.push_back(data[i]);
+                return from_range(m_range.limit(count));
+            }
+            else
+            {
+                return from_range(TakeRange<Range>(m_range, count));
             }
-            return result;
         }
 
-        Enumerable<T> except(const std::vector<T> &exceptSrc) const noexcept
+        /**
+         * Stable sort by the key in the ascending order. Items are sorted when the query is evaluated.
+         * @param keySelector Key selector, keys are compared by operator<.
+         * @return Ordered Enumerable, which can be further ordered by then_by.
+         */
+        template<typename KeySelector>
+        Enumerable<T, OrderedRange<Range, OrderKey<KeySelector>>> order_by(KeySelector keySelector) const
         {
-            auto exceptData = collection::except(data.begin(), data.end(), exceptSrc.begin(), exceptSrc.end());
-            Enumerable<T> result(exceptData);
-            return result;
+            return from_range(OrderedRange<Range, OrderKey<KeySelector>>(m_range, OrderKey<KeySelector>(std::move(keySelector), false)));
         }
 
-        Enumerable<T> except(const Enumerable<T> &exceptSrc) const noexcept
+        template<typename KeySelector>
+        Enumerable<T, OrderedRange<Range, OrderKey<KeySelector>>> order_by_descending(KeySelector keySelector) const
         {
-            return except(exceptSrc.data);
+            return from_range(OrderedRange<Range, OrderKey<KeySelector>>(m_range, OrderKey<KeySelector>(std::move(keySelector), true)));
         }
 
-        Enumerable<T> distinct() const noexcept
+        /**
+         * Order items, which are equal by the previous keys, by the next key in the ascending order.
+         * Must directly follow order_by or then_by, `order_by(...).take(k).then_by(...)` throws EnumerableError,
+         * because the taken items were selected without the next key.
+         * @param keySelector Key selector, keys are compared by operator<.
+         * @return Ordered Enumerable.
+         */
+        template<typename KeySelector>
+        auto then_by(KeySelector keySelector) const
         {
-            Enumerable<T> result(azgra::collection::distinct(data.begin(), data.end()));
-            return result;
+            static_assert(is_ordered_range_v<Range>, "then_by must follow order_by.");
+            throw_if_limited_order();
+            return from_range(m_range.then_by(std::move(keySelector), false));
         }
 
+        template<typename KeySelector>
+        auto then_by_descending(KeySelector keySelector) const
+        {
+            static_assert(is_ordered_range_v<Range>, "then_by_descending must follow order_by.");
+            throw_if_limited_order();
+            return from_range(m_range.then_by(std::move(keySelector), true));
+        }
 
-        Enumerable<T> copy_part(const size_t size) const
+        template<typename Predicate>
+        Enumerable<T, TakeWhileRange<Range, Predicate>> take_while(const Predicate &predicate) const
+        {
+            return from_range(TakeWhileRange<Range, Predicate>(m_range, predicate));
+        }
+
+        Enumerable<T, SkipRange<Range>> skip(const size_t skipCount) const
+        {
+            return from_range(SkipRange<Range>(m_range, skipCount));
+        }
+
+        Enumerable<T> except(const std::vector<T> &exceptSrc) const
+        {
+            const robin_hood::unordered_set<T> exceptSet(exceptSrc.begin(), exceptSrc.end());
+            return Enumerable<T>(where([&exceptSet](const T &item)
+                                       { return exceptSet.find(item) == exceptSet.end(); }).to_vector());
+        }
+
+        template<typename OtherRange>
+        Enumerable<T> except(const Enumerable<T, OtherRange> &exceptSrc) const
+        {
+            return except(exceptSrc.to_vector());
+        }
+
+        Enumerable<T> distinct() const
+        {
+            robin_hood::unordered_set<T> seen;
+            return Enumerable<T>(where([&seen](const T &item)
+                                       { return seen.insert(item).second; }).to_vector());
+        }
+
+        /**
+         * Get distinct items, which are also in the other collection, in the order of this Enumerable.
+         */
+        template<typename OtherRange>
+        Enumerable<T> intersect(const Enumerable<T, OtherRange> &other) const
+        {
+            const std::vector<T> otherData = other.to_vector();
+            robin_hood::unordered_set<T> otherSet(otherData.begin(), otherData.end());
+            return Enumerable<T>(where([&otherSet](const T &item)
+                                       { return otherSet.erase(item) != 0; }).to_vector());
+        }
+
+        Enumerable<T> intersect(const std::vector<T> &other) const
+        {
+            return intersect(Enumerable<T>(other));
+        }
+
+        /**
+         * Get distinct items of both collections, items of this Enumerable go first.
+         */
+        template<typename OtherRange>
+        Enumerable<T> union_with(const Enumerable<T, OtherRange> &other) const
         {
-            if (size > data.size())
+            robin_hood::unordered_set<T> seen;
+            std::vector<T> result = where([&seen](const T &item)
+                                          { return seen.insert(item).second; }).to_vector();
+            auto cursor = other.range().cursor();
+            while (cursor.move_next())
             {
-                throw std::runtime_error("Requested copy of size larger than data size.");
+                const auto &item = cursor.current();
+                if (seen.insert(item).second)
+                {
+                    result.push_back(item);
+                }
             }
+            return Enumerable<T>(std::move(result));
+        }
 
-            Enumerable<T> result(data.begin(), data.begin() + size);
-            return result;
+        Enumerable<T> union_with(const std::vector<T> &other) const
+        {
+            return union_with(Enumerable<T>(other));
         }
 
+        /**
+         * Group items by the key, groups are ordered by the first occurrence of their key.
+         * @param keySelector Key selector.
+         * @return Enumerable of key and group items pairs.
+         */
+        template<typename KeySelector, typename Key = std::decay_t<typename std::result_of<KeySelector &(T)>::type>>
+        Enumerable<std::pair<Key, std::vector<T>>> group_by(KeySelector keySelector) const
+        {
+            robin_hood::unordered_flat_map<Key, size_t> groupIndices;
+            std::vector<std::pair<Key, std::vector<T>>> groups;
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
+            {
+                const auto &item = cursor.current();
+                Key key = keySelector(item);
+                const auto inserted = groupIndices.emplace(key, groups.size());
+                if (inserted.second)
+                {
+                    groups.emplace_back(std::move(key), std::vector<T>());
+                }
+                groups[inserted.first->second].second.push_back(item);
+            }
+            return Enumerable<std::pair<Key, std::vector<T>>>(std::move(groups));
+        }
+
+        /**
+         * Create map from the key to all items with that key.
+         * @param keySelector Key selector.
+         * @return Hash map of the groups.
+         */
+        template<typename KeySelector, typename Key = std::decay_t<typename std::result_of<KeySelector &(T)>::type>>
+        robin_hood::unordered_map<Key, std::vector<T>> to_lookup(KeySelector keySelector) const
+        {
+            robin_hood::unordered_map<Key, std::vector<T>> lookup;
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
+            {
+                const auto &item = cursor.current();
+                lookup[keySelector(item)].push_back(item);
+            }
+            return lookup;
+        }
+
+        /**
+         * Equi-join with the inner collection, which is hashed by its key. Result keeps the order of this Enumerable.
+         * @param inner Inner collection, should be the smaller one.
+         * @param outerKeySelector Key selector for items of this Enumerable.
+         * @param innerKeySelector Key selector for the inner items.
+         * @param resultSelector Function creating the result from the outer and inner item.
+         * @return Enumerable of the joined results.
+         */
+        template<typename TInner, typename InnerRange, typename OuterKeySelector, typename InnerKeySelector, typename ResultSelector,
+                typename ResultType = std::decay_t<typename std::result_of<ResultSelector &(T, TInner)>::type>>
+        Enumerable<ResultType> join(const Enumerable<TInner, InnerRange> &inner,
+                                    OuterKeySelector outerKeySelector,
+                                    InnerKeySelector innerKeySelector,
+                                    ResultSelector resultSelector) const
+        {
+            const auto innerLookup = inner.to_lookup(innerKeySelector);
+            std::vector<ResultType> result;
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
+            {
+                const auto &item = cursor.current();
+                const auto match = innerLookup.find(outerKeySelector(item));
+                if (match == innerLookup.end())
+                {
+                    continue;
+                }
+                for (const TInner &innerItem : match->second)
+                {
+                    result.push_back(resultSelector(item, innerItem));
+                }
+            }
+            return Enumerable<ResultType>(std::move(result));
+        }
+
+        Enumerable<T> copy_part(const size_t size) const
+        {
+            return copy_part(0, size);
+        }
 
         Enumerable<T> copy_part(const size_t from, const size_t size) const
         {
-            if ((from > data.size()) || (size > (data.size() - from)))
+            if constexpr (Range::HasKnownSize)
+            {
+                const size_t dataSize = m_range.size();
+                if ((from > dataSize) || (size > (dataSize - from)))
+                {
+                    throw std::runtime_error("Requested copy of size larger than data size.");
+                }
+            }
+            if constexpr (IsVectorBacked)
             {
-                throw std::runtime_error("Requested copy of size larger than data size.");
+                const auto fromIt = m_range.vector().begin() + from;
+                return Enumerable<T>(fromIt, fromIt + size);
             }
-            const auto fromIt = data.begin() + from;
-            Enumerable<T> result(fromIt, fromIt + size);
-            return result;
+            else
+            {
+                std::vector<T> result = skip(from).take(size).to_vector();
+                if (result.size() != size)
+                {
+                    throw std::runtime_error("Requested copy of size larger than data size.");
+                }
+                return Enumerable<T>(std::move(result));
+            }
+        }
+
+        /**
+         * Sums of the windows, updated incrementally by the incoming and outgoing items.
+         * @param windowSize Number of items in the window.
+         * @param mode Sliding or tumbling windows.
+         * @return Lazy Enumerable of the window sums.
+         */
+        Enumerable<T, WindowRange<Range, WindowSumAggregator<T>>> window_sum(const size_t windowSize,
+                                                                             const WindowMode mode = WindowMode_Sliding) const
+        {
+            static_assert(std::is_arithmetic_v<T>, "T must be numeric type");
+            return from_range(WindowRange<Range, WindowSumAggregator<T>>(m_range, WindowSumAggregator<T>(), windowSize, mode));
+        }
+
+        /**
+         * Arithmetic means of the windows.
+         * @param windowSize Number of items in the window.
+         * @param mode Sliding or tumbling windows.
+         * @return Lazy Enumerable of the window means.
+         */
+        Enumerable<double, WindowRange<Range, WindowMeanAggregator<T>>> window_mean(const size_t windowSize,
+                                                                                    const WindowMode mode = WindowMode_Sliding) const
+        {
+            static_assert(std::is_arithmetic_v<T>, "T must be numeric type");
+            return from_range(WindowRange<Range, WindowMeanAggregator<T>>(m_range, WindowMeanAggregator<T>(), windowSize, mode));
+        }
+
+        /**
+         * Minimum and maximum of the windows, found by the monotonic deques in O(1) amortized time per item.
+         * @param windowSize Number of items in the window.
+         * @param mode Sliding or tumbling windows.
+         * @return Lazy Enumerable of the pairs of the window minimum and maximum.
+         */
+        Enumerable<std::pair<T, T>, WindowRange<Range, WindowMinMaxAggregator<T>>>
+        window_min_max(const size_t windowSize, const WindowMode mode = WindowMode_Sliding) const
+        {
+            return from_range(WindowRange<Range, WindowMinMaxAggregator<T>>(m_range, WindowMinMaxAggregator<T>(), windowSize, mode));
+        }
+
+        /**
+         * Aggregate the windows by the user functions. Incoming item is added by state = combine(state, item),
+         * outgoing item of the sliding window is removed by state = uncombine(state, item).
+         * @param windowSize Number of items in the window.
+         * @param identity Aggregation state of the empty window.
+         * @param combine Function adding the item to the state.
+         * @param uncombine Function removing the item from the state, inverse of combine.
+         * @param mode Sliding or tumbling windows.
+         * @return Lazy Enumerable of the window states.
+         */
+        template<typename State, typename Combine, typename Uncombine>
+        Enumerable<State, WindowRange<Range, WindowFunctionAggregator<T, State, Combine, Uncombine>>>
+        window_aggregate(const size_t windowSize, State identity, Combine combine, Uncombine uncombine,
+                         const WindowMode mode = WindowMode_Sliding) const
+        {
+            using Aggregator = WindowFunctionAggregator<T, State, Combine, Uncombine>;
+            return from_range(WindowRange<Range, Aggregator>(m_range, Aggregator(std::move(identity), std::move(combine),
+                                                                                 std::move(uncombine)), windowSize, mode));
         }
 
         template<typename ResultType, typename MapFunction>
-        Enumerable<ResultType> for_each(const MapFunction &fn) const noexcept
+        Enumerable<ResultType> for_each(const MapFunction &fn) const
         {
-            Enumerable<ResultType> result;
-            result.data.resize(data.size());
-            std::transform(data.begin(), data.end(), result.data.begin(), fn);
-            return result;
+            std::vector<ResultType> result;
+            if constexpr (Range::HasKnownSize)
+            {
+                result.reserve(m_range.size());
+            }
+            auto cursor = m_range.cursor();
+            while (cursor.move_next())
+            {
+                result.push_back(fn(cursor.current()));
+            }
+            return Enumerable<ResultType>(std::move(result));
         }
 
         void shuffle_in_place()
         {
+            static_assert(IsVectorBacked, "Only materialized Enumerable can be shuffled.");
             std::random_device rd;
             std::mt19937 gen(rd());
+            std::vector<T> &data = m_range.mutable_vector();
             std::shuffle(data.begin(), data.end(), gen);
         }
 
-        static Enumerable<T> repeat(const size_t count, const T item)
+        static Enumerable<T, RepeatRange<T>> repeat(const size_t count, const T item)
         {
-            std::vector<T> items(count);
-            for (size_t i = 0; i < count; ++i)
-            {
-                items[i] = item;
-            }
-            return Enumerable(items);
+            return Enumerable<T, RepeatRange<T>>(RepeatRange<T>(item, count));
         }
 
-        static Enumerable<T> range(const T inclusiveFrom, const T exclusiveTo)
+        static Enumerable<T, IotaRange<T>> range(const T inclusiveFrom, const T exclusiveTo)
         {
             static_assert(std::is_integral_v<T>);
+            return Enumerable<T, IotaRange<T>>(IotaRange<T>(inclusiveFrom, exclusiveTo));
+        }
 
-            std::vector<T> items(exclusiveTo - inclusiveFrom);
-            for (auto i = inclusiveFrom; i < exclusiveTo; ++i)
-            {
-                items[i - inclusiveFrom] = i;
-            }
-            return Enumerable(items);
+        /**
+         * Create lazy Enumerable of the generated items.
+         * @param generator Function returning std::optional<T>, empty optional ends the sequence.
+         * @return Enumerable, which calls the generator copy in every traversal.
+         */
+        template<typename Generator>
+        static Enumerable<T, GeneratorRange<Generator>> generate(Generator generator)
+        {
+            static_assert(std::is_same_v<T, typename GeneratorRange<Generator>::ValueType>, "Generator must return std::optional<T>.");
+            return Enumerable<T, GeneratorRange<Generator>>(GeneratorRange<Generator>(std::move(generator)));
         }
 
         auto begin()
         {
-            return data.begin();
+            if constexpr (IsVectorBacked)
+            {
+                return m_range.mutable_vector().begin();
+            }
+            else
+            {
+                return m_range.begin();
+            }
         }
 
         auto end()
         {
-            return data.end();
+            if constexpr (IsVectorBacked)
+            {
+                return m_range.mutable_vector().end();
+            }
+            else
+            {
+                return m_range.end();
+            }
         }
 
         auto begin() const
         {
-            return data.begin();
+            return m_range.begin();
         }
 
         auto end() const
         {
-            return data.end();
+            return m_range.end();
         }
     };
 
-
+    /**
+     * Create lazy query over the copy of the vector.
+     * @param data Items of the query.
+     * @return Enumerable owning the items.
+     */
+    template<typename T>
+    Enumerable<T> make_enumerable(std::vector<T> data)
+    {
+        return Enumerable<T>(std::move(data));
+    }
 } // namespace azgra::collection
+
+#include "parallel_enumerable.h"
@@ -6,11 +6,49 @@
 #include <set>
 #include <unordered_set>
 #include <functional>
+#include "robin_hood.h"
+#include "simd_reductions.h"
 #include <algorithm>
 #include <numeric>
 
 namespace azgra::collection
 {
+    /**
+     * True if the iterator points to the continuous memory, i.e. it is a pointer or an iterator of std::vector.
+     * Values of such iterators can be processed by the vector kernels.
+     */
+    template<typename It, typename T = typename std::iterator_traits<It>::value_type>
+    constexpr bool is_contiguous_iterator_v = std::is_pointer_v<It> ||
+                                              std::is_same_v<It, typename std::vector<T>::iterator> ||
+                                              std::is_same_v<It, typename std::vector<T>::const_iterator>;
+
+    /**
+     * Check whether the values of the iterator range are reduced by the vector kernels from simd_reductions.h.
+     */
+    template<typename It, typename T = typename std::iterator_traits<It>::value_type>
+    constexpr bool is_simd_reducible()
+    {
+        if constexpr (has_simd_reduction_v<T>)
+        {
+            return is_contiguous_iterator_v<It>;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /**
+     * Check whether sum, min and max of the iterator range are computed by the vector kernels. Only integer values
+     * qualify, because their results don't depend on the order of the operations. Floating point values keep
+     * the sequential algorithms, with their summation order, NaN and signed zero handling.
+     */
+    template<typename It, typename T = typename std::iterator_traits<It>::value_type>
+    constexpr bool is_simd_exactly_reducible()
+    {
+        return is_simd_reducible<It>() && std::is_integral_v<T>;
+    }
+
     template<
             typename It,
             typename SelectorFunction,
@@ -47,7 +85,39 @@ namespace azgra::collection
     >
     auto sum(const It begin, const It end, const T initialValue)
     {
-        return std::accumulate(begin, end, initialValue);
+        if constexpr (is_simd_exactly_reducible<It>() && std::is_same_v<T, typename std::iterator_traits<It>::value_type>)
+        {
+            const size_t count = std::distance(begin, end);
+            return (count == 0) ? initialValue : static_cast<T>(initialValue + simd_sum(std::addressof(*begin), count));
+        }
+        else
+        {
+            return std::accumulate(begin, end, initialValue);
+        }
+    }
+
+    /**
+     * Sum the floating point values by the selected summation algorithm.
+     * @param mode Fast, pairwise or Kahan compensated summation.
+     * @return Sum of the values.
+     */
+    template<
+            typename It,
+            typename T = typename std::iterator_traits<It>::value_type
+    >
+    T sum(const It begin, const It end, const SummationMode mode)
+    {
+        static_assert(std::is_same_v<T, f32> || std::is_same_v<T, f64>, "T must be f32 or f64");
+        if constexpr (is_contiguous_iterator_v<It>)
+        {
+            const size_t count = std::distance(begin, end);
+            return (count == 0) ? T{} : simd_sum(std::addressof(*begin), count, mode);
+        }
+        else
+        {
+            const std::vector<T> values(begin, end);
+            return simd_sum(values.data(), values.size(), mode);
+        }
     }
 
     template<
@@ -67,6 +137,7 @@ namespace azgra::collection
         return sum;
     }
 
+    // Items of the first range, which are not in the second range. Duplicates of the first range are kept.
     template<
             typename It,
             typename It2,
@@ -76,13 +147,145 @@ namespace azgra::collection
     std::vector<T> except(const It begin, const It end, const It2 exceptBegin, const It2 exceptEnd)
     {
         static_assert(std::is_same<T, T2>::value);
+        const robin_hood::unordered_set<T> exceptSet(exceptBegin, exceptEnd);
         std::vector<T> result;
-
-        std::copy_if(begin, end, std::back_inserter(result), [exceptBegin, exceptEnd](const T &value)
+        std::copy_if(begin, end, std::back_inserter(result), [&exceptSet](const T &value)
         {
-            return (std::find(exceptBegin, exceptEnd, value) == exceptEnd);
+            return (exceptSet.find(value) == exceptSet.end());
         });
+        return result;
+    }
 
+    // Distinct items of the first range, which are also in the second range, in the first range order.
+    template<
+            typename It,
+            typename It2,
+            typename T = typename std::iterator_traits<It>::value_type,
+            typename T2 = typename std::iterator_traits<It2>::value_type
+    >
+    std::vector<T> intersect(const It begin, const It end, const It2 otherBegin, const It2 otherEnd)
+    {
+        static_assert(std::is_same<T, T2>::value);
+        robin_hood::unordered_set<T> otherSet(otherBegin, otherEnd);
+        std::vector<T> result;
+        for (It it = begin; it != end; ++it)
+        {
+            // Erase from the set, so that every item is taken only once.
+            if (otherSet.erase(*it) != 0)
+            {
+                result.push_back(*it);
+            }
+        }
+        return result;
+    }
+
+    // Distinct items of both ranges, first range items go first.
+    template<
+            typename It,
+            typename It2,
+            typename T = typename std::iterator_traits<It>::value_type,
+            typename T2 = typename std::iterator_traits<It2>::value_type
+    >
+    std::vector<T> union_with(const It begin, const It end, const It2 otherBegin, const It2 otherEnd)
+    {
+        static_assert(std::is_same<T, T2>::value);
+        robin_hood::unordered_set<T> seen;
+        std::vector<T> result;
+        for (It it = begin; it != end; ++it)
+        {
+            if (seen.insert(*it).second)
+            {
+                result.push_back(*it);
+            }
+        }
+        for (It2 it = otherBegin; it != otherEnd; ++it)
+        {
+            if (seen.insert(*it).second)
+            {
+                result.push_back(*it);
+            }
+        }
+        return result;
+    }
+
+    // Groups of items with the same key, in the order of the first occurrence of the key.
+    template<
+            typename It,
+            typename KeySelector,
+            typename T = typename std::iterator_traits<It>::value_type,
+            typename Key = std::decay_t<typename std::result_of<KeySelector &(T)>::type>
+    >
+    std::vector<std::pair<Key, std::vector<T>>> group_by(const It begin, const It end, KeySelector keySelector)
+    {
+        robin_hood::unordered_flat_map<Key, size_t> groupIndices;
+        std::vector<std::pair<Key, std::vector<T>>> groups;
+        for (It it = begin; it != end; ++it)
+        {
+            Key key = keySelector(*it);
+            const auto inserted = groupIndices.emplace(key, groups.size());
+            if (inserted.second)
+            {
+                groups.emplace_back(std::move(key), std::vector<T>());
+            }
+            groups[inserted.first->second].second.push_back(*it);
+        }
+        return groups;
+    }
+
+    // Map from the key to all items with that key.
+    template<
+            typename It,
+            typename KeySelector,
+            typename T = typename std::iterator_traits<It>::value_type,
+            typename Key = std::decay_t<typename std::result_of<KeySelector &(T)>::type>
+    >
+    robin_hood::unordered_map<Key, std::vector<T>> to_lookup(const It begin, const It end, KeySelector keySelector)
+    {
+        robin_hood::unordered_map<Key, std::vector<T>> lookup;
+        for (It it = begin; it != end; ++it)
+        {
+            lookup[keySelector(*it)].push_back(*it);
+        }
+        return lookup;
+    }
+
+    // Equi-join, result is resultSelector(outer, inner) for every pair with equal keys, in the outer range order.
+    // Inner range is hashed, so it should be the smaller one. Inner iterators must be forward iterators.
+    template<
+            typename OuterIt,
+            typename InnerIt,
+            typename OuterKeySelector,
+            typename InnerKeySelector,
+            typename ResultSelector,
+            typename TOuter = typename std::iterator_traits<OuterIt>::value_type,
+            typename TInner = typename std::iterator_traits<InnerIt>::value_type,
+            typename Key = std::decay_t<typename std::result_of<OuterKeySelector &(TOuter)>::type>,
+            typename ResultType = std::decay_t<typename std::result_of<ResultSelector &(TOuter, TInner)>::type>
+    >
+    std::vector<ResultType> join(const OuterIt outerBegin, const OuterIt outerEnd,
+                                 const InnerIt innerBegin, const InnerIt innerEnd,
+                                 OuterKeySelector outerKeySelector, InnerKeySelector innerKeySelector,
+                                 ResultSelector resultSelector)
+    {
+        robin_hood::unordered_map<Key, std::vector<InnerIt>> innerLookup;
+        for (InnerIt it = innerBegin; it != innerEnd; ++it)
+        {
+            innerLookup[innerKeySelector(*it)].push_back(it);
+        }
+
+        std::vector<ResultType> result;
+        for (OuterIt outerIt = outerBegin; outerIt != outerEnd; ++outerIt)
+        {
+            const auto match = innerLookup.find(outerKeySelector(*outerIt));
+            if (match == innerLookup.end())
+            {
+                continue;
+            }
+            for (const InnerIt &innerIt : match->second)
+            {
+                result.push_back(resultSelector(*outerIt, *innerIt));
+            }
+        }
         return result;
     }
 
@@ -92,6 +295,13 @@ namespace azgra::collection
     >
     T max(const It begin, const It end)
     {
+        if constexpr (is_simd_exactly_reducible<It>())
+        {
+            if (begin != end)
+            {
+                return simd_min_max(std::addressof(*begin), std::distance(begin, end)).second;
+            }
+        }
         const auto maxValue = *std::max_element(begin, end);
         return maxValue;
     }
@@ -102,6 +312,13 @@ namespace azgra::collection
     >
     T min(const It begin, const It end)
     {
+        if constexpr (is_simd_exactly_reducible<It>())
+        {
+            if (begin != end)
+            {
+                return simd_min_max(std::addressof(*begin), std::distance(begin, end)).first;
+            }
+        }
         const auto minValue = *std::min_element(begin, end);
         return minValue;
     }
@@ -112,7 +329,13 @@ namespace azgra::collection
     >
     std::pair<T, T> min_max(const It begin, const It end)
     {
-
+        if constexpr (is_simd_exactly_reducible<It>())
+        {
+            if (begin != end)
+            {
+                return simd_min_max(std::addressof(*begin), std::distance(begin, end));
+            }
+        }
         const auto minMaxValue = std::minmax_element(begin, end);
         return std::make_pair(*minMaxValue.first, *minMaxValue.second);
     }
@@ -123,6 +346,10 @@ namespace azgra::collection
     >
     size_t count(const It begin, const It end, const T &value)
     {
+        if constexpr (is_simd_reducible<It>())
+        {
+            return (begin == end) ? 0 : simd_count(std::addressof(*begin), std::distance(begin, end), value);
+        }
         size_t result = std::count(begin, end, value);
         return result;
     }
@@ -170,6 +397,10 @@ namespace azgra::collection
     >
     bool contains(const It begin, const It end, const T &value)
     {
+        if constexpr (is_simd_reducible<It>())
+        {
+            return (begin != end) && simd_contains(std::addressof(*begin), std::distance(begin, end), value);
+        }
         const It itPos = std::find(begin, end, value);
         return (itPos != end);
     }
@@ -193,13 +424,17 @@ namespace azgra::collection
     >
     std::vector<T> distinct(const It begin, const It end)
     {
-        std::unordered_set<T> set(begin, end);
-        std::vector<T> result(set.begin(), set.end());
+        // Items are kept in the order of their first occurrence.
+        robin_hood::unordered_set<T> seen;
+        std::vector<T> result;
+        for (It it = begin; it != end; ++it)
+        {
+            if (seen.insert(*it).second)
+            {
+                result.push_back(*it);
+            }
+        }
         return result;
-//        std::sort(result);
-//        const auto lastItPos = std::unique(result.begin(), result.end());
-//        result.erase(lastItPos, result.end());
-//        return result;
     }
 
     template<
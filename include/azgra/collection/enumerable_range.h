@@ -0,0 +1,1452 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include "sort.h"
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace azgra::collection
+{
+    // Ranges are the lazy stages of the Enumerable query. Every range provides:
+    //  - ValueType, type of the produced items,
+    //  - Cursor cursor() const, the pull cursor which traverses the range once,
+    //  - HasKnownSize and size(), when the item count is known without traversal,
+    //  - IsSplittable, split_size() and cursor(from, to), when the cursor can start at any index of the source,
+    //    so that the range can be evaluated by independent chunks in parallel.
+    // Cursor starts before the first item, move_next() advances it and returns false at the end,
+    // current() returns the current item, it must be bound by `const auto &`, because some cursors
+    // return the item by value.
+    // Stages hold their source range by value, sources share their data, so composing the query never
+    // copies the items. Items are pulled through the whole chain one by one, only when the query is evaluated.
+
+    /**
+     * Input iterator over the range cursor. Copies of the iterator share the cursor, because the range can be
+     * traversed only once.
+     * @tparam Cursor Range cursor.
+     */
+    template<typename Cursor>
+    class CursorIterator
+    {
+    private:
+        std::shared_ptr<Cursor> m_cursor;
+
+        void advance()
+        {
+            if (!m_cursor->move_next())
+            {
+                m_cursor.reset();
+            }
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename Cursor::ValueType;
+        using difference_type = std::ptrdiff_t;
+        using reference = decltype(std::declval<const Cursor &>().current());
+        using pointer = const value_type *;
+
+        /**
+         * Create the end iterator.
+         */
+        CursorIterator() = default;
+
+        /**
+         * Create iterator pointing to the first item of the cursor.
+         * @param cursor Cursor before its first item.
+         */
+        explicit CursorIterator(Cursor cursor) : m_cursor(std::make_shared<Cursor>(std::move(cursor)))
+        {
+            advance();
+        }
+
+        reference operator*() const
+        {
+            return m_cursor->current();
+        }
+
+        pointer operator->() const
+        {
+            return &m_cursor->current();
+        }
+
+        CursorIterator &operator++()
+        {
+            advance();
+            return *this;
+        }
+
+        struct PostIncrementProxy
+        {
+            value_type value;
+
+            const value_type &operator*() const
+            {
+                return value;
+            }
+        };
+
+        PostIncrementProxy operator++(int)
+        {
+            PostIncrementProxy proxy{**this};
+            advance();
+            return proxy;
+        }
+
+        bool operator==(const CursorIterator &other) const
+        {
+            return m_cursor == other.m_cursor;
+        }
+
+        bool operator!=(const CursorIterator &other) const
+        {
+            return m_cursor != other.m_cursor;
+        }
+    };
+
+    /**
+     * Base of the lazy ranges, provides iteration over the cursor.
+     */
+    template<typename Derived>
+    class RangeBase
+    {
+    public:
+        auto begin() const
+        {
+            return CursorIterator<typename Derived::Cursor>(static_cast<const Derived &>(*this).cursor());
+        }
+
+        auto end() const
+        {
+            return CursorIterator<typename Derived::Cursor>();
+        }
+    };
+
+    /**
+     * Source range over the shared vector. Copies of the range share the vector, mutable access detaches it.
+     */
+    template<typename T>
+    class VectorRange
+    {
+    private:
+        std::shared_ptr<std::vector<T>> m_data;
+
+    public:
+        using ValueType = T;
+        static constexpr bool HasKnownSize = true;
+        static constexpr bool IsSplittable = true;
+
+        template<typename It>
+        class IteratorCursor
+        {
+        private:
+            std::shared_ptr<std::vector<T>> m_owner;
+            It m_next;
+            It m_end;
+            It m_current;
+
+        public:
+            using ValueType = T;
+
+            IteratorCursor(std::shared_ptr<std::vector<T>> owner, It begin, It end) :
+                    m_owner(std::move(owner)), m_next(begin), m_end(end), m_current(begin)
+            {
+            }
+
+            bool move_next()
+            {
+                if (m_next == m_end)
+                {
+                    return false;
+                }
+                m_current = m_next++;
+                return true;
+            }
+
+            decltype(auto) current() const
+            {
+                return *m_current;
+            }
+        };
+
+        using Cursor = IteratorCursor<typename std::vector<T>::const_iterator>;
+        using ReverseCursor = IteratorCursor<typename std::vector<T>::const_reverse_iterator>;
+
+        VectorRange() : m_data(std::make_shared<std::vector<T>>())
+        {
+        }
+
+        explicit VectorRange(std::vector<T> data) : m_data(std::make_shared<std::vector<T>>(std::move(data)))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_data, m_data->cbegin(), m_data->cend());
+        }
+
+        [[nodiscard]] Cursor cursor(const size_t from, const size_t to) const
+        {
+            return Cursor(m_data, m_data->cbegin() + from, m_data->cbegin() + to);
+        }
+
+        [[nodiscard]] size_t split_size() const noexcept
+        {
+            return m_data->size();
+        }
+
+        [[nodiscard]] ReverseCursor reverse_cursor() const
+        {
+            return ReverseCursor(m_data, m_data->crbegin(), m_data->crend());
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_data->size();
+        }
+
+        [[nodiscard]] const std::vector<T> &vector() const noexcept
+        {
+            return *m_data;
+        }
+
+        /**
+         * Get mutable vector, which is copied first, if it is shared with other range.
+         * @return Vector owned only by this range.
+         */
+        std::vector<T> &mutable_vector()
+        {
+            if (m_data.use_count() > 1)
+            {
+                m_data = std::make_shared<std::vector<T>>(*m_data);
+            }
+            return *m_data;
+        }
+
+        auto begin() const
+        {
+            return m_data->cbegin();
+        }
+
+        auto end() const
+        {
+            return m_data->cend();
+        }
+    };
+
+    /**
+     * Range of consecutive integers [from, to).
+     */
+    template<typename T>
+    class IotaRange : public RangeBase<IotaRange<T>>
+    {
+    private:
+        T m_from;
+        T m_to;
+
+    public:
+        using ValueType = T;
+        static constexpr bool HasKnownSize = true;
+        static constexpr bool IsSplittable = true;
+
+        class Cursor
+        {
+        private:
+            T m_next;
+            T m_end;
+            T m_current{};
+
+        public:
+            using ValueType = T;
+
+            Cursor(const T from, const T to) : m_next(from), m_end(to)
+            {
+            }
+
+            bool move_next()
+            {
+                if (!(m_next < m_end))
+                {
+                    return false;
+                }
+                m_current = m_next++;
+                return true;
+            }
+
+            const T &current() const
+            {
+                return m_current;
+            }
+        };
+
+        IotaRange(const T from, const T to) : m_from(from), m_to(std::max(from, to))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_from, m_to);
+        }
+
+        [[nodiscard]] Cursor cursor(const size_t from, const size_t to) const
+        {
+            return Cursor(static_cast<T>(m_from + from), static_cast<T>(m_from + to));
+        }
+
+        [[nodiscard]] size_t split_size() const noexcept
+        {
+            return size();
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return static_cast<size_t>(m_to - m_from);
+        }
+    };
+
+    /**
+     * Range repeating the single item.
+     */
+    template<typename T>
+    class RepeatRange : public RangeBase<RepeatRange<T>>
+    {
+    private:
+        std::shared_ptr<const T> m_item;
+        size_t m_count;
+
+    public:
+        using ValueType = T;
+        static constexpr bool HasKnownSize = true;
+        static constexpr bool IsSplittable = true;
+
+        class Cursor
+        {
+        private:
+            std::shared_ptr<const T> m_item;
+            size_t m_remaining;
+
+        public:
+            using ValueType = T;
+
+            Cursor(std::shared_ptr<const T> item, const size_t count) : m_item(std::move(item)), m_remaining(count)
+            {
+            }
+
+            bool move_next()
+            {
+                if (m_remaining == 0)
+                {
+                    return false;
+                }
+                --m_remaining;
+                return true;
+            }
+
+            const T &current() const
+            {
+                return *m_item;
+            }
+        };
+
+        RepeatRange(T item, const size_t count) : m_item(std::make_shared<const T>(std::move(item))), m_count(count)
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_item, m_count);
+        }
+
+        [[nodiscard]] Cursor cursor(const size_t from, const size_t to) const
+        {
+            return Cursor(m_item, to - from);
+        }
+
+        [[nodiscard]] size_t split_size() const noexcept
+        {
+            return m_count;
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_count;
+        }
+    };
+
+    /**
+     * Range of the items produced by the generator, which returns std::optional and the empty optional after
+     * the last item. Every cursor calls its own copy of the generator, so the stateful generator starts over
+     * in every traversal. Only the current item is held in the memory.
+     */
+    template<typename Generator>
+    class GeneratorRange : public RangeBase<GeneratorRange<Generator>>
+    {
+    private:
+        Generator m_generator;
+
+    public:
+        using ValueType = typename std::decay_t<std::invoke_result_t<Generator &>>::value_type;
+        static constexpr bool HasKnownSize = false;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        public:
+            using ValueType = typename std::decay_t<std::invoke_result_t<Generator &>>::value_type;
+
+        private:
+            Generator m_generator;
+            std::optional<ValueType> m_current;
+
+        public:
+            explicit Cursor(Generator generator) : m_generator(std::move(generator))
+            {
+            }
+
+            bool move_next()
+            {
+                m_current = m_generator();
+                return m_current.has_value();
+            }
+
+            const ValueType &current() const
+            {
+                return *m_current;
+            }
+        };
+
+        explicit GeneratorRange(Generator generator) : m_generator(std::move(generator))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_generator);
+        }
+    };
+
+    /**
+     * Items of the source range satisfying the predicate.
+     */
+    template<typename Range, typename Predicate>
+    class WhereRange : public RangeBase<WhereRange<Range, Predicate>>
+    {
+    private:
+        Range m_source;
+        Predicate m_predicate;
+
+    public:
+        using ValueType = typename Range::ValueType;
+        static constexpr bool HasKnownSize = false;
+        static constexpr bool IsSplittable = Range::IsSplittable;
+
+        class Cursor
+        {
+        private:
+            typename Range::Cursor m_source;
+            Predicate m_predicate;
+
+        public:
+            using ValueType = typename Range::ValueType;
+
+            Cursor(typename Range::Cursor source, Predicate predicate) :
+                    m_source(std::move(source)), m_predicate(std::move(predicate))
+            {
+            }
+
+            bool move_next()
+            {
+                while (m_source.move_next())
+                {
+                    if (m_predicate(m_source.current()))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            decltype(auto) current() const
+            {
+                return m_source.current();
+            }
+        };
+
+        WhereRange(Range source, Predicate predicate) : m_source(std::move(source)), m_predicate(std::move(predicate))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_source.cursor(), m_predicate);
+        }
+
+        [[nodiscard]] Cursor cursor(const size_t from, const size_t to) const
+        {
+            return Cursor(m_source.cursor(from, to), m_predicate);
+        }
+
+        [[nodiscard]] size_t split_size() const
+        {
+            return m_source.split_size();
+        }
+
+        [[nodiscard]] const Range &source() const noexcept
+        {
+            return m_source;
+        }
+
+        [[nodiscard]] const Predicate &predicate() const noexcept
+        {
+            return m_predicate;
+        }
+    };
+
+    /**
+     * Source items mapped by the selector. Selected item is computed once and kept in the cursor.
+     */
+    template<typename Range, typename Selector>
+    class SelectRange : public RangeBase<SelectRange<Range, Selector>>
+    {
+    private:
+        Range m_source;
+        Selector m_selector;
+
+    public:
+        using ValueType = std::decay_t<std::invoke_result_t<const Selector &, const typename Range::ValueType &>>;
+        static constexpr bool HasKnownSize = Range::HasKnownSize;
+        static constexpr bool IsSplittable = Range::IsSplittable;
+
+        class Cursor
+        {
+        public:
+            using ValueType = typename SelectRange::ValueType;
+
+        private:
+            typename Range::Cursor m_source;
+            Selector m_selector;
+            std::optional<ValueType> m_current;
+
+        public:
+
+            Cursor(typename Range::Cursor source, Selector selector) :
+                    m_source(std::move(source)), m_selector(std::move(selector))
+            {
+            }
+
+            bool move_next()
+            {
+                if (!m_source.move_next())
+                {
+                    return false;
+                }
+                m_current.emplace(m_selector(m_source.current()));
+                return true;
+            }
+
+            const ValueType &current() const
+            {
+                return *m_current;
+            }
+        };
+
+        SelectRange(Range source, Selector selector) : m_source(std::move(source)), m_selector(std::move(selector))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_source.cursor(), m_selector);
+        }
+
+        [[nodiscard]] Cursor cursor(const size_t from, const size_t to) const
+        {
+            return Cursor(m_source.cursor(from, to), m_selector);
+        }
+
+        [[nodiscard]] size_t split_size() const
+        {
+            return m_source.split_size();
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return m_source.size();
+        }
+
+        [[nodiscard]] const Range &source() const noexcept
+        {
+            return m_source;
+        }
+
+        [[nodiscard]] const Selector &selector() const noexcept
+        {
+            return m_selector;
+        }
+    };
+
+    /**
+     * First count items of the source range. Source isn't pulled after the last taken item.
+     */
+    template<typename Range>
+    class TakeRange : public RangeBase<TakeRange<Range>>
+    {
+    private:
+        Range m_source;
+        size_t m_count;
+
+    public:
+        using ValueType = typename Range::ValueType;
+        static constexpr bool HasKnownSize = Range::HasKnownSize;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        private:
+            typename Range::Cursor m_source;
+            size_t m_remaining;
+
+        public:
+            using ValueType = typename Range::ValueType;
+
+            Cursor(typename Range::Cursor source, const size_t count) : m_source(std::move(source)), m_remaining(count)
+            {
+            }
+
+            bool move_next()
+            {
+                if (m_remaining == 0)
+                {
+                    return false;
+                }
+                --m_remaining;
+                return m_source.move_next();
+            }
+
+            decltype(auto) current() const
+            {
+                return m_source.current();
+            }
+        };
+
+        TakeRange(Range source, const size_t count) : m_source(std::move(source)), m_count(count)
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_source.cursor(), m_count);
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return std::min(m_count, m_source.size());
+        }
+
+        [[nodiscard]] const Range &source() const noexcept
+        {
+            return m_source;
+        }
+
+        [[nodiscard]] size_t count() const noexcept
+        {
+            return m_count;
+        }
+    };
+
+    /**
+     * Source items after the first count items.
+     */
+    template<typename Range>
+    class SkipRange : public RangeBase<SkipRange<Range>>
+    {
+    private:
+        Range m_source;
+        size_t m_count;
+
+    public:
+        using ValueType = typename Range::ValueType;
+        static constexpr bool HasKnownSize = Range::HasKnownSize;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        private:
+            typename Range::Cursor m_source;
+            size_t m_toSkip;
+
+        public:
+            using ValueType = typename Range::ValueType;
+
+            Cursor(typename Range::Cursor source, const size_t count) : m_source(std::move(source)), m_toSkip(count)
+            {
+            }
+
+            bool move_next()
+            {
+                for (; m_toSkip > 0; --m_toSkip)
+                {
+                    if (!m_source.move_next())
+                    {
+                        m_toSkip = 0;
+                        return false;
+                    }
+                }
+                return m_source.move_next();
+            }
+
+            decltype(auto) current() const
+            {
+                return m_source.current();
+            }
+        };
+
+        SkipRange(Range source, const size_t count) : m_source(std::move(source)), m_count(count)
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_source.cursor(), m_count);
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            const size_t sourceSize = m_source.size();
+            return (m_count < sourceSize) ? (sourceSize - m_count) : 0;
+        }
+    };
+
+    /**
+     * Source items while the predicate is satisfied.
+     */
+    template<typename Range, typename Predicate>
+    class TakeWhileRange : public RangeBase<TakeWhileRange<Range, Predicate>>
+    {
+    private:
+        Range m_source;
+        Predicate m_predicate;
+
+    public:
+        using ValueType = typename Range::ValueType;
+        static constexpr bool HasKnownSize = false;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        private:
+            typename Range::Cursor m_source;
+            Predicate m_predicate;
+            bool m_finished = false;
+
+        public:
+            using ValueType = typename Range::ValueType;
+
+            Cursor(typename Range::Cursor source, Predicate predicate) :
+                    m_source(std::move(source)), m_predicate(std::move(predicate))
+            {
+            }
+
+            bool move_next()
+            {
+                if (m_finished || !m_source.move_next() || !m_predicate(m_source.current()))
+                {
+                    m_finished = true;
+                    return false;
+                }
+                return true;
+            }
+
+            decltype(auto) current() const
+            {
+                return m_source.current();
+            }
+        };
+
+        TakeWhileRange(Range source, Predicate predicate) : m_source(std::move(source)), m_predicate(std::move(predicate))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_source.cursor(), m_predicate);
+        }
+    };
+
+    /**
+     * Source items in the reverse order. Source is buffered when the cursor is created, because the last
+     * item is known only after the whole source was pulled.
+     */
+    template<typename Range>
+    class ReverseRange : public RangeBase<ReverseRange<Range>>
+    {
+    private:
+        Range m_source;
+
+    public:
+        using ValueType = typename Range::ValueType;
+        static constexpr bool HasKnownSize = Range::HasKnownSize;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        public:
+            using ValueType = typename Range::ValueType;
+
+        private:
+            std::vector<ValueType> m_items;
+            size_t m_next;
+
+        public:
+
+            explicit Cursor(typename Range::Cursor source)
+            {
+                while (source.move_next())
+                {
+                    m_items.push_back(source.current());
+                }
+                m_next = m_items.size();
+            }
+
+            bool move_next()
+            {
+                if (m_next == 0)
+                {
+                    return false;
+                }
+                --m_next;
+                return true;
+            }
+
+            decltype(auto) current() const
+            {
+                return m_items[m_next];
+            }
+        };
+
+        explicit ReverseRange(Range source) : m_source(std::move(source))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_source.cursor());
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return m_source.size();
+        }
+    };
+
+    /**
+     * Vector is traversed backwards without buffering.
+     */
+    template<typename T>
+    class ReverseRange<VectorRange<T>> : public RangeBase<ReverseRange<VectorRange<T>>>
+    {
+    private:
+        VectorRange<T> m_source;
+
+    public:
+        using ValueType = T;
+        using Cursor = typename VectorRange<T>::ReverseCursor;
+        static constexpr bool HasKnownSize = true;
+        static constexpr bool IsSplittable = false;
+
+        explicit ReverseRange(VectorRange<T> source) : m_source(std::move(source))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return m_source.reverse_cursor();
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return m_source.size();
+        }
+    };
+
+    /**
+     * Placement of the windows of the windowed aggregation.
+     */
+    enum WindowMode
+    {
+        // Window moves by one item, result is produced for every complete window, i.e. count - size + 1 results.
+        WindowMode_Sliding,
+        // Windows follow each other without overlap, incomplete last window is dropped.
+        WindowMode_Tumbling
+    };
+
+    /**
+     * Sum of the window items. Floating point items are summed in double, which limits the drift of the repeated
+     * addition and subtraction.
+     */
+    template<typename T>
+    class WindowSumAggregator
+    {
+    private:
+        using SumType = std::conditional_t<std::is_floating_point_v<T>, double, T>;
+        SumType m_sum{};
+
+    public:
+        using ResultType = T;
+
+        void add(const T &item)
+        {
+            m_sum += item;
+        }
+
+        void remove(const T &item)
+        {
+            m_sum -= item;
+        }
+
+        void clear()
+        {
+            m_sum = SumType{};
+        }
+
+        [[nodiscard]] T result(size_t) const
+        {
+            return static_cast<T>(m_sum);
+        }
+    };
+
+    /**
+     * Arithmetic mean of the window items.
+     */
+    template<typename T>
+    class WindowMeanAggregator
+    {
+    private:
+        double m_sum = 0.0;
+
+    public:
+        using ResultType = double;
+
+        void add(const T &item)
+        {
+            m_sum += static_cast<double>(item);
+        }
+
+        void remove(const T &item)
+        {
+            m_sum -= static_cast<double>(item);
+        }
+
+        void clear()
+        {
+            m_sum = 0.0;
+        }
+
+        [[nodiscard]] double result(const size_t windowSize) const
+        {
+            return m_sum / static_cast<double>(windowSize);
+        }
+    };
+
+    /**
+     * Minimum and maximum of the window items by the monotonic deques. Minimum deque holds the increasing items,
+     * which can still become the window minimum, every item is pushed and popped once, O(1) amortized per item.
+     * Items are removed in the order, in which they were added.
+     */
+    template<typename T>
+    class WindowMinMaxAggregator
+    {
+    private:
+        // Pairs of the sequence number of the item and the item.
+        std::deque<std::pair<u64, T>> m_min;
+        std::deque<std::pair<u64, T>> m_max;
+        u64 m_added = 0;
+        u64 m_removed = 0;
+
+    public:
+        using ResultType = std::pair<T, T>;
+
+        void add(const T &item)
+        {
+            while (!m_min.empty() && !(m_min.back().second < item))
+            {
+                m_min.pop_back();
+            }
+            while (!m_max.empty() && !(item < m_max.back().second))
+            {
+                m_max.pop_back();
+            }
+            m_min.emplace_back(m_added, item);
+            m_max.emplace_back(m_added, item);
+            ++m_added;
+        }
+
+        void remove(const T &)
+        {
+            if (m_min.front().first == m_removed)
+            {
+                m_min.pop_front();
+            }
+            if (m_max.front().first == m_removed)
+            {
+                m_max.pop_front();
+            }
+            ++m_removed;
+        }
+
+        void clear()
+        {
+            m_min.clear();
+            m_max.clear();
+            m_added = 0;
+            m_removed = 0;
+        }
+
+        [[nodiscard]] std::pair<T, T> result(size_t) const
+        {
+            return std::make_pair(m_min.front().second, m_max.front().second);
+        }
+    };
+
+    /**
+     * Aggregation by the user functions. State is updated by state = combine(state, item) for the incoming item
+     * and state = uncombine(state, item) for the outgoing item, uncombine must undo combine.
+     */
+    template<typename T, typename State, typename Combine, typename Uncombine>
+    class WindowFunctionAggregator
+    {
+    private:
+        State m_identity;
+        State m_state;
+        Combine m_combine;
+        Uncombine m_uncombine;
+
+    public:
+        using ResultType = State;
+
+        WindowFunctionAggregator(State identity, Combine combine, Uncombine uncombine)
+                : m_identity(identity), m_state(std::move(identity)), m_combine(std::move(combine)),
+                  m_uncombine(std::move(uncombine))
+        {
+        }
+
+        void add(const T &item)
+        {
+            m_state = m_combine(std::move(m_state), item);
+        }
+
+        void remove(const T &item)
+        {
+            m_state = m_uncombine(std::move(m_state), item);
+        }
+
+        void clear()
+        {
+            m_state = m_identity;
+        }
+
+        [[nodiscard]] const State &result(size_t) const
+        {
+            return m_state;
+        }
+    };
+
+    /**
+     * Results of the aggregation over the windows of the source range. Sliding window keeps its items in the ring buffer
+     * and updates the aggregator by one add() and one remove() per item, O(1) per item for the provided aggregators.
+     * Tumbling window clears the aggregator at the start of every window.
+     * @tparam Range Source range.
+     * @tparam Aggregator Type with add(item), remove(item), clear() and result(windowSize).
+     */
+    template<typename Range, typename Aggregator>
+    class WindowRange : public RangeBase<WindowRange<Range, Aggregator>>
+    {
+    private:
+        Range m_source;
+        Aggregator m_aggregator;
+        size_t m_windowSize;
+        WindowMode m_mode;
+
+    public:
+        using ValueType = typename Aggregator::ResultType;
+        static constexpr bool HasKnownSize = Range::HasKnownSize;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        public:
+            using ValueType = typename WindowRange::ValueType;
+
+        private:
+            using ItemType = typename Range::ValueType;
+
+            typename Range::Cursor m_source;
+            Aggregator m_aggregator;
+            size_t m_windowSize;
+            WindowMode m_mode;
+            std::vector<ItemType> m_window;
+            size_t m_oldest = 0;
+            std::optional<ValueType> m_current;
+
+            bool move_sliding()
+            {
+                if (m_window.size() == m_windowSize)
+                {
+                    if (!m_source.move_next())
+                    {
+                        return false;
+                    }
+                    ItemType &oldest = m_window[m_oldest];
+                    m_aggregator.remove(oldest);
+                    oldest = m_source.current();
+                    m_aggregator.add(oldest);
+                    m_oldest = (m_oldest + 1 == m_windowSize) ? 0 : m_oldest + 1;
+                    return true;
+                }
+                m_window.reserve(m_windowSize);
+                while (m_window.size() < m_windowSize)
+                {
+                    if (!m_source.move_next())
+                    {
+                        return false;
+                    }
+                    m_window.push_back(m_source.current());
+                    m_aggregator.add(m_window.back());
+                }
+                return true;
+            }
+
+            bool move_tumbling()
+            {
+                m_aggregator.clear();
+                for (size_t i = 0; i < m_windowSize; ++i)
+                {
+                    if (!m_source.move_next())
+                    {
+                        return false;
+                    }
+                    m_aggregator.add(m_source.current());
+                }
+                return true;
+            }
+
+        public:
+            Cursor(typename Range::Cursor source, Aggregator aggregator, const size_t windowSize, const WindowMode mode)
+                    : m_source(std::move(source)), m_aggregator(std::move(aggregator)), m_windowSize(windowSize), m_mode(mode)
+            {
+            }
+
+            bool move_next()
+            {
+                if (!((m_mode == WindowMode_Sliding) ? move_sliding() : move_tumbling()))
+                {
+                    return false;
+                }
+                m_current.emplace(m_aggregator.result(m_windowSize));
+                return true;
+            }
+
+            const ValueType &current() const
+            {
+                return *m_current;
+            }
+        };
+
+        WindowRange(Range source, Aggregator aggregator, const size_t windowSize, const WindowMode mode)
+                : m_source(std::move(source)), m_aggregator(std::move(aggregator)), m_windowSize(windowSize), m_mode(mode)
+        {
+            always_assert(windowSize > 0);
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_source.cursor(), m_aggregator, m_windowSize, m_mode);
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            const size_t sourceSize = m_source.size();
+            if (m_mode == WindowMode_Tumbling)
+            {
+                return sourceSize / m_windowSize;
+            }
+            return (sourceSize < m_windowSize) ? 0 : sourceSize - m_windowSize + 1;
+        }
+    };
+
+    /**
+     * Order by the key selected from the item, keys are compared by sort_key_less(), i.e. by operator<,
+     * with -0.0 equal to +0.0 and NaNs after all numbers. Radix sort of the large inputs uses the same order.
+     */
+    template<typename KeySelector>
+    class OrderKey
+    {
+    private:
+        KeySelector m_selector;
+        bool m_descending;
+
+    public:
+        static constexpr bool IsSingleKey = true;
+
+        OrderKey(KeySelector selector, const bool descending) : m_selector(std::move(selector)), m_descending(descending)
+        {
+        }
+
+        // Returns negative value if a goes before b, positive value if b goes before a and zero if they are equal.
+        template<typename T>
+        int compare(const T &a, const T &b) const
+        {
+            const auto &keyA = m_selector(a);
+            const auto &keyB = m_selector(b);
+            if (sort_key_less(keyA, keyB))
+            {
+                return m_descending ? 1 : -1;
+            }
+            if (sort_key_less(keyB, keyA))
+            {
+                return m_descending ? -1 : 1;
+            }
+            return 0;
+        }
+
+        template<typename T>
+        bool operator()(const T &a, const T &b) const
+        {
+            return compare(a, b) < 0;
+        }
+
+        [[nodiscard]] const KeySelector &selector() const noexcept
+        {
+            return m_selector;
+        }
+
+        [[nodiscard]] bool is_descending() const noexcept
+        {
+            return m_descending;
+        }
+    };
+
+    /**
+     * Order by the key, which is used only for the items equal by the previous order.
+     */
+    template<typename PreviousOrder, typename KeySelector>
+    class ThenOrderKey
+    {
+    private:
+        PreviousOrder m_previous;
+        OrderKey<KeySelector> m_key;
+
+    public:
+        static constexpr bool IsSingleKey = false;
+
+        ThenOrderKey(PreviousOrder previous, OrderKey<KeySelector> key) : m_previous(std::move(previous)), m_key(std::move(key))
+        {
+        }
+
+        template<typename T>
+        int compare(const T &a, const T &b) const
+        {
+            const int previous = m_previous.compare(a, b);
+            return (previous != 0) ? previous : m_key.compare(a, b);
+        }
+
+        template<typename T>
+        bool operator()(const T &a, const T &b) const
+        {
+            return compare(a, b) < 0;
+        }
+    };
+
+    /**
+     * Source items in the stable order given by the order keys. Items are sorted when the cursor is created.
+     * Single integer or float key is sorted by the radix sort, other orders by the parallel merge sort.
+     * Limited range keeps only the first limit items in the bounded heap instead of sorting the whole source.
+     */
+    template<typename Range, typename Order>
+    class OrderedRange : public RangeBase<OrderedRange<Range, Order>>
+    {
+    public:
+        using ValueType = typename Range::ValueType;
+        static constexpr bool HasKnownSize = Range::HasKnownSize;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        public:
+            using ValueType = typename Range::ValueType;
+
+        private:
+            std::vector<ValueType> m_items;
+            size_t m_next = 0;
+
+        public:
+            explicit Cursor(std::vector<ValueType> items) : m_items(std::move(items))
+            {
+            }
+
+            bool move_next()
+            {
+                if (m_next >= m_items.size())
+                {
+                    return false;
+                }
+                ++m_next;
+                return true;
+            }
+
+            decltype(auto) current() const
+            {
+                return m_items[m_next - 1];
+            }
+        };
+
+    private:
+        Range m_source;
+        Order m_order;
+        size_t m_limit;
+
+        std::vector<ValueType> pull_source() const
+        {
+            std::vector<ValueType> items;
+            if constexpr (HasKnownSize)
+            {
+                items.reserve(m_source.size());
+            }
+            auto source = m_source.cursor();
+            while (source.move_next())
+            {
+                items.push_back(source.current());
+            }
+            return items;
+        }
+
+        std::vector<ValueType> sort_all() const
+        {
+            std::vector<ValueType> items = pull_source();
+            if constexpr (Order::IsSingleKey)
+            {
+                using Key = std::decay_t<decltype(m_order.selector()(std::declval<const ValueType &>()))>;
+                if constexpr (is_radix_sortable_v<Key>)
+                {
+                    if (items.size() >= RadixSortThreshold)
+                    {
+                        std::vector<Key> keys;
+                        keys.reserve(items.size());
+                        for (const ValueType &item : items)
+                        {
+                            keys.push_back(m_order.selector()(item));
+                        }
+                        const std::vector<size_t> order = radix_sort_indices(keys, m_order.is_descending());
+                        std::vector<ValueType> sorted;
+                        sorted.reserve(items.size());
+                        for (const size_t index : order)
+                        {
+                            sorted.push_back(std::move(items[index]));
+                        }
+                        return sorted;
+                    }
+                }
+            }
+            parallel_stable_sort(items.begin(), items.end(), m_order);
+            return items;
+        }
+
+        std::vector<ValueType> select_top() const
+        {
+            // Heap entry remembers the source index, so that equal items keep their order.
+            using Entry = std::pair<ValueType, size_t>;
+            const auto entryLess = [this](const Entry &a, const Entry &b)
+            {
+                const int order = m_order.compare(a.first, b.first);
+                return (order < 0) || ((order == 0) && (a.second < b.second));
+            };
+
+            std::vector<Entry> heap;
+            if constexpr (HasKnownSize)
+            {
+                heap.reserve(std::min(m_limit, m_source.size()));
+            }
+            if (m_limit != 0)
+            {
+                size_t index = 0;
+                auto source = m_source.cursor();
+                while (source.move_next())
+                {
+                    const auto &item = source.current();
+                    if (heap.size() < m_limit)
+                    {
+                        heap.emplace_back(item, index);
+                        std::push_heap(heap.begin(), heap.end(), entryLess);
+                    }
+                    else if (m_order.compare(item, heap.front().first) < 0)
+                    {
+                        // Heap top is the last of the kept items, it is replaced by the better one.
+                        std::pop_heap(heap.begin(), heap.end(), entryLess);
+                        heap.back() = Entry(item, index);
+                        std::push_heap(heap.begin(), heap.end(), entryLess);
+                    }
+                    ++index;
+                }
+            }
+            std::sort_heap(heap.begin(), heap.end(), entryLess);
+
+            std::vector<ValueType> items;
+            items.reserve(heap.size());
+            for (Entry &entry : heap)
+            {
+                items.push_back(std::move(entry.first));
+            }
+            return items;
+        }
+
+    public:
+        OrderedRange(Range source, Order order, const size_t limit = std::numeric_limits<size_t>::max())
+                : m_source(std::move(source)), m_order(std::move(order)), m_limit(limit)
+        {
+        }
+
+        template<typename KeySelector>
+        OrderedRange<Range, ThenOrderKey<Order, KeySelector>> then_by(KeySelector keySelector, const bool descending) const
+        {
+            return OrderedRange<Range, ThenOrderKey<Order, KeySelector>>(
+                    m_source, ThenOrderKey<Order, KeySelector>(m_order, OrderKey<KeySelector>(std::move(keySelector), descending)),
+                    m_limit);
+        }
+
+        // Check whether the range keeps only the first items of the order.
+        [[nodiscard]] bool is_limited() const noexcept
+        {
+            return m_limit != std::numeric_limits<size_t>::max();
+        }
+
+        // Keep only first count items of the order.
+        [[nodiscard]] OrderedRange limit(const size_t count) const
+        {
+            return OrderedRange(m_source, m_order, std::min(m_limit, count));
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            if (m_limit != std::numeric_limits<size_t>::max())
+            {
+                return Cursor(select_top());
+            }
+            return Cursor(sort_all());
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return std::min(m_source.size(), m_limit);
+        }
+    };
+
+    template<typename Range>
+    constexpr bool is_ordered_range_v = false;
+
+    template<typename Range, typename Order>
+    constexpr bool is_ordered_range_v<OrderedRange<Range, Order>> = true;
+}
@@ -0,0 +1,470 @@
+#pragma once
+
+#include "enumerable.h"
+#include <azgra/utilities/parallel.h>
+#include <atomic>
+#include <mutex>
+
+namespace azgra::collection
+{
+    /**
+     * Number of chunks per pool thread. Filtering queries produce uneven chunks, more chunks than threads
+     * balance the load, because the pool hands out the chunks dynamically.
+     */
+    constexpr size_t ParallelEnumerableChunksPerThread = 4;
+
+    /**
+     * Query evaluated in parallel by the library thread pool. The splittable range is divided into chunks,
+     * every chunk is evaluated by its own cursor into the partial result and partial results are merged
+     * on the calling thread. Small queries, below the parallel threshold, run sequentially.
+     *
+     * Ordered query (default) keeps the source order of the items in to_vector() and distinct().
+     * Unordered query merges every partial result into the final result as soon as its chunk finishes,
+     * so the merging overlaps with the chunks still running, instead of the ordered pass after all of them.
+     * The query still returns only after all chunks finished.
+     *
+     * Exception thrown by the user function in any chunk is rethrown on the calling thread.
+     * @tparam T Type of the items.
+     * @tparam Range Splittable lazy range producing the items.
+     */
+    template<typename T, typename Range>
+    class ParallelEnumerable
+    {
+        static_assert(Range::IsSplittable, "Parallel query requires range, which can be split into chunks.");
+
+    private:
+        Range m_range;
+        bool m_ordered = true;
+
+        template<typename NewRange>
+        ParallelEnumerable<typename NewRange::ValueType, NewRange> with_range(NewRange range) const
+        {
+            return ParallelEnumerable<typename NewRange::ValueType, NewRange>(std::move(range), m_ordered);
+        }
+
+        [[nodiscard]] size_t chunk_count() const
+        {
+            const size_t count = m_range.split_size();
+            const size_t threadCount = ThreadPool::global().thread_count();
+            if (threadCount <= 1 || count < 2 || count < get_parallel_threshold())
+            {
+                return 1;
+            }
+            return std::min(count, threadCount * ParallelEnumerableChunksPerThread);
+        }
+
+        // Call fn(chunk, cursor) for every chunk of the range.
+        template<typename ChunkFunction>
+        void run_chunks(const size_t chunkCount, ChunkFunction fn) const
+        {
+            const size_t count = m_range.split_size();
+            if (chunkCount == 1)
+            {
+                auto cursor = m_range.cursor(0, count);
+                fn(static_cast<size_t>(0), cursor);
+                return;
+            }
+            ThreadPool::global().run(chunkCount, [&](const size_t chunk)
+            {
+                auto cursor = m_range.cursor((count * chunk) / chunkCount, (count * (chunk + 1)) / chunkCount);
+                fn(chunk, cursor);
+            });
+        }
+
+        // Reduce every chunk by fn(cursor) and combine the partial results in chunk order.
+        template<typename R, typename ChunkFunction, typename CombineFunction>
+        R reduce(const R &identity, ChunkFunction fn, CombineFunction combine) const
+        {
+            const size_t chunkCount = chunk_count();
+            std::vector<R> partials(chunkCount, identity);
+            run_chunks(chunkCount, [&](const size_t chunk, auto &cursor)
+            {
+                partials[chunk] = fn(cursor);
+            });
+            R result = std::move(partials[0]);
+            for (size_t i = 1; i < chunkCount; ++i)
+            {
+                result = combine(std::move(result), std::move(partials[i]));
+            }
+            return result;
+        }
+
+        template<typename Predicate>
+        bool any_satisfies(const Predicate &predicate) const
+        {
+            std::atomic<bool> found{false};
+            run_chunks(chunk_count(), [&](size_t, auto &cursor)
+            {
+                while (!found.load(std::memory_order_relaxed) && cursor.move_next())
+                {
+                    if (predicate(cursor.current()))
+                    {
+                        found.store(true, std::memory_order_relaxed);
+                    }
+                }
+            });
+            return found.load();
+        }
+
+    public:
+        using ValueType = T;
+        using RangeType = Range;
+
+        /**
+         * Create parallel query over the range.
+         * @param range Splittable range.
+         * @param ordered True if the source order of the items should be preserved.
+         */
+        explicit ParallelEnumerable(Range range, const bool ordered = true) : m_range(std::move(range)), m_ordered(ordered)
+        {
+        }
+
+        /**
+         * Get the same query, which preserves the source order.
+         */
+        ParallelEnumerable as_ordered() const
+        {
+            return ParallelEnumerable(m_range, true);
+        }
+
+        /**
+         * Get the same query, which may produce the items in any order.
+         */
+        ParallelEnumerable as_unordered() const
+        {
+            return ParallelEnumerable(m_range, false);
+        }
+
+        [[nodiscard]] bool is_ordered() const noexcept
+        {
+            return m_ordered;
+        }
+
+        /**
+         * Continue the query sequentially.
+         * @return Sequential query over the same range.
+         */
+        Enumerable<T, Range> as_sequential() const
+        {
+            return Enumerable<T, Range>(m_range);
+        }
+
+        template<typename Predicate>
+        ParallelEnumerable<T, WhereRange<Range, Predicate>> where(const Predicate &predicate) const
+        {
+            return with_range(WhereRange<Range, Predicate>(m_range, predicate));
+        }
+
+        template<typename SelectorFunction, typename SelectType = std::decay_t<typename std::result_of<SelectorFunction &(T)>::type>>
+        ParallelEnumerable<SelectType, SelectRange<Range, SelectorFunction>> select(SelectorFunction selector) const
+        {
+            return with_range(SelectRange<Range, SelectorFunction>(m_range, std::move(selector)));
+        }
+
+        std::vector<T> to_vector() const
+        {
+            const size_t chunkCount = chunk_count();
+            if constexpr (Range::HasKnownSize && std::is_default_constructible<T>::value)
+            {
+                // Every source item produces one item, chunks write directly to their positions.
+                std::vector<T> result(m_range.size());
+                const size_t count = m_range.split_size();
+                run_chunks(chunkCount, [&](const size_t chunk, auto &cursor)
+                {
+                    size_t index = (count * chunk) / chunkCount;
+                    while (cursor.move_next())
+                    {
+                        result[index++] = cursor.current();
+                    }
+                });
+                return result;
+            }
+            else if (!m_ordered)
+            {
+                std::vector<T> result;
+                std::mutex resultMutex;
+                run_chunks(chunkCount, [&](size_t, auto &cursor)
+                {
+                    std::vector<T> partial;
+                    while (cursor.move_next())
+                    {
+                        partial.push_back(cursor.current());
+                    }
+                    std::lock_guard<std::mutex> lock(resultMutex);
+                    if (result.empty())
+                    {
+                        result = std::move(partial);
+                    }
+                    else
+                    {
+                        result.insert(result.end(), std::make_move_iterator(partial.begin()),
+                                      std::make_move_iterator(partial.end()));
+                    }
+                });
+                return result;
+            }
+            else
+            {
+                std::vector<std::vector<T>> partials(chunkCount);
+                run_chunks(chunkCount, [&](const size_t chunk, auto &cursor)
+                {
+                    while (cursor.move_next())
+                    {
+                        partials[chunk].push_back(cursor.current());
+                    }
+                });
+                size_t totalSize = 0;
+                for (const std::vector<T> &partial : partials)
+                {
+                    totalSize += partial.size();
+                }
+                std::vector<T> result;
+                result.reserve(totalSize);
+                for (std::vector<T> &partial : partials)
+                {
+                    result.insert(result.end(), std::make_move_iterator(partial.begin()),
+                                  std::make_move_iterator(partial.end()));
+                }
+                return result;
+            }
+        }
+
+        [[nodiscard]] size_t count() const
+        {
+            if constexpr (Range::HasKnownSize)
+            {
+                return m_range.size();
+            }
+            else
+            {
+                return count([](const T &)
+                             { return true; });
+            }
+        }
+
+        template<typename Predicate>
+        size_t count(const Predicate &predicate) const
+        {
+            return reduce(static_cast<size_t>(0), [&predicate](auto &cursor)
+                          {
+                              size_t partial = 0;
+                              while (cursor.move_next())
+                              {
+                                  if (predicate(cursor.current()))
+                                  {
+                                      ++partial;
+                                  }
+                              }
+                              return partial;
+                          },
+                          [](const size_t a, const size_t b)
+                          { return a + b; });
+        }
+
+        auto sum() const
+        {
+            return reduce(0.0, [](auto &cursor)
+                          {
+                              double partial = 0.0;
+                              while (cursor.move_next())
+                              {
+                                  partial += cursor.current();
+                              }
+                              return partial;
+                          },
+                          [](const double a, const double b)
+                          { return a + b; });
+        }
+
+        template<typename SelectorFunction, typename SelectType = typename std::result_of<SelectorFunction &(T)>::type>
+        auto sum(SelectorFunction selector) const
+        {
+            using SumType = std::decay_t<SelectType>;
+            static_assert(std::is_arithmetic<SumType>::value, "T must be numeric type");
+            return reduce(SumType{}, [&selector](auto &cursor)
+                          {
+                              SumType partial{};
+                              while (cursor.move_next())
+                              {
+                                  partial += selector(cursor.current());
+                              }
+                              return partial;
+                          },
+                          [](const SumType a, const SumType b)
+                          { return a + b; });
+        }
+
+        double average() const
+        {
+            static_assert(std::is_arithmetic_v<T>, "T must be numeric type");
+            using Partial = std::pair<double, size_t>;
+            const Partial total = reduce(Partial(0.0, 0), [](auto &cursor)
+                                         {
+                                             Partial partial(0.0, 0);
+                                             while (cursor.move_next())
+                                             {
+                                                 partial.first += cursor.current();
+                                                 ++partial.second;
+                                             }
+                                             return partial;
+                                         },
+                                         [](const Partial &a, const Partial &b)
+                                         { return Partial(a.first + b.first, a.second + b.second); });
+            return total.first / static_cast<double>(total.second);
+        }
+
+        std::pair<T, T> min_max() const noexcept(false)
+        {
+            using Partial = std::optional<std::pair<T, T>>;
+            const Partial result = reduce(Partial(), [](auto &cursor)
+                                          {
+                                              Partial partial;
+                                              if (!cursor.move_next())
+                                              {
+                                                  return partial;
+                                              }
+                                              partial.emplace(cursor.current(), cursor.current());
+                                              while (cursor.move_next())
+                                              {
+                                                  const auto &item = cursor.current();
+                                                  if (item < partial->first)
+                                                  {
+                                                      partial->first = item;
+                                                  }
+                                                  if (partial->second < item)
+                                                  {
+                                                      partial->second = item;
+                                                  }
+                                              }
+                                              return partial;
+                                          },
+                                          [](Partial a, Partial b)
+                                          {
+                                              if (!a.has_value())
+                                              {
+                                                  return b;
+                                              }
+                                              if (b.has_value())
+                                              {
+                                                  a->first = std::min(a->first, b->first);
+                                                  a->second = std::max(a->second, b->second);
+                                              }
+                                              return a;
+                                          });
+            if (!result.has_value())
+            {
+                throw EnumerableError("Enumerable is empty.");
+            }
+            return *result;
+        }
+
+        T min() const noexcept(false)
+        {
+            return min_max().first;
+        }
+
+        T max() const noexcept(false)
+        {
+            return min_max().second;
+        }
+
+        bool any() const
+        {
+            return count() > 0;
+        }
+
+        /**
+         * Check whether any item satisfies the predicate. Chunks stop as soon as any of them finds the item.
+         */
+        template<typename Predicate>
+        bool any(const Predicate &predicate) const
+        {
+            return any_satisfies(predicate);
+        }
+
+        /**
+         * Check whether all items satisfy the predicate. Chunks stop as soon as any of them finds a counterexample.
+         */
+        template<typename Predicate>
+        bool all(const Predicate &predicate) const
+        {
+            return !any_satisfies([&predicate](const auto &item)
+                                  { return !predicate(item); });
+        }
+
+        /**
+         * Get distinct items, every chunk removes its duplicates locally, before the chunks are merged.
+         * Ordered query keeps the first occurrence order, unordered query merges the chunks as they finish.
+         * @return Enumerable of distinct items.
+         */
+        Enumerable<T> distinct() const
+        {
+            const size_t chunkCount = chunk_count();
+            if (!m_ordered && chunkCount > 1)
+            {
+                std::vector<T> result;
+                robin_hood::unordered_set<T> seen;
+                std::mutex resultMutex;
+                run_chunks(chunkCount, [&](size_t, auto &cursor)
+                {
+                    std::vector<T> partial;
+                    robin_hood::unordered_set<T> chunkSeen;
+                    while (cursor.move_next())
+                    {
+                        if (chunkSeen.insert(cursor.current()).second)
+                        {
+                            partial.push_back(cursor.current());
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock(resultMutex);
+                    if (seen.empty())
+                    {
+                        // First finished chunk is unique already and it is taken without lookups.
+                        seen = std::move(chunkSeen);
+                        result = std::move(partial);
+                        return;
+                    }
+                    for (T &item : partial)
+                    {
+                        if (seen.insert(item).second)
+                        {
+                            result.push_back(std::move(item));
+                        }
+                    }
+                });
+                return Enumerable<T>(std::move(result));
+            }
+
+            std::vector<std::vector<T>> partials(chunkCount);
+            run_chunks(chunkCount, [&](const size_t chunk, auto &cursor)
+            {
+                robin_hood::unordered_set<T> seen;
+                while (cursor.move_next())
+                {
+                    if (seen.insert(cursor.current()).second)
+                    {
+                        partials[chunk].push_back(cursor.current());
+                    }
+                }
+            });
+
+            if (chunkCount == 1)
+            {
+                return Enumerable<T>(std::move(partials[0]));
+            }
+            std::vector<T> result;
+            robin_hood::unordered_set<T> seen;
+            for (std::vector<T> &partial : partials)
+            {
+                for (T &item : partial)
+                {
+                    if (seen.insert(item).second)
+                    {
+                        result.push_back(std::move(item));
+                    }
+                }
+            }
+            return Enumerable<T>(std::move(result));
+        }
+    };
+}
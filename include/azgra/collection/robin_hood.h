@@ -47,7 +47,8 @@
 #include <string>
 #include <type_traits>
 #include <utility>
-#include <azgra/azgra_types.h>
+#include <limits>
+#include <azgra/azgra.h>
 
 // #define ROBIN_HOOD_LOG_ENABLED
 #ifdef ROBIN_HOOD_LOG_ENABLED
@@ -1,15 +1,365 @@
 #pragma once
 
 #include <azgra/azgra.h>
+#include <azgra/collection/enumerable.h>
 #include <azgra/collection/vector_utilities.h>
+#include <azgra/utilities/parallel.h>
+#include <memory>
+#include <numeric>
 #include <set>
 
 namespace azgra::collection
 {
+    /**
+     * Maximal pool size of the power set, subsets are indexed by 64 bit masks.
+     */
+    constexpr size_t PowerSetMaxPoolSize = 63;
+
+    /**
+     * Get the binary reflected Gray code of the index. Codes of the consecutive indices differ in exactly one bit,
+     * which is the lowest set bit of the greater index.
+     * @param index Index of the code.
+     * @return Gray code.
+     */
+    inline u64 gray_code(const u64 index)
+    {
+        return index ^ (index >> 1);
+    }
+
+    /**
+     * Get the number of k-combinations of n items.
+     * @param n Number of items.
+     * @param k Size of the combination.
+     * @return Binomial coefficient n over k, zero when k is greater than n. Result must fit into u64.
+     */
+    inline u64 binomial_coefficient(const size_t n, size_t k)
+    {
+        if (k > n)
+        {
+            return 0;
+        }
+        k = std::min(k, n - k);
+        u64 result = 1;
+        for (size_t i = 0; i < k; ++i)
+        {
+            // result * (n - i) is divisible by (i + 1), the common divisor is cancelled before the multiplication,
+            // so that the intermediate value never exceeds the next coefficient n over (i + 1).
+            const u64 divisor = i + 1;
+            const u64 common = std::gcd(result, divisor);
+            result = (result / common) * ((n - i) / (divisor / common));
+        }
+        return result;
+    }
+
+    /**
+     * Lexicographic k-combinations of the pool items. Cursor yields the view into its own buffer, which is reused
+     * by every step, only the suffix of the changed indices is rewritten. Enumeration allocates only in the first step.
+     */
+    template<typename T>
+    class CombinationRange : public RangeBase<CombinationRange<T>>
+    {
+    private:
+        std::shared_ptr<const std::vector<T>> m_pool;
+        size_t m_size;
+
+    public:
+        using ValueType = std::vector<T>;
+        static constexpr bool HasKnownSize = true;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        public:
+            using ValueType = std::vector<T>;
+
+        private:
+            std::shared_ptr<const std::vector<T>> m_pool;
+            size_t m_size;
+            bool m_started = false;
+            std::vector<size_t> m_indices;
+            std::vector<T> m_combination;
+
+        public:
+            Cursor(std::shared_ptr<const std::vector<T>> pool, const size_t size) : m_pool(std::move(pool)), m_size(size)
+            {
+            }
+
+            bool move_next()
+            {
+                const std::vector<T> &pool = *m_pool;
+                const size_t n = pool.size();
+                if (!m_started)
+                {
+                    m_started = true;
+                    if (m_size > n)
+                    {
+                        return false;
+                    }
+                    m_indices = range(m_size);
+                    m_combination.assign(pool.begin(), pool.begin() + m_size);
+                    return true;
+                }
+
+                // Find the last index, which isn't at its final position.
+                size_t i = m_size;
+                while (i > 0 && m_indices[i - 1] == (i - 1) + n - m_size)
+                {
+                    --i;
+                }
+                if (i == 0)
+                {
+                    return false;
+                }
+                --i;
+                ++m_indices[i];
+                m_combination[i] = pool[m_indices[i]];
+                for (size_t j = i + 1; j < m_size; ++j)
+                {
+                    m_indices[j] = m_indices[j - 1] + 1;
+                    m_combination[j] = pool[m_indices[j]];
+                }
+                return true;
+            }
+
+            /**
+             * Get the current combination. Reference is valid only until the next move_next().
+             */
+            const std::vector<T> &current() const
+            {
+                return m_combination;
+            }
+
+            /**
+             * Get the pool indices of the current combination, in ascending order.
+             */
+            const std::vector<size_t> &indices() const
+            {
+                return m_indices;
+            }
+        };
+
+        CombinationRange(std::vector<T> pool, const size_t size)
+                : m_pool(std::make_shared<const std::vector<T>>(std::move(pool))), m_size(size)
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_pool, m_size);
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return static_cast<size_t>(binomial_coefficient(m_pool->size(), m_size));
+        }
+    };
+
+    /**
+     * All subsets of the pool in the Gray code order, i-th subset contains the pool items of set bits of gray_code(i).
+     * Consecutive subsets differ by one item, so the cursor updates its reused buffer by a single insertion or removal.
+     * Items of the subset keep the pool order. Range is split by the subset indices for parallel evaluation.
+     */
+    template<typename T>
+    class PowerSetRange : public RangeBase<PowerSetRange<T>>
+    {
+    private:
+        std::shared_ptr<const std::vector<T>> m_pool;
+
+    public:
+        using ValueType = std::vector<T>;
+        static constexpr bool HasKnownSize = true;
+        static constexpr bool IsSplittable = true;
+
+        class Cursor
+        {
+        public:
+            using ValueType = std::vector<T>;
+
+        private:
+            std::shared_ptr<const std::vector<T>> m_pool;
+            u64 m_from;
+            u64 m_next;
+            u64 m_to;
+            u64 m_mask = 0;
+            std::vector<T> m_subset;
+
+            void toggle(const size_t bit)
+            {
+                const u64 bitMask = static_cast<u64>(1) << bit;
+                const auto position = m_subset.begin() + __builtin_popcountll(m_mask & (bitMask - 1));
+                if (m_mask & bitMask)
+                {
+                    m_subset.erase(position);
+                }
+                else
+                {
+                    m_subset.insert(position, (*m_pool)[bit]);
+                }
+                m_mask ^= bitMask;
+            }
+
+        public:
+            Cursor(std::shared_ptr<const std::vector<T>> pool, const u64 from, const u64 to)
+                    : m_pool(std::move(pool)), m_from(from), m_next(from), m_to(to)
+            {
+            }
+
+            bool move_next()
+            {
+                if (m_next >= m_to)
+                {
+                    return false;
+                }
+                if (m_next == m_from)
+                {
+                    // Capacity of the whole pool, later insertions don't allocate.
+                    m_subset.reserve(m_pool->size());
+                    m_mask = gray_code(m_next);
+                    for (size_t bit = 0; bit < m_pool->size(); ++bit)
+                    {
+                        if (m_mask & (static_cast<u64>(1) << bit))
+                        {
+                            m_subset.push_back((*m_pool)[bit]);
+                        }
+                    }
+                }
+                else
+                {
+                    toggle(static_cast<size_t>(__builtin_ctzll(m_next)));
+                }
+                ++m_next;
+                return true;
+            }
+
+            /**
+             * Get the current subset. Reference is valid only until the next move_next().
+             */
+            const std::vector<T> &current() const
+            {
+                return m_subset;
+            }
+
+            /**
+             * Get the mask of the current subset, bit i is set when the subset contains i-th pool item.
+             */
+            [[nodiscard]] u64 mask() const
+            {
+                return m_mask;
+            }
+        };
+
+        explicit PowerSetRange(std::vector<T> pool) : m_pool(std::make_shared<const std::vector<T>>(std::move(pool)))
+        {
+            always_assert(m_pool->size() <= PowerSetMaxPoolSize);
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_pool, 0, split_size());
+        }
+
+        [[nodiscard]] Cursor cursor(const size_t from, const size_t to) const
+        {
+            return Cursor(m_pool, from, to);
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return split_size();
+        }
+
+        [[nodiscard]] size_t split_size() const
+        {
+            return static_cast<size_t>(1) << m_pool->size();
+        }
+    };
+
+    /**
+     * Create lazy Enumerable of the k-combinations of the pool in the lexicographic order.
+     * @param pool Items to choose from.
+     * @param size Size of the combinations.
+     * @return Enumerable of the combinations.
+     */
+    template<typename T>
+    Enumerable<std::vector<T>, CombinationRange<T>> enumerate_combinations(std::vector<T> pool, const size_t size)
+    {
+        return Enumerable<std::vector<T>, CombinationRange<T>>(CombinationRange<T>(std::move(pool), size));
+    }
+
+    /**
+     * Create lazy Enumerable of all subsets of the pool in the Gray code order.
+     * @param pool Items of the set, at most PowerSetMaxPoolSize.
+     * @return Enumerable of the subsets.
+     */
+    template<typename T>
+    Enumerable<std::vector<T>, PowerSetRange<T>> enumerate_power_set(std::vector<T> pool)
+    {
+        return Enumerable<std::vector<T>, PowerSetRange<T>>(PowerSetRange<T>(std::move(pool)));
+    }
+
+    /**
+     * Call fn(combination) for every k-combination of the pool, in the lexicographic order.
+     * Combination is the view into the reused buffer, valid only during the call.
+     * @param pool Items to choose from.
+     * @param size Size of the combinations.
+     * @param fn Function receiving const std::vector<T> &.
+     */
+    template<typename T, typename Function>
+    void for_each_combination(const std::vector<T> &pool, const size_t size, Function fn)
+    {
+        auto cursor = CombinationRange<T>(pool, size).cursor();
+        while (cursor.move_next())
+        {
+            fn(cursor.current());
+        }
+    }
+
+    /**
+     * Call fn(mask) for every subset mask of the n items, in the Gray code order. Parallel policy splits
+     * the subset indices into chunks evaluated by the thread pool, fn must be then thread safe.
+     * @param n Number of items, at most PowerSetMaxPoolSize.
+     * @param fn Function receiving u64 mask of the subset.
+     * @param policy Execution policy.
+     */
+    template<typename Function>
+    void for_each_subset_mask(const size_t n, Function fn, const ExecutionPolicy policy = ExecutionPolicy_Sequential)
+    {
+        always_assert(n <= PowerSetMaxPoolSize);
+        parallel_for<u64>(static_cast<size_t>(1) << n, policy, [&fn](const size_t from, const size_t to)
+        {
+            for (u64 index = from; index < to; ++index)
+            {
+                fn(gray_code(index));
+            }
+        });
+    }
+
+    /**
+     * Call fn(subset, mask) for every subset of the pool, in the Gray code order. Subset is the view into the buffer
+     * reused by the chunk, valid only during the call. Parallel policy splits the subset indices into chunks evaluated
+     * by the thread pool, fn must be then thread safe. Intended for exhaustive search over all subsets.
+     * @param pool Items of the set, at most PowerSetMaxPoolSize.
+     * @param fn Function receiving const std::vector<T> & subset and u64 mask.
+     * @param policy Execution policy.
+     */
+    template<typename T, typename Function>
+    void for_each_subset(const std::vector<T> &pool, Function fn, const ExecutionPolicy policy = ExecutionPolicy_Sequential)
+    {
+        const PowerSetRange<T> powerSet(pool);
+        parallel_for<u64>(powerSet.split_size(), policy, [&](const size_t from, const size_t to)
+        {
+            auto cursor = powerSet.cursor(from, to);
+            while (cursor.move_next())
+            {
+                fn(cursor.current(), cursor.mask());
+            }
+        });
+    }
+
     template<typename T>
     static void power_set_internal(std::vector<std::vector<T>> &powerset,
                                    const std::vector<T> &originalSet,
-                                   std::vector<T> currentSubset,
+                                   std::vector<T> &currentSubset,
                                    int currentIndex = -1)
     {
         int n = originalSet.size();
@@ -22,7 +372,7 @@ namespace azgra::collection
         {
             currentSubset.push_back(originalSet[i]);
             power_set_internal(powerset, originalSet, currentSubset, i);
-            currentSubset.erase(currentSubset.end() - 1);
+            currentSubset.pop_back();
         }
     }
 
@@ -30,11 +380,15 @@ namespace azgra::collection
     template<typename T>
     std::vector<std::vector<T>> generate_powerset(const std::vector<T> &set)
     {
+        always_assert(set.size() <= PowerSetMaxPoolSize);
+        const size_t finalExpectedSize = static_cast<size_t>(1) << set.size();
+
         std::vector<std::vector<T>> powerset;
+        powerset.reserve(finalExpectedSize);
         std::vector<T> tmp;
+        tmp.reserve(set.size());
         power_set_internal(powerset, set, tmp);
 
-        auto finalExpectedSize = (size_t) pow(2, set.size());
         always_assert(powerset.size() == finalExpectedSize);
 
         return powerset;
@@ -43,59 +397,15 @@ namespace azgra::collection
     template<typename T>
     std::vector<std::vector<T>> generate_subsets_of_size(const std::vector<T> &pool, const size_t requestedSubsetSize)
     {
-        std::vector<std::vector<T>> subsets;
-
-        // pool = set
-        size_t n = pool.size();
-
-        assert(requestedSubsetSize <= n);
-        if (requestedSubsetSize > n)
-            return subsets;
-
-        std::vector<size_t> indices = range(requestedSubsetSize);
+        assert(requestedSubsetSize <= pool.size());
 
+        std::vector<std::vector<T>> subsets;
+        subsets.reserve(static_cast<size_t>(binomial_coefficient(pool.size(), requestedSubsetSize)));
+        for_each_combination(pool, requestedSubsetSize, [&subsets](const std::vector<T> &subset)
         {
-            std::vector<T> subset(requestedSubsetSize);
-            for (const size_t i : indices)
-                subset[i] = pool[i];
-
             subsets.push_back(subset);
-        }
-
-        while (true)
-        {
-            bool breakLoopExit = false;
-            int i = requestedSubsetSize - 1;
-            for (i = requestedSubsetSize - 1; i >= 0; --i)
-            {
-                if (indices[i] != (i + n - requestedSubsetSize))
-                {
-                    breakLoopExit = true;
-                    break;
-                }
-            }
-            if (!breakLoopExit)
-            {
-                return subsets;
-            }
-            else
-            {
-                indices[i] += 1;
-                for (size_t j = i + 1; j < requestedSubsetSize; ++j)
-                {
-                    indices[j] = indices[j - 1] + 1;
-                }
-
-                {
-                    std::vector<T> subset(requestedSubsetSize);
-                    for (size_t index = 0; index < indices.size(); ++index)
-                    {
-                        subset[index] = pool[indices[index]];
-                    }
-                    subsets.push_back(subset);
-                }
-            }
-        }
+        });
+        return subsets;
     }
 
     template<typename T>
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <type_traits>
+#include <utility>
+
+namespace azgra::collection
+{
+    /**
+     * Summation algorithm for floating point values.
+     */
+    enum SummationMode
+    {
+        // Independent vector accumulators. Fastest, rounding error grows linearly with the count.
+        SummationMode_Fast,
+        // Vectorized blocks summed pairwise. Rounding error grows logarithmically with the count.
+        SummationMode_Pairwise,
+        // Kahan compensated summation in every vector lane. Rounding error doesn't depend on the count.
+        SummationMode_Kahan
+    };
+
+    /**
+     * True if the type has vectorized reduction kernels.
+     */
+    template<typename T>
+    constexpr bool has_simd_reduction_v = std::is_same_v<T, f32> || std::is_same_v<T, f64> ||
+                                          std::is_same_v<T, i32> || std::is_same_v<T, i64>;
+
+    /**
+     * Get the name of the reduction kernels selected for the running CPU, avx2, sse4.2 or generic.
+     */
+    const char *simd_reduction_kernel_name();
+
+    /**
+     * Sum the continuous floating point values. Result differs from the sequential sum by the rounding,
+     * because the vector lanes are summed separately. sum(begin, end, initialValue) therefore keeps
+     * the sequential summation for floats and this sum is used only by sum(begin, end, SummationMode).
+     * @param data Pointer to the first value.
+     * @param count Number of values.
+     * @param mode Summation algorithm.
+     * @return Sum of the values.
+     */
+    f32 simd_sum(const f32 *data, size_t count, SummationMode mode = SummationMode_Fast);
+
+    f64 simd_sum(const f64 *data, size_t count, SummationMode mode = SummationMode_Fast);
+
+    /**
+     * Sum the continuous integer values, overflow wraps around.
+     */
+    i32 simd_sum(const i32 *data, size_t count);
+
+    i64 simd_sum(const i64 *data, size_t count);
+
+    /**
+     * Find the minimum and the maximum of the continuous values. NaN values aren't supported and the sign
+     * of the zero minimum or maximum is unspecified, so min and max from enumerable_functions.h use it
+     * only for integers.
+     * @param data Pointer to the first value.
+     * @param count Number of values, must be greater than zero.
+     * @return Pair of the minimum and the maximum.
+     */
+    std::pair<f32, f32> simd_min_max(const f32 *data, size_t count);
+
+    std::pair<f64, f64> simd_min_max(const f64 *data, size_t count);
+
+    std::pair<i32, i32> simd_min_max(const i32 *data, size_t count);
+
+    std::pair<i64, i64> simd_min_max(const i64 *data, size_t count);
+
+    /**
+     * Count the values equal to the value.
+     */
+    size_t simd_count(const f32 *data, size_t count, f32 value);
+
+    size_t simd_count(const f64 *data, size_t count, f64 value);
+
+    size_t simd_count(const i32 *data, size_t count, i32 value);
+
+    size_t simd_count(const i64 *data, size_t count, i64 value);
+
+    /**
+     * Check whether any of the values is equal to the value. Search stops at the first found vector.
+     */
+    bool simd_contains(const f32 *data, size_t count, f32 value);
+
+    bool simd_contains(const f64 *data, size_t count, f64 value);
+
+    bool simd_contains(const i32 *data, size_t count, i32 value);
+
+    bool simd_contains(const i64 *data, size_t count, i64 value);
+}
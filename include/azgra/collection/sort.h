@@ -0,0 +1,344 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <azgra/utilities/parallel.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace azgra::collection
+{
+    /**
+     * Minimal number of keys, for which the radix sort is faster than the comparison sort.
+     */
+    constexpr size_t RadixSortThreshold = 1024;
+
+    /**
+     * True if the key can be sorted by the radix sort, i.e. it can be mapped to the unsigned integer with the same order.
+     */
+    template<typename Key>
+    constexpr bool is_radix_sortable_v = (std::is_integral_v<Key> && !std::is_same_v<Key, bool>) ||
+                                         (std::is_floating_point_v<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8));
+
+    /**
+     * Less than comparison of the sort keys, used by all sorts of the library. Floating point -0.0 is equal to +0.0
+     * and NaN is greater than all numbers and equal to other NaNs, so that the keys are strictly weakly ordered.
+     * @param a First key.
+     * @param b Second key.
+     * @return True if a goes before b in the ascending order.
+     */
+    template<typename Key>
+    bool sort_key_less(const Key &a, const Key &b)
+    {
+        if constexpr (std::is_floating_point_v<Key>)
+        {
+            if (std::isnan(a))
+            {
+                return false;
+            }
+            if (std::isnan(b))
+            {
+                return true;
+            }
+        }
+        return a < b;
+    }
+
+    /**
+     * Map the key to the unsigned integer, whose ascending order is the order of sort_key_less().
+     * Sign bit of signed integers is flipped. Negative floats have all bits flipped, positive floats only the sign bit.
+     * Float -0.0 is mapped as +0.0 and all NaNs as the positive quiet NaN, so radix_key_inverse() doesn't restore them.
+     * @param key Integer or floating point key.
+     * @return Unsigned integer of the same size as the key.
+     */
+    template<typename Key>
+    auto radix_key(const Key key)
+    {
+        static_assert(is_radix_sortable_v<Key>, "Key must be integer or float type.");
+        if constexpr (std::is_floating_point_v<Key>)
+        {
+            using Bits = std::conditional_t<sizeof(Key) == 4, u32, u64>;
+            constexpr Bits signBit = static_cast<Bits>(1) << (8 * sizeof(Bits) - 1);
+            Key canonicalKey = key;
+            if (key == static_cast<Key>(0))
+            {
+                canonicalKey = static_cast<Key>(0);
+            }
+            else if (std::isnan(key))
+            {
+                canonicalKey = std::copysign(std::numeric_limits<Key>::quiet_NaN(), static_cast<Key>(1));
+            }
+            Bits bits;
+            std::memcpy(&bits, &canonicalKey, sizeof(Key));
+            return static_cast<Bits>((bits & signBit) ? ~bits : (bits | signBit));
+        }
+        else
+        {
+            using Bits = std::make_unsigned_t<Key>;
+            if constexpr (std::is_signed_v<Key>)
+            {
+                constexpr Bits signBit = static_cast<Bits>(1) << (8 * sizeof(Bits) - 1);
+                return static_cast<Bits>(static_cast<Bits>(key) ^ signBit);
+            }
+            else
+            {
+                return static_cast<Bits>(key);
+            }
+        }
+    }
+
+    /**
+     * Map the unsigned integer produced by radix_key() back to the key.
+     */
+    template<typename Key, typename Bits>
+    Key radix_key_inverse(const Bits bits)
+    {
+        static_assert(is_radix_sortable_v<Key>, "Key must be integer or float type.");
+        constexpr Bits signBit = static_cast<Bits>(1) << (8 * sizeof(Bits) - 1);
+        if constexpr (std::is_floating_point_v<Key>)
+        {
+            const Bits original = static_cast<Bits>((bits & signBit) ? (bits ^ signBit) : ~bits);
+            Key key;
+            std::memcpy(&key, &original, sizeof(Key));
+            return key;
+        }
+        else if constexpr (std::is_signed_v<Key>)
+        {
+            return static_cast<Key>(static_cast<Bits>(bits ^ signBit));
+        }
+        else
+        {
+            return static_cast<Key>(bits);
+        }
+    }
+
+    /**
+     * Stable LSD radix sort of the unsigned bits, by 8 bits in every pass. Passes, in which all keys have the same byte,
+     * are skipped. Payload items, if any, are moved together with their bits. With the parallel policy, every chunk
+     * of the keys is counted and scattered by its own task, chunk offsets in each bucket follow the chunk order,
+     * so the sort stays stable.
+     * @param bits Unsigned keys.
+     * @param payload Items of the same size as bits, or nullptr.
+     * @param policy Execution policy.
+     */
+    template<typename Bits, typename Payload>
+    void radix_sort_bits(std::vector<Bits> &bits, std::vector<Payload> *payload,
+                         const ExecutionPolicy policy = ExecutionPolicy_Sequential)
+    {
+        const size_t count = bits.size();
+        std::vector<Bits> bitsBuffer(count);
+        std::vector<Payload> payloadBuffer(payload ? count : 0);
+
+        const size_t chunkSize = parallel_chunk_size<Bits>(count, policy);
+        const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        std::vector<std::array<size_t, 256>> offsets(chunkCount);
+        const auto for_each_chunk = [&](const auto &fn)
+        {
+            if (chunkCount == 1)
+            {
+                fn(static_cast<size_t>(0), static_cast<size_t>(0), count);
+                return;
+            }
+            ThreadPool::global().run(chunkCount, [&](const size_t chunk)
+            {
+                fn(chunk, chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize));
+            });
+        };
+
+        for (size_t shift = 0; shift < 8 * sizeof(Bits); shift += 8)
+        {
+            for_each_chunk([&](const size_t chunk, const size_t from, const size_t to)
+            {
+                std::array<size_t, 256> &histogram = offsets[chunk];
+                histogram.fill(0);
+                for (size_t i = from; i < to; ++i)
+                {
+                    ++histogram[(bits[i] >> shift) & 0xFF];
+                }
+            });
+            const size_t firstBucket = bits.empty() ? 0 : ((bits[0] >> shift) & 0xFF);
+            size_t firstBucketSize = 0;
+            for (const std::array<size_t, 256> &histogram : offsets)
+            {
+                firstBucketSize += histogram[firstBucket];
+            }
+            if (firstBucketSize == count)
+            {
+                continue;
+            }
+
+            size_t offset = 0;
+            for (size_t bucket = 0; bucket < 256; ++bucket)
+            {
+                for (std::array<size_t, 256> &histogram : offsets)
+                {
+                    const size_t bucketSize = histogram[bucket];
+                    histogram[bucket] = offset;
+                    offset += bucketSize;
+                }
+            }
+            for_each_chunk([&](const size_t chunk, const size_t from, const size_t to)
+            {
+                std::array<size_t, 256> &chunkOffsets = offsets[chunk];
+                if (payload)
+                {
+                    for (size_t i = from; i < to; ++i)
+                    {
+                        const size_t target = chunkOffsets[(bits[i] >> shift) & 0xFF]++;
+                        bitsBuffer[target] = bits[i];
+                        payloadBuffer[target] = std::move((*payload)[i]);
+                    }
+                }
+                else
+                {
+                    for (size_t i = from; i < to; ++i)
+                    {
+                        bitsBuffer[chunkOffsets[(bits[i] >> shift) & 0xFF]++] = bits[i];
+                    }
+                }
+            });
+            if (payload)
+            {
+                payload->swap(payloadBuffer);
+            }
+            bits.swap(bitsBuffer);
+        }
+    }
+
+    /**
+     * Stable LSD radix sort of the keys.
+     * @param keys Integer or floating point keys.
+     * @param descending True for the descending order. Equal keys keep their order in both directions.
+     * @return Permutation, i-th item of the sorted sequence is the item at index result[i].
+     */
+    template<typename Key>
+    std::vector<size_t> radix_sort_indices(const std::vector<Key> &keys, const bool descending = false)
+    {
+        using Bits = decltype(radix_key(Key{}));
+        const Bits directionMask = descending ? static_cast<Bits>(~static_cast<Bits>(0)) : static_cast<Bits>(0);
+        std::vector<Bits> bits(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            bits[i] = static_cast<Bits>(radix_key(keys[i]) ^ directionMask);
+        }
+        std::vector<size_t> indices(keys.size());
+        std::iota(indices.begin(), indices.end(), static_cast<size_t>(0));
+        radix_sort_bits(bits, &indices);
+        return indices;
+    }
+
+    /**
+     * Stable sort of the integer or floating point values in place by the radix sort, in the order of sort_key_less().
+     * @param values Values to be sorted.
+     * @param descending True for the descending order.
+     * @param policy Execution policy.
+     */
+    template<typename Key>
+    void radix_sort(std::vector<Key> &values, const bool descending = false,
+                    const ExecutionPolicy policy = ExecutionPolicy_Sequential)
+    {
+        using Bits = decltype(radix_key(Key{}));
+        const Bits directionMask = descending ? static_cast<Bits>(~static_cast<Bits>(0)) : static_cast<Bits>(0);
+        std::vector<Bits> bits(values.size());
+        parallel_for<Bits>(values.size(), policy, [&](const size_t from, const size_t to)
+        {
+            for (size_t i = from; i < to; ++i)
+            {
+                bits[i] = static_cast<Bits>(radix_key(values[i]) ^ directionMask);
+            }
+        });
+        if constexpr (std::is_floating_point_v<Key>)
+        {
+            // Keys of -0.0 and NaNs are canonical, the original values are moved with them.
+            radix_sort_bits(bits, &values, policy);
+        }
+        else
+        {
+            radix_sort_bits(bits, static_cast<std::vector<Bits> *>(nullptr), policy);
+            parallel_for<Key>(values.size(), policy, [&](const size_t from, const size_t to)
+            {
+                for (size_t i = from; i < to; ++i)
+                {
+                    values[i] = radix_key_inverse<Key>(static_cast<Bits>(bits[i] ^ directionMask));
+                }
+            });
+        }
+    }
+
+    /**
+     * Stable merge sort. Chunks of the range are sorted by the thread pool and then merged pairwise,
+     * all merges of one round run in parallel.
+     * @param begin Begin of the random access range.
+     * @param end End of the random access range.
+     * @param compare Less than comparison.
+     * @param policy Execution policy.
+     */
+    template<typename It, typename Compare>
+    void parallel_stable_sort(const It begin, const It end, Compare compare,
+                              const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        using T = typename std::iterator_traits<It>::value_type;
+        const size_t count = static_cast<size_t>(std::distance(begin, end));
+        if constexpr (std::is_default_constructible_v<T>)
+        {
+            const size_t threadCount = ThreadPool::global().thread_count();
+            if (policy == ExecutionPolicy_Parallel && threadCount > 1 && count >= 2 && count >= get_parallel_threshold())
+            {
+                // Power of two chunks, so that every merge round halves their count.
+                size_t chunkCount = 1;
+                while (chunkCount < threadCount)
+                {
+                    chunkCount *= 2;
+                }
+                const auto bound = [count, chunkCount](const size_t chunk)
+                {
+                    return static_cast<std::ptrdiff_t>((count * chunk) / chunkCount);
+                };
+
+                ThreadPool::global().run(chunkCount, [&](const size_t chunk)
+                {
+                    std::stable_sort(begin + bound(chunk), begin + bound(chunk + 1), compare);
+                });
+
+                std::vector<T> buffer(count);
+                bool sortedInBuffer = false;
+                for (size_t width = 1; width < chunkCount; width *= 2)
+                {
+                    const auto mergeRound = [&](const auto src, const auto dst)
+                    {
+                        ThreadPool::global().run(chunkCount / (2 * width), [&](const size_t merge)
+                        {
+                            const auto from = bound(2 * width * merge);
+                            const auto middle = bound(2 * width * merge + width);
+                            const auto to = bound(2 * width * (merge + 1));
+                            std::merge(std::make_move_iterator(src + from), std::make_move_iterator(src + middle),
+                                       std::make_move_iterator(src + middle), std::make_move_iterator(src + to),
+                                       dst + from, compare);
+                        });
+                    };
+                    if (sortedInBuffer)
+                    {
+                        mergeRound(buffer.begin(), begin);
+                    }
+                    else
+                    {
+                        mergeRound(begin, buffer.begin());
+                    }
+                    sortedInBuffer = !sortedInBuffer;
+                }
+                if (sortedInBuffer)
+                {
+                    std::move(buffer.begin(), buffer.end(), begin);
+                }
+                return;
+            }
+        }
+        std::stable_sort(begin, end, compare);
+    }
+}
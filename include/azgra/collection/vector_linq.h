@@ -1,7 +1,11 @@
 #pragma once
 
 #include <azgra/azgra.h>
+#include <azgra/utilities/parallel.h>
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <functional>
 #include <limits>
 
@@ -9,35 +13,63 @@ namespace azgra
 {
     namespace collection
     {
+        /**
+         * Find the index of the first element equal to the element. Parallel search skips the chunks
+         * behind the already found index.
+         * @param src Searched vector.
+         * @param element Searched element.
+         * @param policy Execution policy.
+         * @return Index of the element or -1.
+         */
         template<typename T>
-        azgra::i64 get_index(const std::vector<T> &src, const T &element)
+        azgra::i64 get_index(const std::vector<T> &src, const T &element,
+                             const ExecutionPolicy policy = ExecutionPolicy_Sequential)
         {
-            for (size_t i = 0; i < src.size(); i++)
+            std::atomic<size_t> foundIndex{src.size()};
+            parallel_for<T>(src.size(), policy, [&](const size_t from, const size_t to)
             {
-                if (src[i] == element)
-                    return i;
-            }
-            return -1;
+                if (from >= foundIndex.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                const auto it = std::find(src.begin() + from, src.begin() + to, element);
+                size_t index = static_cast<size_t>(it - src.begin());
+                if (index == to)
+                {
+                    return;
+                }
+                size_t current = foundIndex.load();
+                while (index < current && !foundIndex.compare_exchange_weak(current, index))
+                {
+                }
+            });
+            const size_t index = foundIndex.load();
+            return (index == src.size()) ? -1 : static_cast<azgra::i64>(index);
         }
 
         template<typename T>
-        std::vector<size_t> add_together(std::vector<T> &result, const std::vector<T> &add)
+        std::vector<T> &add_together(std::vector<T> &result, const std::vector<T> &add,
+                                     const ExecutionPolicy policy = ExecutionPolicy_Sequential)
         {
             always_assert(result.size() == add.size());
-            for (size_t i = 0; i < result.size(); i++)
+            T *resultData = result.data();
+            const T *addData = add.data();
+            parallel_for<T>(result.size(), policy, [=](const size_t from, const size_t to)
             {
-                result[i] += add[i];
-            }
+                for (size_t i = from; i < to; i++)
+                {
+                    resultData[i] += addData[i];
+                }
+            });
             return result;
         }
 
         template<typename T>
-        std::vector<size_t> div_by(std::vector<T> &result, size_t div)
+        std::vector<T> &div_by(std::vector<T> &result, size_t div)
         {
-
-            for (size_t i = 0; i < result.size(); i++)
+            for (T &value : result)
             {
-                result[i] = result[i] / div;
+                value = value / div;
             }
             return result;
         }
@@ -45,16 +77,7 @@ namespace azgra
         template<typename T>
         bool equals(const std::vector<T> &a, const std::vector<T> &b)
         {
-            if (a.size() != b.size())
-                return false;
-
-            for (size_t i = 0; i < a.size(); i++)
-            {
-                if (a[i] != b[i])
-                    return false;
-            }
-
-            return true;
+            return std::equal(a.begin(), a.end(), b.begin(), b.end());
         }
 
         template<typename T>
@@ -63,8 +86,8 @@ namespace azgra
             if (a.size() != b.size())
                 return false;
 
-            return (memcmp(a.data(), b.data(), sizeof(T) * a.size()) == 0);
+            return (a.empty() || memcmp(a.data(), b.data(), sizeof(T) * a.size()) == 0);
         }
 
     }
-}
\ No newline at end of file
+}
@@ -1,10 +1,16 @@
 #pragma once
 
 #include <azgra/azgra.h>
+#include <azgra/collection/sort.h>
+#include <azgra/utilities/parallel.h>
 #include <vector>
 #include <algorithm>
+#include <cstring>
+#include <functional>
 #include <limits>
 #include <map>
+#include <numeric>
+#include <type_traits>
 
 namespace azgra::collection
 {
@@ -12,22 +18,39 @@ namespace azgra::collection
     std::vector<T> range(const size_t stop)
     {
         std::vector<T> indices(stop);
-        for (size_t i = 0; i < stop; ++i)
-        {
-            indices[i] = i;
-        }
+        std::iota(indices.begin(), indices.end(), static_cast<T>(0));
         return indices;
     }
 
 
     // Insert `vecToCopyFrom` data into `vecToInsert` at `insertAtPos`, copy from `copyFromPos` `copySize` number of elements.
+    // Trivially copyable elements are copied by single memmove. Both vectors can be the same vector,
+    // overlapping ranges are then copied as if through a temporary buffer.
     template<typename T>
     inline void vector_insert_at(std::vector<T> &vecToInsertInto, const std::vector<T> &vecToCopyFrom,
                                  const size_t insertAtPos, const size_t copyFromPos, const size_t copySize)
     {
-        for (size_t i = 0; i < copySize; i++)
+        always_assert(insertAtPos + copySize <= vecToInsertInto.size());
+        always_assert(copyFromPos + copySize <= vecToCopyFrom.size());
+        // std::vector<bool> is packed and has no data().
+        if constexpr (std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>)
+        {
+            if (copySize > 0)
+            {
+                std::memmove(vecToInsertInto.data() + insertAtPos, vecToCopyFrom.data() + copyFromPos, copySize * sizeof(T));
+            }
+        }
+        else
         {
-            vecToInsertInto[insertAtPos + i] = vecToCopyFrom[copyFromPos + i];
+            const auto sourceBegin = vecToCopyFrom.begin() + copyFromPos;
+            if ((&vecToInsertInto == &vecToCopyFrom) && (insertAtPos > copyFromPos))
+            {
+                std::copy_backward(sourceBegin, sourceBegin + copySize, vecToInsertInto.begin() + insertAtPos + copySize);
+            }
+            else
+            {
+                std::copy_n(sourceBegin, copySize, vecToInsertInto.begin() + insertAtPos);
+            }
         }
     }
 
@@ -38,17 +61,206 @@ namespace azgra::collection
     }
 
     template<typename T, typename DiffType>
-    std::vector<DiffType> diff_vectors(const std::vector<T> &ref, const std::vector<T> &current)
+    std::vector<DiffType> diff_vectors(const std::vector<T> &ref, const std::vector<T> &current,
+                                       const ExecutionPolicy policy = ExecutionPolicy_Sequential)
     {
         always_assert(ref.size() == current.size());
 
-        std::vector<DiffType> result;
-        result.resize(ref.size());
-        for (size_t i = 0; i < ref.size(); i++)
+        std::vector<DiffType> result(ref.size());
+        const T *refData = ref.data();
+        const T *currentData = current.data();
+        DiffType *resultData = result.data();
+        parallel_for<DiffType>(ref.size(), policy, [=](const size_t from, const size_t to)
+        {
+            for (size_t i = from; i < to; i++)
+            {
+                resultData[i] = (DiffType) (currentData[i] - refData[i]);
+            }
+        });
+
+        return result;
+    }
+
+    /**
+     * Sort the vector in the order of sort_key_less(). Integer and floating point values are sorted by the radix sort,
+     * other types by the parallel stable merge sort. Both sorts follow the execution policy.
+     * @param data Vector to be sorted.
+     * @param policy Execution policy.
+     */
+    template<typename T>
+    void sort_vector(std::vector<T> &data, const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        if constexpr (is_radix_sortable_v<T>)
         {
-            result[i] = (DiffType) (current[i] - ref[i]);
+            if (data.size() >= RadixSortThreshold)
+            {
+                radix_sort(data, false, policy);
+                return;
+            }
         }
+        parallel_stable_sort(data.begin(), data.end(), [](const T &a, const T &b)
+        { return sort_key_less(a, b); }, policy);
+    }
+
+    /**
+     * Stable sort of the vector by the comparison.
+     * @param data Vector to be sorted.
+     * @param compare Less than comparison.
+     * @param policy Execution policy.
+     */
+    template<typename T, typename Compare>
+    void sort_vector(std::vector<T> &data, Compare compare, const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        parallel_stable_sort(data.begin(), data.end(), compare, policy);
+    }
 
+    /**
+     * Find the index of the first element, which isn't less than the value. Arithmetic types are searched
+     * by the branchless binary search, whose loads don't depend on mispredicted branches.
+     * @param data Pointer to the sorted elements.
+     * @param count Number of elements.
+     * @param value Searched value.
+     * @return Index in [0, count].
+     */
+    template<typename T>
+    size_t lower_bound_index(const T *data, size_t count, const T &value)
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            const T *base = data;
+            while (count > 1)
+            {
+                const size_t half = count / 2;
+                base = (base[half - 1] < value) ? base + half : base;
+                count -= half;
+            }
+            return static_cast<size_t>(base - data) + ((count == 1 && *base < value) ? 1 : 0);
+        }
+        else
+        {
+            return static_cast<size_t>(std::lower_bound(data, data + count, value) - data);
+        }
+    }
+
+    /**
+     * Find the lower bound indices of all queries in the sorted vector. Arithmetic queries are searched
+     * in groups, which hide the memory latency of the large vectors.
+     * @param sorted Vector sorted in ascending order.
+     * @param queries Searched values, in any order.
+     * @param policy Execution policy.
+     * @return Vector of indices, i-th index is the lower bound of the i-th query.
+     */
+    template<typename T>
+    std::vector<size_t> lower_bound_batch(const std::vector<T> &sorted, const std::vector<T> &queries,
+                                          const ExecutionPolicy policy = ExecutionPolicy_Sequential)
+    {
+        std::vector<size_t> result(queries.size());
+        parallel_for<size_t>(queries.size(), policy, [&](const size_t from, const size_t to)
+        {
+            size_t i = from;
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                // Group of searches advances in lockstep, so that their cache misses overlap.
+                constexpr size_t GroupSize = 8;
+                for (; i + GroupSize <= to; i += GroupSize)
+                {
+                    const T *bases[GroupSize];
+                    std::fill_n(bases, GroupSize, sorted.data());
+                    size_t count = sorted.size();
+                    while (count > 1)
+                    {
+                        const size_t half = count / 2;
+                        for (size_t j = 0; j < GroupSize; ++j)
+                        {
+                            bases[j] = (bases[j][half - 1] < queries[i + j]) ? bases[j] + half : bases[j];
+                        }
+                        count -= half;
+                    }
+                    for (size_t j = 0; j < GroupSize; ++j)
+                    {
+                        result[i + j] = static_cast<size_t>(bases[j] - sorted.data()) +
+                                        ((count == 1 && *bases[j] < queries[i + j]) ? 1 : 0);
+                    }
+                }
+            }
+            for (; i < to; ++i)
+            {
+                result[i] = lower_bound_index(sorted.data(), sorted.size(), queries[i]);
+            }
+        });
         return result;
     }
-}
\ No newline at end of file
+
+    /**
+     * Replace every element by the sum of itself and all previous elements. Parallel scan sums the chunks first,
+     * then every chunk adds the sum of the previous chunks.
+     * @param data Vector of the values.
+     * @param policy Execution policy.
+     * @return Sum of all elements.
+     */
+    template<typename T>
+    T inclusive_prefix_sum(std::vector<T> &data, const ExecutionPolicy policy = ExecutionPolicy_Sequential)
+    {
+        const size_t count = data.size();
+        const size_t chunkSize = parallel_chunk_size<T>(count, policy);
+        if (chunkSize >= count)
+        {
+            T sum{};
+            for (T &value : data)
+            {
+                sum += value;
+                value = sum;
+            }
+            return sum;
+        }
+
+        const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        std::vector<T> chunkOffsets(chunkCount);
+        ThreadPool::global().run(chunkCount, [&](const size_t chunk)
+        {
+            T sum{};
+            for (size_t i = chunk * chunkSize; i < std::min(count, (chunk + 1) * chunkSize); ++i)
+            {
+                sum += data[i];
+                data[i] = sum;
+            }
+            chunkOffsets[chunk] = sum;
+        });
+        T total{};
+        for (T &chunkOffset : chunkOffsets)
+        {
+            const T chunkSum = chunkOffset;
+            chunkOffset = total;
+            total += chunkSum;
+        }
+        ThreadPool::global().run(chunkCount - 1, [&](const size_t chunk)
+        {
+            const T offset = chunkOffsets[chunk + 1];
+            for (size_t i = (chunk + 1) * chunkSize; i < std::min(count, (chunk + 2) * chunkSize); ++i)
+            {
+                data[i] += offset;
+            }
+        });
+        return total;
+    }
+
+    /**
+     * Replace every element by the sum of all previous elements, the first element becomes zero.
+     * Used to turn the counts into the offsets.
+     * @param data Vector of the values.
+     * @param policy Execution policy.
+     * @return Sum of all elements.
+     */
+    template<typename T>
+    T exclusive_prefix_sum(std::vector<T> &data, const ExecutionPolicy policy = ExecutionPolicy_Sequential)
+    {
+        if (data.empty())
+        {
+            return T{};
+        }
+        const T total = inclusive_prefix_sum(data, policy);
+        std::move_backward(data.begin(), data.end() - 1, data.end());
+        data[0] = T{};
+        return total;
+    }
+}
@@ -0,0 +1,703 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <azgra/matrix.h>
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace azgra
+{
+    /**
+     * Matrix with dimensions known at compile time, stored in std::array. Intended for small matrices,
+     * like 3x3 and 4x4 transformations, which don't allocate and are fully unrolled by the element index sequences.
+     * All operations, except the norm, can be evaluated at compile time.
+     *
+     * The API matches Matrix, so generic code can use both. FixedMatrix can also be used in lazy expressions
+     * with Matrix and MatrixView, e.g. `Matrix<f32> m = matrix + fixed`.
+     * @tparam T Type of matrix element.
+     * @tparam R Number of rows.
+     * @tparam C Number of columns.
+     * @tparam RowBased True if elements are saved by rows, otherwise elements are saved by columns.
+     */
+    template<typename T, size_t R, size_t C, bool RowBased = true>
+    class FixedMatrix : public MatrixExpression<FixedMatrix<T, R, C, RowBased>>
+    {
+        static_assert(R > 0 && C > 0, "FixedMatrix dimensions must be positive.");
+
+        template<typename U, size_t R_, size_t C_, bool RowBased_>
+        friend
+        class FixedMatrix;
+
+    public:
+        using ValueType = T;
+        static constexpr bool IsRowBased = RowBased;
+        static constexpr size_t ElementCount = R * C;
+
+    private:
+        /**
+         * Matrix data.
+         */
+        std::array<T, ElementCount> m_data;
+
+        /**
+         * Calculate the 1d index of the 2d matrix element.
+         * @param row Zero based row index of the element.
+         * @param col Zero based column index of the element.
+         * @return Index of the element into the 1d array.
+         */
+        static constexpr size_t index(const size_t row, const size_t col)
+        {
+            return RowBased ? ((row * C) + col) : ((col * R) + row);
+        }
+
+        static constexpr size_t row_of(const size_t index)
+        {
+            return RowBased ? (index / C) : (index % R);
+        }
+
+        static constexpr size_t col_of(const size_t index)
+        {
+            return RowBased ? (index % C) : (index / R);
+        }
+
+        template<typename Fn, size_t ...I>
+        static constexpr FixedMatrix generate(Fn fn, std::index_sequence<I...>)
+        {
+            return FixedMatrix(std::array<T, ElementCount>{fn(I)...});
+        }
+
+        /**
+         * Create matrix from fn(index) of every element, the calls are expanded at compile time.
+         */
+        template<typename Fn>
+        static constexpr FixedMatrix generate(Fn fn)
+        {
+            return generate(fn, std::make_index_sequence<ElementCount>());
+        }
+
+        template<size_t K, bool OtherRowBased, size_t ...P>
+        constexpr T dot(const size_t row, const size_t col, const FixedMatrix<T, C, K, OtherRowBased> &other,
+                        std::index_sequence<P...>) const
+        {
+            return (... + (at(row, P) * other.at(P, col)));
+        }
+
+        static constexpr T abs(const T &value)
+        {
+            return (value < T{}) ? -value : value;
+        }
+
+        /**
+         * Gaussian elimination with partial pivoting, used for matrices larger than 4x4.
+         */
+        constexpr T eliminated_determinant() const
+        {
+            FixedMatrix lu(*this);
+            T det = T(1);
+            for (size_t k = 0; k < R; ++k)
+            {
+                size_t pivot = k;
+                for (size_t i = k + 1; i < R; ++i)
+                {
+                    if (abs(lu.at(i, k)) > abs(lu.at(pivot, k)))
+                    {
+                        pivot = i;
+                    }
+                }
+                if (lu.at(pivot, k) == T{})
+                {
+                    return T{};
+                }
+                if (pivot != k)
+                {
+                    lu.swap_rows(pivot, k);
+                    det = -det;
+                }
+                det *= lu.at(k, k);
+                for (size_t i = k + 1; i < R; ++i)
+                {
+                    const T factor = lu.at(i, k) / lu.at(k, k);
+                    for (size_t j = k + 1; j < C; ++j)
+                    {
+                        lu.at(i, j) -= factor * lu.at(k, j);
+                    }
+                }
+            }
+            return det;
+        }
+
+        /**
+         * Gauss-Jordan elimination with partial pivoting, used for matrices larger than 4x4.
+         */
+        constexpr FixedMatrix eliminated_inverse() const
+        {
+            FixedMatrix a(*this);
+            FixedMatrix inv = identity();
+            for (size_t k = 0; k < R; ++k)
+            {
+                size_t pivot = k;
+                for (size_t i = k + 1; i < R; ++i)
+                {
+                    if (abs(a.at(i, k)) > abs(a.at(pivot, k)))
+                    {
+                        pivot = i;
+                    }
+                }
+                always_assert(a.at(pivot, k) != T{} && "Matrix is singular.");
+                a.swap_rows(pivot, k);
+                inv.swap_rows(pivot, k);
+
+                const T pivotInv = T(1) / a.at(k, k);
+                for (size_t j = 0; j < C; ++j)
+                {
+                    a.at(k, j) *= pivotInv;
+                    inv.at(k, j) *= pivotInv;
+                }
+                for (size_t i = 0; i < R; ++i)
+                {
+                    const T factor = a.at(i, k);
+                    if (i == k || factor == T{})
+                    {
+                        continue;
+                    }
+                    for (size_t j = 0; j < C; ++j)
+                    {
+                        a.at(i, j) -= factor * a.at(k, j);
+                        inv.at(i, j) -= factor * inv.at(k, j);
+                    }
+                }
+            }
+            return inv;
+        }
+
+        constexpr void swap_rows(const size_t a, const size_t b)
+        {
+            for (size_t j = 0; j < C; ++j)
+            {
+                const T tmp = at(a, j);
+                at(a, j) = at(b, j);
+                at(b, j) = tmp;
+            }
+        }
+
+    public:
+        /**
+         * Default constructor, all elements are zero.
+         */
+        constexpr FixedMatrix() : m_data{}
+        {
+        }
+
+        /**
+         * Initialize all elements to the value.
+         * @param initialValue Value set for all elements.
+         */
+        constexpr explicit FixedMatrix(const T &initialValue) : m_data{}
+        {
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                m_data[i] = initialValue;
+            }
+        }
+
+        /**
+         * Initialize matrix with the elements in the storage order, same as Matrix.
+         * Use parentheses for the initial value constructor, `FixedMatrix<f32, 3, 3>{1.0f}` is a list.
+         * @param initializerList R * C elements.
+         */
+        constexpr FixedMatrix(std::initializer_list<T> initializerList) : m_data{}
+        {
+            always_assert(initializerList.size() == ElementCount);
+            size_t i = 0;
+            for (const T &value : initializerList)
+            {
+                m_data[i++] = value;
+            }
+        }
+
+        /**
+         * Initialize matrix with the elements in the storage order.
+         * @param data R * C elements.
+         */
+        constexpr explicit FixedMatrix(const std::array<T, ElementCount> &data) : m_data(data)
+        {
+        }
+
+        /**
+         * Evaluate matrix expression of the same dimensions, e.g. sum of two views.
+         * @param expression Matrix expression.
+         */
+        template<typename E, typename = std::enable_if_t<!std::is_same<E, FixedMatrix>::value>>
+        explicit FixedMatrix(const MatrixExpression<E> &expression) : m_data{}
+        {
+            const MatrixOperandType<E> operand = as_operand(expression);
+            always_assert(operand.rows() == R && operand.cols() == C);
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                m_data[i] = static_cast<T>(operand.element(row_of(i), col_of(i)));
+            }
+        }
+
+        /**
+         * Create identity matrix.
+         * @return Matrix with ones on the diagonal.
+         */
+        static constexpr FixedMatrix identity()
+        {
+            static_assert(R == C, "Identity matrix must be square.");
+            return generate([](const size_t i)
+                            { return (row_of(i) == col_of(i)) ? T(1) : T{}; });
+        }
+
+        [[nodiscard]] static constexpr size_t rows() noexcept
+        {
+            return R;
+        }
+
+        [[nodiscard]] static constexpr size_t cols() noexcept
+        {
+            return C;
+        }
+
+        /**
+         * Access reference of the element at given row and column.
+         * @param row Zero based row index.
+         * @param col Zero based column index.
+         * @return Reference to the matrix element.
+         */
+        constexpr T &at(const size_t row, const size_t col)
+        {
+            return m_data[index(row, col)];
+        }
+
+        /**
+         * Access const reference of the element at given row and column.
+         * @param row Zero based row index.
+         * @param col Zero based column index.
+         * @return Const reference to the matrix element.
+         */
+        constexpr const T &at(const size_t row, const size_t col) const
+        {
+            return m_data[index(row, col)];
+        }
+
+        constexpr const T &element(const size_t row, const size_t col) const
+        {
+            return at(row, col);
+        }
+
+        MatrixView<T> view()
+        {
+            return MatrixView<T>(m_data.data(), R, C, RowBased ? C : 1, RowBased ? 1 : R);
+        }
+
+        MatrixView<const T> view() const
+        {
+            return MatrixView<const T>(m_data.data(), R, C, RowBased ? C : 1, RowBased ? 1 : R);
+        }
+
+        auto row_cbegin(const size_t row) const
+        { return view().row_cbegin(row); }
+
+        auto row_cend(const size_t row) const
+        { return view().row_cend(row); }
+
+        auto row_begin(const size_t row)
+        { return view().row_begin(row); }
+
+        auto row_end(const size_t row)
+        { return view().row_end(row); }
+
+        auto col_cbegin(const size_t col) const
+        { return view().col_cbegin(col); }
+
+        auto col_cend(const size_t col) const
+        { return view().col_cend(col); }
+
+        auto col_begin(const size_t col)
+        { return view().col_begin(col); }
+
+        auto col_end(const size_t col)
+        { return view().col_end(col); }
+
+        /**
+         * Check whether two matrices are same. All their values are equal.
+         * @param mat Another matrix.
+         * @return True if all values are equal.
+         */
+        constexpr bool equals(const FixedMatrix &mat) const
+        {
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                if (!(m_data[i] == mat.m_data[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        constexpr bool operator==(const FixedMatrix &other) const
+        {
+            return equals(other);
+        }
+
+        constexpr bool operator!=(const FixedMatrix &other) const
+        {
+            return !equals(other);
+        }
+
+        /**
+         * Element-wise sum of two matrices.
+         * @param other Matrix of the same dimensions.
+         * @return New matrix with summed elements.
+         */
+        constexpr FixedMatrix add(const FixedMatrix &other) const
+        {
+            return generate([&](const size_t i)
+                            { return m_data[i] + other.m_data[i]; });
+        }
+
+        /**
+         * Element-wise difference of two matrices.
+         * @param other Matrix of the same dimensions.
+         * @return New matrix with subtracted elements.
+         */
+        constexpr FixedMatrix subtract(const FixedMatrix &other) const
+        {
+            return generate([&](const size_t i)
+                            { return m_data[i] - other.m_data[i]; });
+        }
+
+        constexpr FixedMatrix operator+(const FixedMatrix &other) const
+        {
+            return add(other);
+        }
+
+        constexpr FixedMatrix operator-(const FixedMatrix &other) const
+        {
+            return subtract(other);
+        }
+
+        constexpr FixedMatrix operator-() const
+        {
+            return generate([&](const size_t i)
+                            { return -m_data[i]; });
+        }
+
+        constexpr FixedMatrix operator*(const T &scalar) const
+        {
+            return generate([&](const size_t i)
+                            { return m_data[i] * scalar; });
+        }
+
+        constexpr FixedMatrix operator/(const T &scalar) const
+        {
+            return generate([&](const size_t i)
+                            { return m_data[i] / scalar; });
+        }
+
+        friend constexpr FixedMatrix operator*(const T &scalar, const FixedMatrix &matrix)
+        {
+            return matrix * scalar;
+        }
+
+        constexpr FixedMatrix &operator+=(const FixedMatrix &other)
+        {
+            return *this = add(other);
+        }
+
+        constexpr FixedMatrix &operator-=(const FixedMatrix &other)
+        {
+            return *this = subtract(other);
+        }
+
+        /**
+         * Multiply this matrix by another matrix. Every element is unrolled dot product.
+         * @tparam K Number of columns of the right hand side matrix.
+         * @tparam OtherRowBased Storage order of the right hand side matrix.
+         * @param other Right hand side matrix with C rows.
+         * @return R x K matrix product with the same storage order as this matrix.
+         */
+        template<size_t K, bool OtherRowBased>
+        constexpr FixedMatrix<T, R, K, RowBased> multiply(const FixedMatrix<T, C, K, OtherRowBased> &other) const
+        {
+            using Result = FixedMatrix<T, R, K, RowBased>;
+            return Result::generate([&](const size_t i)
+                                    {
+                                        return dot(Result::row_of(i), Result::col_of(i), other,
+                                                   std::make_index_sequence<C>());
+                                    });
+        }
+
+        template<size_t K, bool OtherRowBased>
+        constexpr FixedMatrix<T, R, K, RowBased> operator*(const FixedMatrix<T, C, K, OtherRowBased> &other) const
+        {
+            return multiply(other);
+        }
+
+        /**
+         * Create transposed matrix with the same storage order.
+         * @return C x R transposed matrix.
+         */
+        constexpr FixedMatrix<T, C, R, RowBased> transpose() const
+        {
+            using Result = FixedMatrix<T, C, R, RowBased>;
+            return Result::generate([&](const size_t i)
+                                    { return at(Result::col_of(i), Result::row_of(i)); });
+        }
+
+        /**
+         * Calculate the determinant. Matrices up to 4x4 use closed formulas, which are exact for integer types,
+         * larger matrices use Gaussian elimination.
+         * @return Determinant of the square matrix.
+         */
+        constexpr T determinant() const
+        {
+            static_assert(R == C, "Determinant requires square matrix.");
+            const auto &a = *this;
+            if constexpr (R == 1)
+            {
+                return a.at(0, 0);
+            }
+            else if constexpr (R == 2)
+            {
+                return (a.at(0, 0) * a.at(1, 1)) - (a.at(0, 1) * a.at(1, 0));
+            }
+            else if constexpr (R == 3)
+            {
+                return (a.at(0, 0) * ((a.at(1, 1) * a.at(2, 2)) - (a.at(1, 2) * a.at(2, 1)))) -
+                       (a.at(0, 1) * ((a.at(1, 0) * a.at(2, 2)) - (a.at(1, 2) * a.at(2, 0)))) +
+                       (a.at(0, 2) * ((a.at(1, 0) * a.at(2, 1)) - (a.at(1, 1) * a.at(2, 0))));
+            }
+            else if constexpr (R == 4)
+            {
+                // Laplace expansion by the 2x2 minors of the first two and the last two rows.
+                const T s0 = (a.at(0, 0) * a.at(1, 1)) - (a.at(1, 0) * a.at(0, 1));
+                const T s1 = (a.at(0, 0) * a.at(1, 2)) - (a.at(1, 0) * a.at(0, 2));
+                const T s2 = (a.at(0, 0) * a.at(1, 3)) - (a.at(1, 0) * a.at(0, 3));
+                const T s3 = (a.at(0, 1) * a.at(1, 2)) - (a.at(1, 1) * a.at(0, 2));
+                const T s4 = (a.at(0, 1) * a.at(1, 3)) - (a.at(1, 1) * a.at(0, 3));
+                const T s5 = (a.at(0, 2) * a.at(1, 3)) - (a.at(1, 2) * a.at(0, 3));
+                const T c5 = (a.at(2, 2) * a.at(3, 3)) - (a.at(3, 2) * a.at(2, 3));
+                const T c4 = (a.at(2, 1) * a.at(3, 3)) - (a.at(3, 1) * a.at(2, 3));
+                const T c3 = (a.at(2, 1) * a.at(3, 2)) - (a.at(3, 1) * a.at(2, 2));
+                const T c2 = (a.at(2, 0) * a.at(3, 3)) - (a.at(3, 0) * a.at(2, 3));
+                const T c1 = (a.at(2, 0) * a.at(3, 2)) - (a.at(3, 0) * a.at(2, 2));
+                const T c0 = (a.at(2, 0) * a.at(3, 1)) - (a.at(3, 0) * a.at(2, 1));
+                return (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+            }
+            else
+            {
+                return eliminated_determinant();
+            }
+        }
+
+        /**
+         * Calculate the inverse matrix. Matrices up to 4x4 use the adjugate matrix, larger matrices
+         * use Gauss-Jordan elimination. Matrix must not be singular.
+         * @return Inverse of the square matrix.
+         */
+        constexpr FixedMatrix inverse() const
+        {
+            static_assert(R == C, "Inverse requires square matrix.");
+            static_assert(std::is_floating_point<T>::value, "Inverse requires floating point type.");
+            const auto &a = *this;
+            if constexpr (R <= 3)
+            {
+                const T det = determinant();
+                always_assert(det != T{} && "Matrix is singular.");
+                const T invDet = T(1) / det;
+                if constexpr (R == 1)
+                {
+                    return FixedMatrix(invDet);
+                }
+                else if constexpr (R == 2)
+                {
+                    FixedMatrix inv;
+                    inv.at(0, 0) = a.at(1, 1) * invDet;
+                    inv.at(0, 1) = -a.at(0, 1) * invDet;
+                    inv.at(1, 0) = -a.at(1, 0) * invDet;
+                    inv.at(1, 1) = a.at(0, 0) * invDet;
+                    return inv;
+                }
+                else
+                {
+                    FixedMatrix inv;
+                    inv.at(0, 0) = ((a.at(1, 1) * a.at(2, 2)) - (a.at(1, 2) * a.at(2, 1))) * invDet;
+                    inv.at(0, 1) = ((a.at(0, 2) * a.at(2, 1)) - (a.at(0, 1) * a.at(2, 2))) * invDet;
+                    inv.at(0, 2) = ((a.at(0, 1) * a.at(1, 2)) - (a.at(0, 2) * a.at(1, 1))) * invDet;
+                    inv.at(1, 0) = ((a.at(1, 2) * a.at(2, 0)) - (a.at(1, 0) * a.at(2, 2))) * invDet;
+                    inv.at(1, 1) = ((a.at(0, 0) * a.at(2, 2)) - (a.at(0, 2) * a.at(2, 0))) * invDet;
+                    inv.at(1, 2) = ((a.at(0, 2) * a.at(1, 0)) - (a.at(0, 0) * a.at(1, 2))) * invDet;
+                    inv.at(2, 0) = ((a.at(1, 0) * a.at(2, 1)) - (a.at(1, 1) * a.at(2, 0))) * invDet;
+                    inv.at(2, 1) = ((a.at(0, 1) * a.at(2, 0)) - (a.at(0, 0) * a.at(2, 1))) * invDet;
+                    inv.at(2, 2) = ((a.at(0, 0) * a.at(1, 1)) - (a.at(0, 1) * a.at(1, 0))) * invDet;
+                    return inv;
+                }
+            }
+            else if constexpr (R == 4)
+            {
+                // Same 2x2 minors as in the determinant, reused for all the cofactors.
+                const T s0 = (a.at(0, 0) * a.at(1, 1)) - (a.at(1, 0) * a.at(0, 1));
+                const T s1 = (a.at(0, 0) * a.at(1, 2)) - (a.at(1, 0) * a.at(0, 2));
+                const T s2 = (a.at(0, 0) * a.at(1, 3)) - (a.at(1, 0) * a.at(0, 3));
+                const T s3 = (a.at(0, 1) * a.at(1, 2)) - (a.at(1, 1) * a.at(0, 2));
+                const T s4 = (a.at(0, 1) * a.at(1, 3)) - (a.at(1, 1) * a.at(0, 3));
+                const T s5 = (a.at(0, 2) * a.at(1, 3)) - (a.at(1, 2) * a.at(0, 3));
+                const T c5 = (a.at(2, 2) * a.at(3, 3)) - (a.at(3, 2) * a.at(2, 3));
+                const T c4 = (a.at(2, 1) * a.at(3, 3)) - (a.at(3, 1) * a.at(2, 3));
+                const T c3 = (a.at(2, 1) * a.at(3, 2)) - (a.at(3, 1) * a.at(2, 2));
+                const T c2 = (a.at(2, 0) * a.at(3, 3)) - (a.at(3, 0) * a.at(2, 3));
+                const T c1 = (a.at(2, 0) * a.at(3, 2)) - (a.at(3, 0) * a.at(2, 2));
+                const T c0 = (a.at(2, 0) * a.at(3, 1)) - (a.at(3, 0) * a.at(2, 1));
+                const T det = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+                always_assert(det != T{} && "Matrix is singular.");
+                const T invDet = T(1) / det;
+
+                FixedMatrix inv;
+                inv.at(0, 0) = ((a.at(1, 1) * c5) - (a.at(1, 2) * c4) + (a.at(1, 3) * c3)) * invDet;
+                inv.at(0, 1) = ((-a.at(0, 1) * c5) + (a.at(0, 2) * c4) - (a.at(0, 3) * c3)) * invDet;
+                inv.at(0, 2) = ((a.at(3, 1) * s5) - (a.at(3, 2) * s4) + (a.at(3, 3) * s3)) * invDet;
+                inv.at(0, 3) = ((-a.at(2, 1) * s5) + (a.at(2, 2) * s4) - (a.at(2, 3) * s3)) * invDet;
+                inv.at(1, 0) = ((-a.at(1, 0) * c5) + (a.at(1, 2) * c2) - (a.at(1, 3) * c1)) * invDet;
+                inv.at(1, 1) = ((a.at(0, 0) * c5) - (a.at(0, 2) * c2) + (a.at(0, 3) * c1)) * invDet;
+                inv.at(1, 2) = ((-a.at(3, 0) * s5) + (a.at(3, 2) * s2) - (a.at(3, 3) * s1)) * invDet;
+                inv.at(1, 3) = ((a.at(2, 0) * s5) - (a.at(2, 2) * s2) + (a.at(2, 3) * s1)) * invDet;
+                inv.at(2, 0) = ((a.at(1, 0) * c4) - (a.at(1, 1) * c2) + (a.at(1, 3) * c0)) * invDet;
+                inv.at(2, 1) = ((-a.at(0, 0) * c4) + (a.at(0, 1) * c2) - (a.at(0, 3) * c0)) * invDet;
+                inv.at(2, 2) = ((a.at(3, 0) * s4) - (a.at(3, 1) * s2) + (a.at(3, 3) * s0)) * invDet;
+                inv.at(2, 3) = ((-a.at(2, 0) * s4) + (a.at(2, 1) * s2) - (a.at(2, 3) * s0)) * invDet;
+                inv.at(3, 0) = ((-a.at(1, 0) * c3) + (a.at(1, 1) * c1) - (a.at(1, 2) * c0)) * invDet;
+                inv.at(3, 1) = ((a.at(0, 0) * c3) - (a.at(0, 1) * c1) + (a.at(0, 2) * c0)) * invDet;
+                inv.at(3, 2) = ((-a.at(3, 0) * s3) + (a.at(3, 1) * s1) - (a.at(3, 2) * s0)) * invDet;
+                inv.at(3, 3) = ((a.at(2, 0) * s3) - (a.at(2, 1) * s1) + (a.at(2, 2) * s0)) * invDet;
+                return inv;
+            }
+            else
+            {
+                return eliminated_inverse();
+            }
+        }
+
+        /**
+         * Sum of all matrix elements.
+         * @return Sum of elements.
+         */
+        constexpr T sum() const
+        {
+            T result{};
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                result += m_data[i];
+            }
+            return result;
+        }
+
+        /**
+         * Smallest matrix element.
+         * @return Minimal value.
+         */
+        constexpr T min() const
+        {
+            T result = m_data[0];
+            for (size_t i = 1; i < ElementCount; ++i)
+            {
+                result = (m_data[i] < result) ? m_data[i] : result;
+            }
+            return result;
+        }
+
+        /**
+         * Largest matrix element.
+         * @return Maximal value.
+         */
+        constexpr T max() const
+        {
+            T result = m_data[0];
+            for (size_t i = 1; i < ElementCount; ++i)
+            {
+                result = (result < m_data[i]) ? m_data[i] : result;
+            }
+            return result;
+        }
+
+        /**
+         * Frobenius norm, square root of the sum of squared elements.
+         * @return Matrix norm.
+         */
+        f64 norm() const
+        {
+            f64 squareSum = 0.0;
+            for (const T &value : m_data)
+            {
+                squareSum += static_cast<f64>(value) * static_cast<f64>(value);
+            }
+            return std::sqrt(squareSum);
+        }
+
+        /**
+         * Return copy of the row elements.
+         * @param rowIndex Zero based row index.
+         * @return Array of row elements.
+         */
+        constexpr std::array<T, C> row(const size_t rowIndex) const
+        {
+            always_assert(rowIndex < R);
+            std::array<T, C> rowData{};
+            for (size_t col = 0; col < C; ++col)
+            {
+                rowData[col] = at(rowIndex, col);
+            }
+            return rowData;
+        }
+
+        /**
+         * Return copy of column elements.
+         * @param colIndex Zero based column index.
+         * @return Array of column elements.
+         */
+        constexpr std::array<T, R> col(const size_t colIndex) const
+        {
+            always_assert(colIndex < C);
+            std::array<T, R> colData{};
+            for (size_t row = 0; row < R; ++row)
+            {
+                colData[row] = at(row, colIndex);
+            }
+            return colData;
+        }
+
+        /**
+         * Copy into the dynamically sized matrix with the same storage order.
+         * @return Matrix copy.
+         */
+        Matrix<T, RowBased> to_matrix() const
+        {
+            return Matrix<T, RowBased>(*this, ExecutionPolicy_Sequential);
+        }
+
+        /**
+         * Get constant reference to the matrix data.
+         * @return Constant reference to array data.
+         */
+        constexpr const std::array<T, ElementCount> &get_data() const
+        {
+            return m_data;
+        }
+    };
+
+    template<typename T, size_t R, size_t C, bool RowBased>
+    struct MatrixExpressionOperand<FixedMatrix<T, R, C, RowBased>>
+    {
+        using Type = MatrixLeafExpression<T, RowBased>;
+
+        static Type wrap(const FixedMatrix<T, R, C, RowBased> &matrix)
+        {
+            return Type(matrix.get_data().data(), R, C);
+        }
+    };
+}
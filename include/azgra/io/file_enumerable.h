@@ -0,0 +1,243 @@
+#pragma once
+
+#include <azgra/collection/enumerable.h>
+#include <azgra/io/text_file_functions.h>
+#include <azgra/io/stream/in_binary_file_stream.h>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace azgra::io
+{
+    /**
+     * Size of the read buffer of the fixed size binary records.
+     */
+    constexpr size_t RecordReadBufferSize = 64 * 1024;
+
+    /**
+     * Lines of the text file. Every cursor opens its own stream and holds only the current line.
+     */
+    class TextLineRange : public collection::RangeBase<TextLineRange>
+    {
+    private:
+        std::string m_fileName;
+
+    public:
+        using ValueType = std::string;
+        static constexpr bool HasKnownSize = false;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        public:
+            using ValueType = std::string;
+
+        private:
+            std::ifstream m_stream;
+            std::string m_line;
+
+        public:
+            explicit Cursor(const std::string &fileName) : m_stream(open_text_file(fileName))
+            {
+            }
+
+            bool move_next()
+            {
+                return static_cast<bool>(std::getline(m_stream, m_line));
+            }
+
+            const std::string &current() const
+            {
+                return m_line;
+            }
+        };
+
+        explicit TextLineRange(std::string fileName) : m_fileName(std::move(fileName))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_fileName);
+        }
+    };
+
+    /**
+     * Fixed size binary records of the trivially copyable type T, stored one after another in the file.
+     * Records are read by the buffer of RecordReadBufferSize bytes. Incomplete record at the end of the file is ignored.
+     */
+    template<typename T>
+    class BinaryRecordRange : public collection::RangeBase<BinaryRecordRange<T>>
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Binary record must be trivially copyable.");
+
+    private:
+        std::string m_fileName;
+        i64 m_offset;
+
+    public:
+        using ValueType = T;
+        static constexpr bool HasKnownSize = false;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        public:
+            using ValueType = T;
+
+        private:
+            std::unique_ptr<stream::InBinaryFileStream> m_stream;
+            ByteArray m_buffer;
+            size_t m_bufferSize = 0;
+            size_t m_bufferPosition = 0;
+            T m_current{};
+
+            bool fill_buffer()
+            {
+                const size_t remaining = static_cast<size_t>(m_stream->get_size() - m_stream->get_position());
+                const size_t recordCount = std::min(remaining, m_buffer.size()) / sizeof(T);
+                m_bufferSize = recordCount * sizeof(T);
+                m_bufferPosition = 0;
+                if (recordCount == 0)
+                {
+                    return false;
+                }
+                m_stream->consume_into(m_buffer, 0, m_bufferSize);
+                return true;
+            }
+
+        public:
+            Cursor(const std::string &fileName, const i64 offset)
+                    : m_stream(std::make_unique<stream::InBinaryFileStream>(fileName)),
+                      m_buffer(std::max(sizeof(T), (RecordReadBufferSize / sizeof(T)) * sizeof(T)))
+            {
+                m_stream->move_to(offset);
+            }
+
+            bool move_next()
+            {
+                if (m_bufferPosition >= m_bufferSize && !fill_buffer())
+                {
+                    return false;
+                }
+                std::memcpy(&m_current, m_buffer.data() + m_bufferPosition, sizeof(T));
+                m_bufferPosition += sizeof(T);
+                return true;
+            }
+
+            const T &current() const
+            {
+                return m_current;
+            }
+        };
+
+        BinaryRecordRange(std::string fileName, const i64 offset) : m_fileName(std::move(fileName)), m_offset(offset)
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_fileName, m_offset);
+        }
+    };
+
+    /**
+     * Binary records parsed by the reader function T reader(InBinaryStreamBase &), which is called
+     * until the whole file is consumed.
+     */
+    template<typename Reader>
+    class BinaryReaderRange : public collection::RangeBase<BinaryReaderRange<Reader>>
+    {
+    private:
+        std::string m_fileName;
+        i64 m_offset;
+        Reader m_reader;
+
+    public:
+        using ValueType = std::decay_t<std::invoke_result_t<Reader &, stream::InBinaryStreamBase &>>;
+        static constexpr bool HasKnownSize = false;
+        static constexpr bool IsSplittable = false;
+
+        class Cursor
+        {
+        public:
+            using ValueType = std::decay_t<std::invoke_result_t<Reader &, stream::InBinaryStreamBase &>>;
+
+        private:
+            std::unique_ptr<stream::InBinaryFileStream> m_stream;
+            Reader m_reader;
+            std::optional<ValueType> m_current;
+
+        public:
+            Cursor(const std::string &fileName, const i64 offset, Reader reader)
+                    : m_stream(std::make_unique<stream::InBinaryFileStream>(fileName)), m_reader(std::move(reader))
+            {
+                m_stream->move_to(offset);
+            }
+
+            bool move_next()
+            {
+                if (m_stream->get_position() >= m_stream->get_size())
+                {
+                    return false;
+                }
+                m_current = m_reader(*m_stream);
+                return true;
+            }
+
+            const ValueType &current() const
+            {
+                return *m_current;
+            }
+        };
+
+        BinaryReaderRange(std::string fileName, const i64 offset, Reader reader)
+                : m_fileName(std::move(fileName)), m_offset(offset), m_reader(std::move(reader))
+        {
+        }
+
+        [[nodiscard]] Cursor cursor() const
+        {
+            return Cursor(m_fileName, m_offset, m_reader);
+        }
+    };
+
+    /**
+     * Create lazy Enumerable of the text file lines. File is read only when the query is evaluated,
+     * so the memory use doesn't depend on the file size.
+     * @param fileName Path to the text file.
+     * @return Enumerable of the lines.
+     */
+    inline collection::Enumerable<std::string, TextLineRange> enumerate_lines(const std::string &fileName)
+    {
+        return collection::Enumerable<std::string, TextLineRange>(TextLineRange(fileName));
+    }
+
+    /**
+     * Create lazy Enumerable of the fixed size binary records.
+     * @tparam T Trivially copyable record type.
+     * @param fileName Path to the binary file.
+     * @param offset Offset of the first record, e.g. size of the file header.
+     * @return Enumerable of the records.
+     */
+    template<typename T>
+    collection::Enumerable<T, BinaryRecordRange<T>> enumerate_records(const std::string &fileName, const i64 offset = 0)
+    {
+        return collection::Enumerable<T, BinaryRecordRange<T>>(BinaryRecordRange<T>(fileName, offset));
+    }
+
+    /**
+     * Create lazy Enumerable of the binary records parsed by the reader.
+     * @param fileName Path to the binary file.
+     * @param reader Function reading one record from the stream.
+     * @param offset Offset of the first record.
+     * @return Enumerable of the records.
+     */
+    template<typename Reader, typename T = typename BinaryReaderRange<Reader>::ValueType>
+    collection::Enumerable<T, BinaryReaderRange<Reader>> enumerate_parsed_records(const std::string &fileName, Reader reader,
+                                                                                 const i64 offset = 0)
+    {
+        return collection::Enumerable<T, BinaryReaderRange<Reader>>(BinaryReaderRange<Reader>(fileName, offset, std::move(reader)));
+    }
+}
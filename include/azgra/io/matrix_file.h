@@ -0,0 +1,333 @@
+#pragma once
+
+#include <azgra/matrix.h>
+#include <azgra/matrix_view.h>
+#include <azgra/io/memory_mapped_file.h>
+#include <azgra/utilities/allocators.h>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+namespace azgra::io
+{
+    /**
+     * Type of the matrix element stored in the matrix file.
+     */
+    enum MatrixElementType
+    {
+        MatrixElementType_U8 = 0,
+        MatrixElementType_I8,
+        MatrixElementType_U16,
+        MatrixElementType_I16,
+        MatrixElementType_U32,
+        MatrixElementType_I32,
+        MatrixElementType_U64,
+        MatrixElementType_I64,
+        MatrixElementType_F32,
+        MatrixElementType_F64
+    };
+
+    /**
+     * Get the file element type of the C++ type.
+     * @tparam T Matrix element type, only fixed size integers, float and double are supported.
+     * @return Matrix file element type.
+     */
+    template<typename T>
+    constexpr MatrixElementType matrix_element_type()
+    {
+        static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                      "Only integer and floating point elements can be stored in the matrix file.");
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only float and double are supported.");
+            return (sizeof(T) == 4) ? MatrixElementType_F32 : MatrixElementType_F64;
+        }
+        else if constexpr (sizeof(T) == 1)
+        {
+            return std::is_signed<T>::value ? MatrixElementType_I8 : MatrixElementType_U8;
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return std::is_signed<T>::value ? MatrixElementType_I16 : MatrixElementType_U16;
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return std::is_signed<T>::value ? MatrixElementType_I32 : MatrixElementType_U32;
+        }
+        else
+        {
+            static_assert(sizeof(T) == 8, "Unsupported integer size.");
+            return std::is_signed<T>::value ? MatrixElementType_I64 : MatrixElementType_U64;
+        }
+    }
+
+    /**
+     * Get size of the file element type.
+     * @param elementType Matrix file element type.
+     * @return Size of the element in bytes.
+     */
+    size_t matrix_element_size(MatrixElementType elementType);
+
+    /**
+     * Header of the binary matrix file. Header is followed by the elements in the storage order,
+     * starting at dataOffset, which is aligned to the header alignment.
+     * All fields are stored in the byte order of the writer, byteOrderMark detects foreign files.
+     */
+    struct MatrixFileHeader
+    {
+        char magic[8];
+        u32 version;
+        u32 byteOrderMark;
+        u32 elementType;
+        u32 elementSize;
+        u32 rowBased;
+        u32 alignment;
+        u64 rowCount;
+        u64 colCount;
+        u64 dataOffset;
+        u64 reserved;
+    };
+    static_assert(sizeof(MatrixFileHeader) == 64, "Matrix file header must stay 64 bytes.");
+
+    inline constexpr char MatrixFileMagic[8] = {'A', 'Z', 'G', 'R', 'A', 'M', 'A', 'T'};
+    inline constexpr u32 MatrixFileVersion = 1;
+    inline constexpr u32 MatrixFileByteOrderMark = 0x01020304;
+
+    /**
+     * Create header of the matrix file, with data aligned to SimdAlignment.
+     * @param elementType Element type.
+     * @param rowCount Matrix row count.
+     * @param colCount Matrix column count.
+     * @param rowBased True if the elements are stored by rows.
+     * @return Matrix file header.
+     */
+    MatrixFileHeader make_matrix_file_header(MatrixElementType elementType, size_t rowCount, size_t colCount,
+                                             bool rowBased);
+
+    /**
+     * Check that the header is valid and the file contains all the elements.
+     * @param header Header read from the file.
+     * @param fileSize Size of the whole file in bytes.
+     * @return True if the header is valid.
+     */
+    bool is_valid_matrix_file_header(const MatrixFileHeader &header, size_t fileSize);
+
+    /**
+     * Matrix file mapped into the memory. Elements are read lazily by the kernel, when they are accessed,
+     * so the matrix larger than the physical memory can be used through the read-only view.
+     */
+    class MappedMatrixFile
+    {
+    private:
+        MemoryMappedFile m_file;
+        MatrixFileHeader m_header{};
+
+    public:
+        /**
+         * Map the matrix file, the header is validated.
+         * @param fileName Path to the matrix file.
+         */
+        explicit MappedMatrixFile(const char *fileName);
+
+        [[nodiscard]] size_t rows() const noexcept
+        {
+            return static_cast<size_t>(m_header.rowCount);
+        }
+
+        [[nodiscard]] size_t cols() const noexcept
+        {
+            return static_cast<size_t>(m_header.colCount);
+        }
+
+        [[nodiscard]] bool is_row_based() const noexcept
+        {
+            return m_header.rowBased != 0;
+        }
+
+        [[nodiscard]] MatrixElementType element_type() const noexcept
+        {
+            return static_cast<MatrixElementType>(m_header.elementType);
+        }
+
+        [[nodiscard]] const MatrixFileHeader &header() const noexcept
+        {
+            return m_header;
+        }
+
+        /**
+         * Check whether the stored elements are of type T.
+         * @tparam T Requested element type.
+         * @return True if view<T>() can be used.
+         */
+        template<typename T>
+        [[nodiscard]] bool is_element_type() const noexcept
+        {
+            return m_header.elementType == static_cast<u32>(matrix_element_type<T>());
+        }
+
+        /**
+         * Give the kernel hint about the access pattern of the matrix elements.
+         * @param pattern Expected access pattern.
+         */
+        void advise(MemoryAccessPattern pattern) const;
+
+        /**
+         * Get read-only view of the mapped elements. The view is valid while this object lives.
+         * @tparam T Element type, must match the stored element type.
+         * @return Read-only matrix view.
+         */
+        template<typename T>
+        [[nodiscard]] MatrixView<const T> view() const
+        {
+            always_assert(is_element_type<T>() && "Requested element type doesn't match the matrix file.");
+            const T *data = reinterpret_cast<const T *>(m_file.data() + m_header.dataOffset);
+            if (is_row_based())
+            {
+                return MatrixView<const T>(data, rows(), cols(), static_cast<std::ptrdiff_t>(cols()), 1);
+            }
+            return MatrixView<const T>(data, rows(), cols(), 1, static_cast<std::ptrdiff_t>(rows()));
+        }
+
+        /**
+         * Copy the mapped elements into the owning matrix.
+         * @tparam T Element type, must match the stored element type.
+         * @tparam RowBased Storage order of the result.
+         * @param policy Execution policy of the copy.
+         * @return Matrix with the copied elements.
+         */
+        template<typename T, bool RowBased = true, typename Allocator = std::allocator<T>>
+        [[nodiscard]] Matrix<T, RowBased, Allocator> to_matrix(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            const MatrixView<const T> mapped = view<T>();
+            if (is_row_based() != RowBased)
+            {
+                return Matrix<T, RowBased, Allocator>(mapped, policy);
+            }
+            Matrix<T, RowBased, Allocator> result(rows(), cols(), MatrixUninitialized);
+            const T *src = mapped.data();
+            T *dst = result.view().data();
+            parallel_for<T>(rows() * cols(), policy, [src, dst](const size_t from, const size_t to)
+            {
+                std::memcpy(dst + from, src + from, (to - from) * sizeof(T));
+            });
+            return result;
+        }
+    };
+
+    /**
+     * Streaming writer of the matrix file, for matrices which don't fit into the memory.
+     * Elements are written in the storage order, in any number of chunks. File is valid only
+     * after all elements were written and the writer was closed.
+     * @tparam T Matrix element type.
+     */
+    template<typename T>
+    class MatrixFileWriter
+    {
+    private:
+        std::ofstream m_stream;
+        MatrixFileHeader m_header{};
+        size_t m_elementCount = 0;
+        size_t m_writtenCount = 0;
+
+    public:
+        /**
+         * Create the matrix file and write its header.
+         * @param fileName Path to the matrix file.
+         * @param rowCount Matrix row count.
+         * @param colCount Matrix column count.
+         * @param rowBased True if the elements will be written by rows.
+         */
+        MatrixFileWriter(const char *fileName, const size_t rowCount, const size_t colCount, const bool rowBased = true)
+        {
+            m_header = make_matrix_file_header(matrix_element_type<T>(), rowCount, colCount, rowBased);
+            m_elementCount = rowCount * colCount;
+            m_stream.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+            always_assert(m_stream.is_open() && "Failed to open matrix file for writing.");
+
+            m_stream.write(reinterpret_cast<const char *>(&m_header), sizeof(MatrixFileHeader));
+            for (size_t padding = sizeof(MatrixFileHeader); padding < m_header.dataOffset; ++padding)
+            {
+                m_stream.put(0);
+            }
+        }
+
+        MatrixFileWriter(const MatrixFileWriter &) = delete;
+
+        MatrixFileWriter &operator=(const MatrixFileWriter &) = delete;
+
+        /**
+         * Write next elements in the storage order.
+         * @param elements Pointer to the elements.
+         * @param count Number of elements.
+         */
+        void write(const T *elements, const size_t count)
+        {
+            always_assert(m_stream.is_open() && "Matrix file writer is closed.");
+            always_assert((m_writtenCount + count) <= m_elementCount && "Writing more elements than the matrix has.");
+            m_stream.write(reinterpret_cast<const char *>(elements), static_cast<std::streamsize>(count * sizeof(T)));
+            always_assert(m_stream.good() && "Failed to write matrix elements.");
+            m_writtenCount += count;
+        }
+
+        /**
+         * Write next elements in the storage order.
+         * @param elements Elements to write.
+         */
+        template<typename Allocator>
+        void write(const std::vector<T, Allocator> &elements)
+        {
+            write(elements.data(), elements.size());
+        }
+
+        /**
+         * Get number of elements, which must still be written.
+         * @return Remaining element count.
+         */
+        [[nodiscard]] size_t remaining() const noexcept
+        {
+            return m_elementCount - m_writtenCount;
+        }
+
+        /**
+         * Flush and close the file. All elements must have been written.
+         */
+        void close()
+        {
+            if (!m_stream.is_open())
+            {
+                return;
+            }
+            always_assert(m_writtenCount == m_elementCount && "Not all matrix elements were written.");
+            m_stream.flush();
+            m_stream.close();
+        }
+    };
+
+    /**
+     * Save the matrix into the binary matrix file, in its storage order.
+     * @param matrix Matrix to save.
+     * @param fileName Path to the matrix file.
+     */
+    template<typename T, bool RowBased, typename Allocator>
+    void save_matrix(const Matrix<T, RowBased, Allocator> &matrix, const char *fileName)
+    {
+        MatrixFileWriter<T> writer(fileName, matrix.rows(), matrix.cols(), RowBased);
+        writer.write(matrix.get_data());
+        writer.close();
+    }
+
+    /**
+     * Load the binary matrix file into the memory.
+     * @tparam T Element type, must match the stored element type.
+     * @tparam RowBased Storage order of the result, file with other order is transposed while loading.
+     * @param fileName Path to the matrix file.
+     * @return Loaded matrix.
+     */
+    template<typename T, bool RowBased = true>
+    Matrix<T, RowBased> load_matrix(const char *fileName)
+    {
+        const MappedMatrixFile mappedFile(fileName);
+        mappedFile.advise(MemoryAccessPattern_Sequential);
+        return mappedFile.to_matrix<T, RowBased>();
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <azgra/azgra.h>
+
+namespace azgra::io
+{
+    /**
+     * Expected access pattern of the mapped memory, passed to the kernel as the paging hint.
+     */
+    enum MemoryAccessPattern
+    {
+        // Default read-ahead.
+        MemoryAccessPattern_Normal,
+        // Aggressive read-ahead, pages behind the reader can be dropped early.
+        MemoryAccessPattern_Sequential,
+        // No read-ahead.
+        MemoryAccessPattern_Random,
+        // Start reading the pages in the background now.
+        MemoryAccessPattern_WillNeed
+    };
+
+    /**
+     * Read-only memory mapping of the whole file. Pages are loaded on the first access by the kernel,
+     * so huge files are used without reading them into the heap.
+     * On platforms without mmap, the file is read into the memory buffer.
+     */
+    class MemoryMappedFile
+    {
+    private:
+        const byte *m_data = nullptr;
+        size_t m_size = 0;
+        bool m_mapped = false;
+#ifdef _WIN32
+        ByteArray m_buffer;
+#endif
+
+        void unmap() noexcept;
+
+    public:
+        /**
+         * Create closed mapping.
+         */
+        MemoryMappedFile() = default;
+
+        /**
+         * Map the whole file into the memory.
+         * @param fileName Path to the file.
+         */
+        explicit MemoryMappedFile(const char *fileName);
+
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile &) = delete;
+
+        MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+
+        MemoryMappedFile(MemoryMappedFile &&other) noexcept;
+
+        MemoryMappedFile &operator=(MemoryMappedFile &&other) noexcept;
+
+        /**
+         * Check whether the file is mapped.
+         * @return True if the file is open.
+         */
+        [[nodiscard]] bool is_open() const noexcept
+        {
+            return m_mapped;
+        }
+
+        /**
+         * Get pointer to the first byte of the file, aligned at least to the page size.
+         * @return Pointer to the mapped bytes, nullptr for empty file.
+         */
+        [[nodiscard]] const byte *data() const noexcept
+        {
+            return m_data;
+        }
+
+        /**
+         * Get size of the mapped file.
+         * @return File size in bytes.
+         */
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        /**
+         * Give the kernel hint about the access pattern of the byte range.
+         * @param pattern Expected access pattern.
+         * @param offset Offset of the first byte of the range.
+         * @param byteCount Number of bytes of the range.
+         */
+        void advise(MemoryAccessPattern pattern, size_t offset, size_t byteCount) const;
+
+        /**
+         * Give the kernel hint about the access pattern of the whole file.
+         * @param pattern Expected access pattern.
+         */
+        void advise(MemoryAccessPattern pattern) const
+        {
+            advise(pattern, 0, m_size);
+        }
+
+        /**
+         * Unmap the file.
+         */
+        void close() noexcept;
+    };
+}
@@ -2,6 +2,8 @@
 
 #include "buffer_source_type.h"
 #include "in_binary_stream_base.h"
+#include "stream_read_ahead.h"
+#include <memory>
 
 namespace azgra::io::stream
 {
@@ -19,19 +21,41 @@ namespace azgra::io::stream
         BufferSourceType underlayingSourceType;
         // Memory buffer.
         const ByteArray *memoryBuffer;
-        // Current position in buffer.
-        azgra::u64 currentBufferPosition = 0;
         // Number of bytes readed from source.
         azgra::u64 readedFromSource = 0;
+        // Background reader of the next buffers, used when the read-ahead depth is at least two.
+        std::unique_ptr<StreamReadAhead> readAhead;
 
         azgra::u64 get_consume_size();
 
+        // Current position in buffer. Rest of the buffer is the direct read range of the base class,
+        // so that the templated reads are inlined.
+        azgra::u64 buffer_position() const;
+
+        // Move to position in the current buffer and update the direct read range.
+        void set_buffer_position(const azgra::u64 position);
+
+        // Load the buffer from the position of the underlaying stream.
+        void reload_stream_buffer(const azgra::i64 position);
+
+        // Replace the consumed buffer by the next buffer of the read-ahead.
+        void next_read_ahead_buffer();
+
+    protected:
+        // Copy bytes from the buffer, refilling it when needed.
+        void read_raw(byte *dst, const azgra::u64 byteCount) override;
+
     public:
         InBinaryBufferStream();
 
         InBinaryBufferStream(const ByteArray *bytes);
 
-        InBinaryBufferStream(InBinaryStreamBase *stream, const azgra::i64 bufferSize = 500000);
+        // Buffer the underlaying stream. With readAheadDepth of two (double buffering) or more, the next buffers
+        // are filled by background thread while the current one is consumed, and single read can span any number
+        // of them. Underlaying stream mustn't be used by anyone else while this stream exists, it is read ahead
+        // of the position of this stream. Errors of the background reads are reported by the next read.
+        InBinaryBufferStream(InBinaryStreamBase *stream, const azgra::i64 bufferSize = 500000,
+                             const azgra::u32 readAheadDepth = 1);
 
         ~InBinaryBufferStream();
 
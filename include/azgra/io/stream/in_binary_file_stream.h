@@ -15,7 +15,17 @@ namespace azgra::io::stream
         // Size of opened file.
         azgra::i64 fileSize;
 
+        // Read from the offset to the end of the file by bulk reads and move the stream to the end.
+        ByteArray read_to_end(azgra::i64 offset);
+
+    protected:
+        // Read directly into the destination, without temporary buffer.
+        void read_raw(byte *dst, const azgra::u64 byteCount) override;
+
     public:
+        // Maximal number of bytes read by single read call of the bulk reads.
+        static constexpr azgra::u64 BulkReadChunkSize = 64 * 1024 * 1024;
+
         // ifstream wrapper around binary stream.
         InBinaryFileStream();
 
@@ -52,10 +62,11 @@ namespace azgra::io::stream
         // Move file stream by distance.
         void move_by(const azgra::i64 distance) override;
 
-        // Read whole file, from beginning to end, to memory.
+        // Read whole file, from beginning to end, to memory. Result is allocated once from the file size
+        // and filled by bulk reads. Stream is moved to the end.
         ByteArray consume_whole_file();
 
-        // Read rest of the file, from current position to end, into memory.
+        // Read rest of the file, from current position to end, into memory. Stream is moved to the end.
         ByteArray consume_rest_of_file();
 
         // Read specified number of bytes.
@@ -64,5 +75,8 @@ namespace azgra::io::stream
         // Read specified number of bytes into dst buffer, insert read bytes from pos.
         void consume_into(ByteArray &dst, size_t pos, size_t byteCount) override;
 
+        // Read at most byteCount bytes into dst, returns the number of bytes actually read from the file.
+        azgra::u64 consume_up_to(byte *dst, const azgra::u64 byteCount) override;
+
     };
 } // namespace azgra
\ No newline at end of file
@@ -11,6 +11,13 @@ namespace azgra::io::stream
     protected:
         // True if underlaying stream is open.
         bool isOpen;
+        // Memory of the stream, which can be read directly without the virtual calls, as [directReadPosition, directReadEnd).
+        // Streams backed by the memory set the range and derive their position from directReadPosition.
+        const byte *directReadPosition = nullptr;
+        const byte *directReadEnd = nullptr;
+
+        // Read byteCount bytes into dst, used by read<T>() when the direct range doesn't contain the value.
+        virtual void read_raw(byte *dst, const azgra::u64 byteCount);
 
     public:
         InBinaryStreamBase()
@@ -82,6 +89,91 @@ namespace azgra::io::stream
 
         // Read specified number of bytes into dst buffer, insert read bytes from pos.
         virtual void consume_into(ByteArray &dst, size_t pos, size_t byteCount);
+
+        // Read at most byteCount bytes into dst and return the number of read bytes.
+        // Less bytes are read only at the end of the stream or when the underlaying read fails.
+        virtual azgra::u64 consume_up_to(byte *dst, const azgra::u64 byteCount);
+
+        // Read value of trivially copyable type without allocation. Value is copied directly from the stream memory
+        // when available.
+        template<typename T>
+        T read()
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read.");
+            T value;
+            if (static_cast<size_t>(directReadEnd - directReadPosition) >= sizeof(T))
+            {
+                std::memcpy(&value, directReadPosition, sizeof(T));
+                directReadPosition += sizeof(T);
+            }
+            else
+            {
+                read_raw(reinterpret_cast<byte *>(&value), sizeof(T));
+            }
+            return value;
+        }
+
+        // Read arithmetic value stored in the byte order. Byte order of other types can't be changed,
+        // so passing it for them doesn't compile.
+        template<typename T>
+        T read(const ByteOrder byteOrder)
+        {
+            static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be byte swapped.");
+            const T value = read<T>();
+            return (byteOrder == ByteOrder_LittleEndian) ? value : byte_swap(value);
+        }
+
+        // Read count values into dst, with single bounds check and copy.
+        template<typename T>
+        void read_array(T *dst, const size_t count)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read.");
+            const size_t byteCount = count * sizeof(T);
+            if (byteCount == 0)
+                return;
+            if (static_cast<size_t>(directReadEnd - directReadPosition) >= byteCount)
+            {
+                std::memcpy(dst, directReadPosition, byteCount);
+                directReadPosition += byteCount;
+            }
+            else
+            {
+                read_raw(reinterpret_cast<byte *>(dst), byteCount);
+            }
+        }
+
+        // Read count arithmetic values stored in the byte order into dst.
+        template<typename T>
+        void read_array(T *dst, const size_t count, const ByteOrder byteOrder)
+        {
+            static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be byte swapped.");
+            read_array(dst, count);
+            if (byteOrder != ByteOrder_LittleEndian)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    dst[i] = byte_swap(dst[i]);
+                }
+            }
+        }
+
+        // Read count values into new vector.
+        template<typename T>
+        std::vector<T> read_array(const size_t count)
+        {
+            std::vector<T> result(count);
+            read_array(result.data(), count);
+            return result;
+        }
+
+        // Read count arithmetic values stored in the byte order into new vector.
+        template<typename T>
+        std::vector<T> read_array(const size_t count, const ByteOrder byteOrder)
+        {
+            std::vector<T> result(count);
+            read_array(result.data(), count, byteOrder);
+            return result;
+        }
     };
 
 } // namespace azgra
\ No newline at end of file
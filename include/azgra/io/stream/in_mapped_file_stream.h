@@ -0,0 +1,91 @@
+#pragma once
+
+#include "in_binary_stream_base.h"
+#include <azgra/io/memory_mapped_file.h>
+#include <azgra/span.h>
+#include <cstring>
+
+namespace azgra::io::stream
+{
+
+    // Binary stream over the memory mapped file. Reading is a copy from the mapping, read<T>() never leaves the inlined
+    // fast path. Zero-copy accessors return spans or pointers into the mapping, which stay valid until the stream is closed.
+    class InMappedFileStream : public InBinaryStreamBase
+    {
+    private:
+        // Mapping of the opened file. Whole mapping is the direct read range of the base stream,
+        // current position is directReadPosition.
+        MemoryMappedFile mappedFile;
+
+        // Check that byteCount bytes can be read from the current position.
+        void ensure_available(const azgra::u64 byteCount) const;
+
+    protected:
+        // Called only when the read doesn't fit into the rest of the file.
+        void read_raw(byte *dst, const azgra::u64 byteCount) override;
+
+    public:
+        // Create closed stream.
+        InMappedFileStream();
+
+        // Map the file, access pattern is passed to the kernel as paging hint.
+        explicit InMappedFileStream(const std::string &file, MemoryAccessPattern accessPattern = MemoryAccessPattern_Sequential);
+
+        // Map the file, access pattern is passed to the kernel as paging hint.
+        explicit InMappedFileStream(const char *file, MemoryAccessPattern accessPattern = MemoryAccessPattern_Sequential);
+
+        // Unmaps the file.
+        ~InMappedFileStream();
+
+        // Map the file.
+        void open_stream(const char *file, MemoryAccessPattern accessPattern = MemoryAccessPattern_Sequential);
+
+        // Unmap the file. Spans and pointers returned by the stream are no longer valid.
+        void close_stream() override;
+
+        // Give the kernel hint about the access pattern of the whole file.
+        void advise(MemoryAccessPattern accessPattern) const;
+
+        // Give the kernel hint about the access pattern of the byte range.
+        void advise(MemoryAccessPattern accessPattern, azgra::u64 offset, azgra::u64 byteCount) const;
+
+        // Get size of mapped file.
+        azgra::i64 get_size() const override;
+
+        // Get current position in stream.
+        azgra::i64 get_position() override;
+
+        // Move to location in stream.
+        void move_to(const azgra::i64 position) override;
+
+        // Move stream to beginning.
+        void move_to_beginning() override;
+
+        // Move stream to end.
+        void move_to_end() override;
+
+        // Move stream by distance.
+        void move_by(const azgra::i64 distance) override;
+
+        // Read specified number of bytes.
+        ByteArray consume_bytes(const azgra::u64 byteCount) override;
+
+        // Read specified number of bytes into dst buffer, insert read bytes from pos.
+        void consume_into(ByteArray &dst, size_t pos, size_t byteCount) override;
+
+        // Get span of the next byteCount bytes and advance the stream, without copying.
+        ByteSpan consume_span(const azgra::u64 byteCount);
+
+        // Get pointer to the next byteCount bytes and advance the stream, without copying.
+        const byte *consume_pointer(const azgra::u64 byteCount);
+
+        // Get span of byteCount bytes at the position, stream position doesn't change.
+        ByteSpan span_at(const azgra::u64 offset, const azgra::u64 byteCount) const;
+
+        // Get pointer to the byte at the current position.
+        const byte *current_pointer() const;
+
+        // Get pointer to the first byte of the file.
+        const byte *data() const;
+    };
+} // namespace azgra
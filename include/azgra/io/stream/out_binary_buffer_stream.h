@@ -1,31 +1,58 @@
 #pragma once
 
 #include <azgra/io/stream/out_binary_stream_base.h>
-#include <azgra/collection/vector_utilities.h>
 
 namespace azgra::io::stream
 {
     class OutBinaryBufferStream : public OutBinaryStreamBase
     {
     private:
+        // Memory of the stream, its size is the capacity. Written bytes are [0, get_position()),
+        // the rest of the buffer is the direct write range of the base class.
         ByteArray buffer;
-        size_t bufferPtr;
 
+        // Grow the buffer geometrically, so that writeSize more bytes fit behind the current position.
         void ensure_capacity(const size_t &writeSize);
 
+        // Move the direct write range to the position in the buffer.
+        void set_position(const size_t position);
+
+    protected:
+        // Copy bytes into the buffer, growing it when needed.
+        void write_raw(const byte *src, const azgra::u64 byteCount) override;
+
     public:
+        // Create stream with buffer preallocated for initialBufferSize bytes.
         OutBinaryBufferStream(const size_t initialBufferSize = 512);
 
         ~OutBinaryBufferStream();
 
+        // Direct write range points into the buffer, the stream can't be copied.
+        OutBinaryBufferStream(const OutBinaryBufferStream &) = delete;
+
+        OutBinaryBufferStream &operator=(const OutBinaryBufferStream &) = delete;
+
         size_t get_position() override;
 
+        // Preallocate the buffer for byteCount bytes in total, writes up to this size won't reallocate.
+        void reserve(const size_t byteCount);
+
         // Write byte to the stream.
         void write_byte(const byte &value) override;
 
         // Write bytes to the stream.
         void write_bytes(const ByteArray &bytes) override;
 
+        // Write the byte value `repCount` times into the stream.
+        void write_replicated_bytes(const byte &repValue, const size_t repCount) override;
+
+        // Get copy of the written bytes.
         ByteArray get_buffer_data() const;
+
+        // Get pointer to the memory of the buffer, it changes only when the buffer grows.
+        const byte *get_buffer_pointer() const;
+
+        // Move the written bytes out of the stream without copy. Stream is empty afterwards.
+        ByteArray release_buffer();
     };
-}
\ No newline at end of file
+}
@@ -9,6 +9,11 @@ namespace azgra::io::stream
     {
     private:
         std::ofstream fileStream;
+
+    protected:
+        // Write directly from the source, without temporary buffer.
+        void write_raw(const byte *src, const azgra::u64 byteCount) override;
+
     public:
         OutBinaryFileStream(const char *fileName);
 
@@ -10,6 +10,14 @@ namespace azgra::io::stream
     protected:
         // True if underlaying stream is open.
         bool isOpen;
+        // Memory of the stream, which can be written directly without the virtual calls, as [directWritePosition, directWriteEnd).
+        // Streams backed by the memory set the range and derive their position from directWritePosition.
+        byte *directWritePosition = nullptr;
+        byte *directWriteEnd = nullptr;
+
+        // Write byteCount bytes from src, used by write<T>() when the direct range can't hold the value.
+        virtual void write_raw(const byte *src, const azgra::u64 byteCount);
+
     public:
         OutBinaryStreamBase()
         {};
@@ -68,6 +76,82 @@ namespace azgra::io::stream
 
         // Write the byte value `repCount` times into the stream.
         virtual void write_replicated_bytes(const byte &repValue, const size_t repCount);
+
+        // Write value of trivially copyable type without allocation. Value is copied directly to the stream memory
+        // when available.
+        template<typename T>
+        void write(const T &value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written.");
+            if (static_cast<size_t>(directWriteEnd - directWritePosition) >= sizeof(T))
+            {
+                std::memcpy(directWritePosition, &value, sizeof(T));
+                directWritePosition += sizeof(T);
+            }
+            else
+            {
+                write_raw(reinterpret_cast<const byte *>(&value), sizeof(T));
+            }
+        }
+
+        // Write arithmetic value swapped to the byte order. Byte order of other types can't be changed,
+        // so passing it for them doesn't compile.
+        template<typename T>
+        void write(const T &value, const ByteOrder byteOrder)
+        {
+            static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be byte swapped.");
+            write((byteOrder == ByteOrder_LittleEndian) ? value : byte_swap(value));
+        }
+
+        // Write count values from src, with single bounds check and copy.
+        template<typename T>
+        void write_array(const T *src, const size_t count)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written.");
+            const size_t byteCount = count * sizeof(T);
+            if (byteCount == 0)
+                return;
+
+            if (static_cast<size_t>(directWriteEnd - directWritePosition) >= byteCount)
+            {
+                std::memcpy(directWritePosition, src, byteCount);
+                directWritePosition += byteCount;
+            }
+            else
+            {
+                write_raw(reinterpret_cast<const byte *>(src), byteCount);
+            }
+        }
+
+        // Write count arithmetic values from src, swapped to the byte order.
+        template<typename T>
+        void write_array(const T *src, const size_t count, const ByteOrder byteOrder)
+        {
+            static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be byte swapped.");
+            if (byteOrder == ByteOrder_LittleEndian || sizeof(T) == 1)
+            {
+                write_array(src, count);
+                return;
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                write(byte_swap(src[i]));
+            }
+        }
+
+        // Write all values of the vector.
+        template<typename T>
+        void write_array(const std::vector<T> &values)
+        {
+            write_array(values.data(), values.size());
+        }
+
+        // Write all arithmetic values of the vector, swapped to the byte order.
+        template<typename T>
+        void write_array(const std::vector<T> &values, const ByteOrder byteOrder)
+        {
+            write_array(values.data(), values.size(), byteOrder);
+        }
     };
 
 } // namespace azgra
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "in_binary_stream_base.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace azgra::io::stream
+{
+
+    // Background reader, which fills the buffers from the stream ahead of the consumer, so that the I/O
+    // overlaps with the decoding. Uses `depth` buffers in total: one is held by the consumer,
+    // the others are being filled or wait to be consumed.
+    // While running, the stream is read only by the worker thread and mustn't be touched by anyone else.
+    class StreamReadAhead
+    {
+    private:
+        // Stream from which the buffers are filled.
+        InBinaryStreamBase *stream = nullptr;
+        // Size of one buffer.
+        azgra::u64 bufferSize;
+        // Total number of buffers, including the buffer held by the consumer.
+        azgra::u32 depth;
+        // Stream position of the next buffer to be read.
+        azgra::i64 nextPosition = 0;
+        // Size of the stream, captured when started.
+        azgra::i64 streamSize = 0;
+        // Thread filling the buffers.
+        std::thread worker;
+        std::mutex lock;
+        // Signaled when buffer was filled or the end of the stream was reached.
+        std::condition_variable bufferFilled;
+        // Signaled when buffer was returned by the consumer or the stop was requested.
+        std::condition_variable bufferReleased;
+        // Buffers ready for the consumer, in the stream order.
+        std::deque<ByteArray> filledBuffers;
+        // Buffers which can be filled.
+        std::vector<ByteArray> freeBuffers;
+        bool stopRequested = false;
+        bool endReached = false;
+        // Set by the worker when the stream couldn't be read, the filled buffers are still consumed before the error.
+        bool readFailed = false;
+        // Exception thrown by the stream on the worker thread, rethrown by next_buffer().
+        std::exception_ptr readError;
+
+        void worker_loop();
+
+    public:
+        // Prepare read-ahead with `depth` buffers of `bufferSize` bytes, at least two buffers are used.
+        StreamReadAhead(const azgra::u64 bufferSize, const azgra::u32 depth);
+
+        // Stops the worker thread.
+        ~StreamReadAhead();
+
+        StreamReadAhead(const StreamReadAhead &) = delete;
+
+        StreamReadAhead &operator=(const StreamReadAhead &) = delete;
+
+        // Start filling the buffers from the position of the stream.
+        void start(InBinaryStreamBase *sourceStream, const azgra::i64 position);
+
+        // Stop the worker thread and drop the filled buffers. Position of the stream is undefined afterwards.
+        void stop();
+
+        // Check if the worker thread was started and not stopped.
+        bool is_running() const;
+
+        // Exchange the consumed buffer for the next filled one, waiting for it if needed.
+        // Returns false when the whole stream was already consumed. Exception thrown by the stream on the worker
+        // is rethrown here, short read of the stream fails the assertion here.
+        bool next_buffer(ByteArray &buffer);
+    };
+} // namespace azgra
@@ -37,8 +37,8 @@ namespace azgra::io
      */
     void write_text(const BasicStringView<char> &fileName, const BasicStringView<char> &text);
 
-    template<typename T>
-    void save_matrix_to_csv(const azgra::Matrix<T> &matrix, const char separator, const char *outFile)
+    template<typename T, bool RowBased, typename Allocator>
+    void save_matrix_to_csv(const azgra::Matrix<T, RowBased, Allocator> &matrix, const char separator, const char *outFile)
     {
         std::ofstream out(outFile, std::ios::out);
         always_assert(out.is_open() && "Failed to open out stream");
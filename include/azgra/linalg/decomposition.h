@@ -0,0 +1,966 @@
+#pragma once
+
+#include <azgra/matrix.h>
+#include <azgra/linalg/gemm.h>
+#include <azgra/utilities/allocators.h>
+#include <azgra/utilities/parallel.h>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace azgra::linalg
+{
+    /**
+     * Number of columns factorized in one panel of the blocked decompositions. Trailing matrix is updated
+     * once per panel by the blocked matrix multiplication, instead of once per column.
+     */
+    constexpr size_t DecompositionBlockSize = 64;
+
+    /**
+     * Compute dst[i] -= factor * src[i] for count elements.
+     */
+    template<typename T>
+    inline void subtract_scaled(T *dst, const T *src, const T factor, const size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[i] -= factor * src[i];
+        }
+    }
+
+    /**
+     * Compute dot product of two continuous ranges.
+     */
+    template<typename T>
+    inline T dot_product(const T *a, const T *b, const size_t count)
+    {
+        T result{};
+        for (size_t i = 0; i < count; ++i)
+        {
+            result += a[i] * b[i];
+        }
+        return result;
+    }
+
+    /**
+     * Copy the matrix into row based working storage of the decompositions.
+     */
+    template<typename T, bool RowBased, typename Allocator>
+    Matrix<T> to_row_based_copy(const Matrix<T, RowBased, Allocator> &matrix, const ExecutionPolicy policy)
+    {
+        return Matrix<T>(matrix.view(), policy);
+    }
+
+    /**
+     * Convert row based working matrix into the requested matrix type, moving it when the types match.
+     */
+    template<bool RowBased, typename Allocator, typename T>
+    Matrix<T, RowBased, Allocator> from_row_based(Matrix<T> &&matrix, const ExecutionPolicy policy)
+    {
+        if constexpr (RowBased && std::is_same<Allocator, typename Matrix<T>::AllocatorType>::value)
+        {
+            return std::move(matrix);
+        }
+        else
+        {
+            return Matrix<T, RowBased, Allocator>(matrix.view(), policy);
+        }
+    }
+
+    /**
+     * Create row based identity matrix.
+     */
+    template<typename T>
+    Matrix<T> identity_matrix(const size_t size)
+    {
+        Matrix<T> result(size, size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            result.at(i, i) = static_cast<T>(1);
+        }
+        return result;
+    }
+
+    /**
+     * LU decomposition with partial pivoting, PA = LU, of the square matrix. L is unit lower triangular
+     * and U is upper triangular, both are stored in the single matrix.
+     *
+     * Factorization is blocked (right-looking): panel of DecompositionBlockSize columns is factorized,
+     * then the block row of U is computed and the trailing matrix is updated by the packed gemm,
+     * split between threads by rows.
+     * @tparam T Floating point element type.
+     */
+    template<typename T>
+    class LuDecomposition
+    {
+        static_assert(std::is_floating_point<T>::value, "Decompositions are implemented only for floating point types.");
+    private:
+        Matrix<T> m_lu;
+        std::vector<size_t> m_permutation;
+        int m_permutationSign = 1;
+        bool m_singular = false;
+
+        void factorize(const ExecutionPolicy policy)
+        {
+            const size_t n = m_lu.rows();
+            T *a = m_lu.view().data();
+            m_permutation.resize(n);
+            std::iota(m_permutation.begin(), m_permutation.end(), static_cast<size_t>(0));
+
+            for (size_t k0 = 0; k0 < n; k0 += DecompositionBlockSize)
+            {
+                const size_t k1 = std::min(n, k0 + DecompositionBlockSize);
+                const size_t kb = k1 - k0;
+
+                // Unblocked factorization of the panel, whole rows are swapped.
+                for (size_t j = k0; j < k1; ++j)
+                {
+                    size_t pivot = j;
+                    T maxAbs = std::abs(a[(j * n) + j]);
+                    for (size_t i = j + 1; i < n; ++i)
+                    {
+                        const T value = std::abs(a[(i * n) + j]);
+                        if (value > maxAbs)
+                        {
+                            maxAbs = value;
+                            pivot = i;
+                        }
+                    }
+                    if (pivot != j)
+                    {
+                        std::swap_ranges(a + (j * n), a + (j * n) + n, a + (pivot * n));
+                        std::swap(m_permutation[j], m_permutation[pivot]);
+                        m_permutationSign = -m_permutationSign;
+                    }
+
+                    const T diagonal = a[(j * n) + j];
+                    if (diagonal == T{})
+                    {
+                        m_singular = true;
+                        continue;
+                    }
+                    const T *pivotRow = a + (j * n);
+                    for (size_t i = j + 1; i < n; ++i)
+                    {
+                        T *row = a + (i * n);
+                        row[j] /= diagonal;
+                        subtract_scaled(row + j + 1, pivotRow + j + 1, row[j], k1 - j - 1);
+                    }
+                }
+
+                if (k1 == n)
+                {
+                    break;
+                }
+                const size_t trailing = n - k1;
+
+                // U12 = L11^-1 * A12, columns are independent.
+                parallel_for<T>(trailing, policy, [a, n, k0, k1](const size_t from, const size_t to)
+                {
+                    for (size_t j = k0; j < k1; ++j)
+                    {
+                        const T *src = a + (j * n) + k1 + from;
+                        for (size_t i = j + 1; i < k1; ++i)
+                        {
+                            subtract_scaled(a + (i * n) + k1 + from, src, a[(i * n) + j], to - from);
+                        }
+                    }
+                });
+
+                // A22 -= L21 * U12, the negated L21 turns it into the accumulating gemm.
+                std::vector<T, PoolAllocator<T>> negatedL21(trailing * kb);
+                for (size_t row = 0; row < trailing; ++row)
+                {
+                    const T *src = a + ((k1 + row) * n) + k0;
+                    for (size_t col = 0; col < kb; ++col)
+                    {
+                        negatedL21[(row * kb) + col] = -src[col];
+                    }
+                }
+                const T *l21 = negatedL21.data();
+                const auto ld = static_cast<std::ptrdiff_t>(n);
+                parallel_for_lines<T>(trailing, trailing * kb, policy, [=](const size_t fromRow, const size_t toRow)
+                {
+                    gemm(toRow - fromRow, trailing, kb,
+                         l21 + (fromRow * kb), static_cast<std::ptrdiff_t>(kb), 1,
+                         a + (k0 * n) + k1, ld, 1,
+                         a + ((k1 + fromRow) * n) + k1, ld, 1);
+                });
+            }
+        }
+
+        // Solve LUx = b in place, for columns [from, to) of row based n x m right-hand side.
+        void substitute(T *x, const size_t ldx, const size_t from, const size_t to) const
+        {
+            const size_t n = m_lu.rows();
+            const T *lu = m_lu.view().data();
+            const size_t width = to - from;
+            for (size_t i = 1; i < n; ++i)
+            {
+                T *xi = x + (i * ldx) + from;
+                for (size_t j = 0; j < i; ++j)
+                {
+                    subtract_scaled(xi, x + (j * ldx) + from, lu[(i * n) + j], width);
+                }
+            }
+            for (size_t i = n; i-- > 0;)
+            {
+                T *xi = x + (i * ldx) + from;
+                for (size_t j = i + 1; j < n; ++j)
+                {
+                    subtract_scaled(xi, x + (j * ldx) + from, lu[(i * n) + j], width);
+                }
+                const T diagonal = lu[(i * n) + i];
+                for (size_t c = 0; c < width; ++c)
+                {
+                    xi[c] /= diagonal;
+                }
+            }
+        }
+
+    public:
+        /**
+         * Decompose the square matrix.
+         * @param matrix Square matrix.
+         * @param policy Execution policy of the trailing matrix updates.
+         */
+        template<bool RowBased, typename Allocator>
+        explicit LuDecomposition(const Matrix<T, RowBased, Allocator> &matrix,
+                                 const ExecutionPolicy policy = ExecutionPolicy_Parallel) :
+                m_lu(to_row_based_copy(matrix, policy))
+        {
+            always_assert(matrix.rows() == matrix.cols() && "LU decomposition requires square matrix.");
+            factorize(policy);
+        }
+
+        /**
+         * Check whether the matrix is singular, so that it can't be solved or inverted.
+         * @return True if zero pivot was found.
+         */
+        [[nodiscard]] bool is_singular() const noexcept
+        {
+            return m_singular;
+        }
+
+        /**
+         * Get the combined LU factors, L below the diagonal (unit diagonal is not stored) and U above.
+         * @return Factorized matrix.
+         */
+        [[nodiscard]] const Matrix<T> &get_lu() const noexcept
+        {
+            return m_lu;
+        }
+
+        /**
+         * Get the row permutation, row i of LU is row permutation[i] of the decomposed matrix.
+         * @return Row permutation.
+         */
+        [[nodiscard]] const std::vector<size_t> &get_permutation() const noexcept
+        {
+            return m_permutation;
+        }
+
+        /**
+         * Get unit lower triangular factor L.
+         * @return Copy of L.
+         */
+        [[nodiscard]] Matrix<T> lower() const
+        {
+            const size_t n = m_lu.rows();
+            Matrix<T> result(n, n);
+            for (size_t row = 0; row < n; ++row)
+            {
+                for (size_t col = 0; col < row; ++col)
+                {
+                    result.at(row, col) = m_lu.at(row, col);
+                }
+                result.at(row, row) = static_cast<T>(1);
+            }
+            return result;
+        }
+
+        /**
+         * Get upper triangular factor U.
+         * @return Copy of U.
+         */
+        [[nodiscard]] Matrix<T> upper() const
+        {
+            const size_t n = m_lu.rows();
+            Matrix<T> result(n, n);
+            for (size_t row = 0; row < n; ++row)
+            {
+                for (size_t col = row; col < n; ++col)
+                {
+                    result.at(row, col) = m_lu.at(row, col);
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Compute the determinant as product of U diagonal.
+         * @return Determinant of the decomposed matrix.
+         */
+        [[nodiscard]] T determinant() const
+        {
+            T result = static_cast<T>(m_permutationSign);
+            for (size_t i = 0; i < m_lu.rows(); ++i)
+            {
+                result *= m_lu.at(i, i);
+            }
+            return result;
+        }
+
+        /**
+         * Solve AX = B.
+         * @param b Right-hand side matrix, with the same number of rows as A.
+         * @param policy Execution policy, columns of B are solved in parallel.
+         * @return Solution X.
+         */
+        template<bool RowBased, typename Allocator>
+        Matrix<T, RowBased, Allocator> solve(const Matrix<T, RowBased, Allocator> &b,
+                                             const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            always_assert(!m_singular && "Can't solve system with singular matrix.");
+            always_assert(b.rows() == m_lu.rows());
+            const size_t n = b.rows();
+            const size_t m = b.cols();
+            Matrix<T> x(n, m, MatrixUninitialized);
+            for (size_t row = 0; row < n; ++row)
+            {
+                std::copy(b.row_cbegin(m_permutation[row]), b.row_cend(m_permutation[row]), x.row_begin(row));
+            }
+            T *data = x.view().data();
+            parallel_for<T>(m, policy, [this, data, m](const size_t from, const size_t to)
+            {
+                substitute(data, m, from, to);
+            });
+            return from_row_based<RowBased, Allocator>(std::move(x), policy);
+        }
+
+        /**
+         * Solve Ax = b.
+         * @param b Right-hand side vector.
+         * @return Solution x.
+         */
+        std::vector<T> solve(const std::vector<T> &b) const
+        {
+            always_assert(!m_singular && "Can't solve system with singular matrix.");
+            always_assert(b.size() == m_lu.rows());
+            std::vector<T> x(b.size());
+            for (size_t i = 0; i < b.size(); ++i)
+            {
+                x[i] = b[m_permutation[i]];
+            }
+            substitute(x.data(), 1, 0, 1);
+            return x;
+        }
+
+        /**
+         * Compute inverse of the decomposed matrix.
+         * @param policy Execution policy, columns of the inverse are computed in parallel.
+         * @return Inverse matrix.
+         */
+        Matrix<T> inverse(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            return solve(identity_matrix<T>(m_lu.rows()), policy);
+        }
+    };
+
+    /**
+     * Cholesky decomposition A = LL^T of the symmetric positive definite matrix. Only the lower triangle
+     * of the matrix is read.
+     *
+     * Factorization is blocked like LuDecomposition, the symmetric trailing update computes only
+     * the lower triangle.
+     * @tparam T Floating point element type.
+     */
+    template<typename T>
+    class CholeskyDecomposition
+    {
+        static_assert(std::is_floating_point<T>::value, "Decompositions are implemented only for floating point types.");
+    private:
+        Matrix<T> m_lower;
+        bool m_positiveDefinite = true;
+
+        void factorize(const ExecutionPolicy policy)
+        {
+            const size_t n = m_lower.rows();
+            T *a = m_lower.view().data();
+
+            for (size_t k0 = 0; k0 < n; k0 += DecompositionBlockSize)
+            {
+                const size_t k1 = std::min(n, k0 + DecompositionBlockSize);
+                const size_t kb = k1 - k0;
+
+                // Diagonal block, trailing updates of the previous panels were already applied.
+                for (size_t j = k0; j < k1; ++j)
+                {
+                    T *rowJ = a + (j * n);
+                    const T diagonal = rowJ[j] - dot_product(rowJ + k0, rowJ + k0, j - k0);
+                    if (!(diagonal > T{}))
+                    {
+                        m_positiveDefinite = false;
+                        return;
+                    }
+                    rowJ[j] = std::sqrt(diagonal);
+                    for (size_t i = j + 1; i < k1; ++i)
+                    {
+                        T *rowI = a + (i * n);
+                        rowI[j] = (rowI[j] - dot_product(rowI + k0, rowJ + k0, j - k0)) / rowJ[j];
+                    }
+                }
+
+                if (k1 == n)
+                {
+                    break;
+                }
+                const size_t trailing = n - k1;
+
+                // L21 = A21 * L11^-T, rows are independent.
+                parallel_for_lines<T>(trailing, kb * kb, policy, [a, n, k0, k1](const size_t from, const size_t to)
+                {
+                    for (size_t i = k1 + from; i < k1 + to; ++i)
+                    {
+                        T *rowI = a + (i * n);
+                        for (size_t j = k0; j < k1; ++j)
+                        {
+                            const T *rowJ = a + (j * n);
+                            rowI[j] = (rowI[j] - dot_product(rowI + k0, rowJ + k0, j - k0)) / rowJ[j];
+                        }
+                    }
+                });
+
+                // A22 -= L21 * L21^T, rows [from, to) of A22 need only the columns [0, to).
+                std::vector<T, PoolAllocator<T>> negatedL21(trailing * kb);
+                for (size_t row = 0; row < trailing; ++row)
+                {
+                    const T *src = a + ((k1 + row) * n) + k0;
+                    for (size_t col = 0; col < kb; ++col)
+                    {
+                        negatedL21[(row * kb) + col] = -src[col];
+                    }
+                }
+                const T *l21 = negatedL21.data();
+                const auto ld = static_cast<std::ptrdiff_t>(n);
+                parallel_for_lines<T>(trailing, trailing * kb, policy, [=](const size_t fromRow, const size_t toRow)
+                {
+                    gemm(toRow - fromRow, toRow, kb,
+                         l21 + (fromRow * kb), static_cast<std::ptrdiff_t>(kb), 1,
+                         a + (k1 * n) + k0, 1, ld,
+                         a + ((k1 + fromRow) * n) + k1, ld, 1);
+                });
+            }
+
+            for (size_t row = 0; row < n; ++row)
+            {
+                std::fill(a + (row * n) + row + 1, a + ((row + 1) * n), T{});
+            }
+        }
+
+        // Solve LL^Tx = b in place, for columns [from, to) of row based n x m right-hand side.
+        void substitute(T *x, const size_t ldx, const size_t from, const size_t to) const
+        {
+            const size_t n = m_lower.rows();
+            const T *l = m_lower.view().data();
+            const size_t width = to - from;
+            for (size_t i = 0; i < n; ++i)
+            {
+                T *xi = x + (i * ldx) + from;
+                for (size_t j = 0; j < i; ++j)
+                {
+                    subtract_scaled(xi, x + (j * ldx) + from, l[(i * n) + j], width);
+                }
+                const T diagonal = l[(i * n) + i];
+                for (size_t c = 0; c < width; ++c)
+                {
+                    xi[c] /= diagonal;
+                }
+            }
+            for (size_t i = n; i-- > 0;)
+            {
+                T *xi = x + (i * ldx) + from;
+                for (size_t j = i + 1; j < n; ++j)
+                {
+                    subtract_scaled(xi, x + (j * ldx) + from, l[(j * n) + i], width);
+                }
+                const T diagonal = l[(i * n) + i];
+                for (size_t c = 0; c < width; ++c)
+                {
+                    xi[c] /= diagonal;
+                }
+            }
+        }
+
+    public:
+        /**
+         * Decompose the symmetric matrix.
+         * @param matrix Symmetric positive definite matrix.
+         * @param policy Execution policy of the trailing matrix updates.
+         */
+        template<bool RowBased, typename Allocator>
+        explicit CholeskyDecomposition(const Matrix<T, RowBased, Allocator> &matrix,
+                                       const ExecutionPolicy policy = ExecutionPolicy_Parallel) :
+                m_lower(to_row_based_copy(matrix, policy))
+        {
+            always_assert(matrix.rows() == matrix.cols() && "Cholesky decomposition requires square matrix.");
+            factorize(policy);
+        }
+
+        /**
+         * Check whether the decomposition succeeded.
+         * @return False if the matrix isn't positive definite.
+         */
+        [[nodiscard]] bool is_positive_definite() const noexcept
+        {
+            return m_positiveDefinite;
+        }
+
+        /**
+         * Get lower triangular factor L.
+         * @return Factor L, valid only for positive definite matrix.
+         */
+        [[nodiscard]] const Matrix<T> &lower() const noexcept
+        {
+            return m_lower;
+        }
+
+        /**
+         * Compute the determinant as squared product of L diagonal.
+         * @return Determinant of the decomposed matrix.
+         */
+        [[nodiscard]] T determinant() const
+        {
+            always_assert(m_positiveDefinite && "Matrix isn't positive definite.");
+            T result = static_cast<T>(1);
+            for (size_t i = 0; i < m_lower.rows(); ++i)
+            {
+                result *= m_lower.at(i, i);
+            }
+            return result * result;
+        }
+
+        /**
+         * Solve AX = B.
+         * @param b Right-hand side matrix, with the same number of rows as A.
+         * @param policy Execution policy, columns of B are solved in parallel.
+         * @return Solution X.
+         */
+        template<bool RowBased, typename Allocator>
+        Matrix<T, RowBased, Allocator> solve(const Matrix<T, RowBased, Allocator> &b,
+                                             const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            always_assert(m_positiveDefinite && "Matrix isn't positive definite.");
+            always_assert(b.rows() == m_lower.rows());
+            const size_t m = b.cols();
+            Matrix<T> x = to_row_based_copy(b, policy);
+            T *data = x.view().data();
+            parallel_for<T>(m, policy, [this, data, m](const size_t from, const size_t to)
+            {
+                substitute(data, m, from, to);
+            });
+            return from_row_based<RowBased, Allocator>(std::move(x), policy);
+        }
+
+        /**
+         * Solve Ax = b.
+         * @param b Right-hand side vector.
+         * @return Solution x.
+         */
+        std::vector<T> solve(const std::vector<T> &b) const
+        {
+            always_assert(m_positiveDefinite && "Matrix isn't positive definite.");
+            always_assert(b.size() == m_lower.rows());
+            std::vector<T> x(b);
+            substitute(x.data(), 1, 0, 1);
+            return x;
+        }
+
+        /**
+         * Compute inverse of the decomposed matrix.
+         * @param policy Execution policy, columns of the inverse are computed in parallel.
+         * @return Inverse matrix.
+         */
+        Matrix<T> inverse(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            return solve(identity_matrix<T>(m_lower.rows()), policy);
+        }
+    };
+
+    /**
+     * Householder QR decomposition A = QR of m x n matrix. Reflectors are stored below the diagonal,
+     * R on and above it.
+     *
+     * Panel of DecompositionBlockSize reflectors is aggregated into the compact WY form I - VTV^T,
+     * so the trailing matrix is updated by two gemm calls, split between threads by columns.
+     * @tparam T Floating point element type.
+     */
+    template<typename T>
+    class QrDecomposition
+    {
+        static_assert(std::is_floating_point<T>::value, "Decompositions are implemented only for floating point types.");
+    private:
+        Matrix<T> m_qr;
+        std::vector<T> m_tau;
+
+        // Compute reflector annihilating column j below the diagonal.
+        void make_reflector(const size_t j)
+        {
+            const size_t m = m_qr.rows();
+            const size_t n = m_qr.cols();
+            T *a = m_qr.view().data();
+            const T alpha = a[(j * n) + j];
+            T sigma{};
+            for (size_t i = j + 1; i < m; ++i)
+            {
+                sigma += a[(i * n) + j] * a[(i * n) + j];
+            }
+            if (sigma == T{})
+            {
+                m_tau[j] = T{};
+                return;
+            }
+            const T beta = -std::copysign(std::sqrt((alpha * alpha) + sigma), alpha);
+            m_tau[j] = (beta - alpha) / beta;
+            const T scale = static_cast<T>(1) / (alpha - beta);
+            for (size_t i = j + 1; i < m; ++i)
+            {
+                a[(i * n) + j] *= scale;
+            }
+            a[(j * n) + j] = beta;
+        }
+
+        // Apply reflector j to columns [from, to) of row based m x ? matrix x.
+        void apply_reflector(const size_t j, T *x, const size_t ldx, const size_t from, const size_t to) const
+        {
+            const T tau = m_tau[j];
+            if (tau == T{})
+            {
+                return;
+            }
+            const size_t m = m_qr.rows();
+            const size_t n = m_qr.cols();
+            const T *a = m_qr.view().data();
+            const size_t width = to - from;
+            std::vector<T, PoolAllocator<T>> w(x + (j * ldx) + from, x + (j * ldx) + to);
+            for (size_t i = j + 1; i < m; ++i)
+            {
+                const T v = a[(i * n) + j];
+                const T *xi = x + (i * ldx) + from;
+                for (size_t c = 0; c < width; ++c)
+                {
+                    w[c] += v * xi[c];
+                }
+            }
+            subtract_scaled(x + (j * ldx) + from, w.data(), tau, width);
+            for (size_t i = j + 1; i < m; ++i)
+            {
+                subtract_scaled(x + (i * ldx) + from, w.data(), tau * a[(i * n) + j], width);
+            }
+        }
+
+        void factorize(const ExecutionPolicy policy)
+        {
+            const size_t m = m_qr.rows();
+            const size_t n = m_qr.cols();
+            const size_t k = std::min(m, n);
+            T *a = m_qr.view().data();
+            m_tau.assign(k, T{});
+
+            for (size_t k0 = 0; k0 < k; k0 += DecompositionBlockSize)
+            {
+                const size_t k1 = std::min(k, k0 + DecompositionBlockSize);
+                const size_t kb = k1 - k0;
+
+                for (size_t j = k0; j < k1; ++j)
+                {
+                    make_reflector(j);
+                    apply_reflector(j, a, n, j + 1, k1);
+                }
+
+                if (k1 >= n)
+                {
+                    break;
+                }
+                const size_t height = m - k0;
+
+                // Explicit V with unit diagonal and zeros above it.
+                std::vector<T, PoolAllocator<T>> v(height * kb);
+                for (size_t row = 0; row < height; ++row)
+                {
+                    for (size_t col = 0; col < kb; ++col)
+                    {
+                        v[(row * kb) + col] = (row < col) ? T{} : ((row == col) ? static_cast<T>(1)
+                                                                                 : a[((k0 + row) * n) + k0 + col]);
+                    }
+                }
+
+                // Upper triangular T of the compact WY form, column i = -tau_i * T * V^T v_i.
+                std::vector<T, PoolAllocator<T>> t(kb * kb, T{});
+                std::vector<T, PoolAllocator<T>> projection(kb);
+                for (size_t i = 0; i < kb; ++i)
+                {
+                    const T tau = m_tau[k0 + i];
+                    for (size_t p = 0; p < i; ++p)
+                    {
+                        T sum{};
+                        for (size_t row = i; row < height; ++row)
+                        {
+                            sum += v[(row * kb) + p] * v[(row * kb) + i];
+                        }
+                        projection[p] = sum;
+                    }
+                    for (size_t p = 0; p < i; ++p)
+                    {
+                        T sum{};
+                        for (size_t q = p; q < i; ++q)
+                        {
+                            sum += t[(p * kb) + q] * projection[q];
+                        }
+                        t[(p * kb) + i] = -tau * sum;
+                    }
+                    t[(i * kb) + i] = tau;
+                }
+
+                // A22 -= V * (T^T * (V^T * A22)), columns are independent.
+                const T *vData = v.data();
+                const T *tData = t.data();
+                const auto ld = static_cast<std::ptrdiff_t>(n);
+                parallel_for<T>(n - k1, policy, [=](const size_t from, const size_t to)
+                {
+                    const size_t width = to - from;
+                    T *a22 = a + (k0 * n) + k1 + from;
+                    std::vector<T, PoolAllocator<T>> w(kb * width, T{});
+                    gemm(kb, width, height,
+                         vData, 1, static_cast<std::ptrdiff_t>(kb),
+                         a22, ld, 1,
+                         w.data(), static_cast<std::ptrdiff_t>(width), 1);
+                    // W = -T^T W, rows from the bottom, so that the read rows are still unchanged.
+                    for (size_t i = kb; i-- > 0;)
+                    {
+                        T *wi = w.data() + (i * width);
+                        const T diagonal = tData[(i * kb) + i];
+                        for (size_t c = 0; c < width; ++c)
+                        {
+                            wi[c] *= -diagonal;
+                        }
+                        for (size_t p = 0; p < i; ++p)
+                        {
+                            subtract_scaled(wi, w.data() + (p * width), tData[(p * kb) + i], width);
+                        }
+                    }
+                    gemm(height, width, kb,
+                         vData, static_cast<std::ptrdiff_t>(kb), 1,
+                         w.data(), static_cast<std::ptrdiff_t>(width), 1,
+                         a22, ld, 1);
+                });
+            }
+        }
+
+    public:
+        /**
+         * Decompose the matrix.
+         * @param matrix Matrix with any dimensions.
+         * @param policy Execution policy of the trailing matrix updates.
+         */
+        template<bool RowBased, typename Allocator>
+        explicit QrDecomposition(const Matrix<T, RowBased, Allocator> &matrix,
+                                 const ExecutionPolicy policy = ExecutionPolicy_Parallel) :
+                m_qr(to_row_based_copy(matrix, policy))
+        {
+            factorize(policy);
+        }
+
+        /**
+         * Check whether R has non-zero diagonal, so that the least squares problem has unique solution.
+         * @return True if the decomposed matrix has full column rank.
+         */
+        [[nodiscard]] bool is_full_rank() const
+        {
+            if (m_qr.rows() < m_qr.cols())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < m_qr.cols(); ++i)
+            {
+                if (m_qr.at(i, i) == T{})
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Get the Householder scalar factors.
+         * @return Tau of every reflector.
+         */
+        [[nodiscard]] const std::vector<T> &get_tau() const noexcept
+        {
+            return m_tau;
+        }
+
+        /**
+         * Get the combined reflectors (below the diagonal) and R.
+         * @return Factorized matrix.
+         */
+        [[nodiscard]] const Matrix<T> &get_qr() const noexcept
+        {
+            return m_qr;
+        }
+
+        /**
+         * Get thin orthogonal factor Q, m x min(m, n).
+         * @param policy Execution policy, columns of Q are computed in parallel.
+         * @return Copy of Q.
+         */
+        [[nodiscard]] Matrix<T> q(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            const size_t m = m_qr.rows();
+            const size_t k = m_tau.size();
+            Matrix<T> result(m, k);
+            for (size_t i = 0; i < k; ++i)
+            {
+                result.at(i, i) = static_cast<T>(1);
+            }
+            T *data = result.view().data();
+            parallel_for<T>(k, policy, [this, data, k](const size_t from, const size_t to)
+            {
+                for (size_t j = k; j-- > 0;)
+                {
+                    apply_reflector(j, data, k, from, to);
+                }
+            });
+            return result;
+        }
+
+        /**
+         * Get upper triangular factor R, min(m, n) x n.
+         * @return Copy of R.
+         */
+        [[nodiscard]] Matrix<T> r() const
+        {
+            const size_t k = m_tau.size();
+            const size_t n = m_qr.cols();
+            Matrix<T> result(k, n);
+            for (size_t row = 0; row < k; ++row)
+            {
+                for (size_t col = row; col < n; ++col)
+                {
+                    result.at(row, col) = m_qr.at(row, col);
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Solve the least squares problem min ||AX - B||, which is the exact solution for the square matrix.
+         * @param b Right-hand side matrix, with the same number of rows as A.
+         * @param policy Execution policy, columns of B are solved in parallel.
+         * @return Solution X, n x B.cols().
+         */
+        template<bool RowBased, typename Allocator>
+        Matrix<T, RowBased, Allocator> solve(const Matrix<T, RowBased, Allocator> &b,
+                                             const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            always_assert(is_full_rank() && "Least squares solution requires matrix with full column rank.");
+            always_assert(b.rows() == m_qr.rows());
+            const size_t n = m_qr.cols();
+            const size_t width = b.cols();
+            Matrix<T> qtb = to_row_based_copy(b, policy);
+            T *data = qtb.view().data();
+            const T *r = m_qr.view().data();
+            parallel_for<T>(width, policy, [this, data, r, n, width](const size_t from, const size_t to)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    apply_reflector(j, data, width, from, to);
+                }
+                for (size_t i = n; i-- > 0;)
+                {
+                    T *xi = data + (i * width) + from;
+                    for (size_t j = i + 1; j < n; ++j)
+                    {
+                        subtract_scaled(xi, data + (j * width) + from, r[(i * n) + j], to - from);
+                    }
+                    for (size_t c = 0; c < to - from; ++c)
+                    {
+                        xi[c] /= r[(i * n) + i];
+                    }
+                }
+            });
+            Matrix<T> x(n, width, MatrixUninitialized);
+            std::copy(data, data + (n * width), x.view().data());
+            return from_row_based<RowBased, Allocator>(std::move(x), policy);
+        }
+
+        /**
+         * Solve the least squares problem min ||Ax - b||.
+         * @param b Right-hand side vector.
+         * @return Solution x.
+         */
+        std::vector<T> solve(const std::vector<T> &b) const
+        {
+            std::vector<T> data(b);
+            Matrix<T> rhs(b.size(), 1, data);
+            const Matrix<T> x = solve(rhs, ExecutionPolicy_Sequential);
+            return std::vector<T>(x.get_data().begin(), x.get_data().end());
+        }
+    };
+
+    /**
+     * Solve AX = B by the LU decomposition.
+     * @param a Square matrix.
+     * @param b Right-hand side matrix.
+     * @param policy Execution policy.
+     * @return Solution X.
+     */
+    template<typename T, bool RowBased, typename Allocator>
+    Matrix<T, RowBased, Allocator> solve(const Matrix<T, RowBased, Allocator> &a, const Matrix<T, RowBased, Allocator> &b,
+                                         const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        return LuDecomposition<T>(a, policy).solve(b, policy);
+    }
+
+    /**
+     * Solve Ax = b by the LU decomposition.
+     * @param a Square matrix.
+     * @param b Right-hand side vector.
+     * @param policy Execution policy.
+     * @return Solution x.
+     */
+    template<typename T, bool RowBased, typename Allocator>
+    std::vector<T> solve(const Matrix<T, RowBased, Allocator> &a, const std::vector<T> &b,
+                         const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        return LuDecomposition<T>(a, policy).solve(b);
+    }
+
+    /**
+     * Compute inverse matrix by the LU decomposition.
+     * @param a Square non-singular matrix.
+     * @param policy Execution policy.
+     * @return Inverse of A.
+     */
+    template<typename T, bool RowBased, typename Allocator>
+    Matrix<T, RowBased, Allocator> inverse(const Matrix<T, RowBased, Allocator> &a,
+                                           const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        const LuDecomposition<T> lu(a, policy);
+        return lu.solve(from_row_based<RowBased, Allocator>(identity_matrix<T>(a.rows()), policy), policy);
+    }
+
+    /**
+     * Compute determinant by the LU decomposition.
+     * @param a Square matrix.
+     * @param policy Execution policy.
+     * @return Determinant of A.
+     */
+    template<typename T, bool RowBased, typename Allocator>
+    T determinant(const Matrix<T, RowBased, Allocator> &a, const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        return LuDecomposition<T>(a, policy).determinant();
+    }
+}
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <azgra/utilities/allocators.h>
+#include <algorithm>
+#include <cstddef>
+
+namespace azgra::linalg
+{
+    /**
+     * Register micro-kernel computing C += A * B for one MR x NR tile.
+     * @param kc Depth of the packed panels.
+     * @param packedA Packed panel of A, MR elements for every k.
+     * @param packedB Packed panel of B, NR elements for every k.
+     * @param C Pointer to the first element of the tile, rows of the tile are continuous.
+     * @param ldc Distance between two rows of the tile.
+     */
+    template<typename T>
+    using GemmMicroKernel = void (*)(size_t kc, const T *packedA, const T *packedB, T *C, size_t ldc);
+
+    /**
+     * Micro-kernel together with its register tile dimensions.
+     */
+    template<typename T>
+    struct GemmKernel
+    {
+        size_t mr;
+        size_t nr;
+        GemmMicroKernel<T> kernel;
+        const char *name;
+    };
+
+    /**
+     * Portable micro-kernel, used for non floating point types and on CPUs without AVX2.
+     */
+    template<typename T, size_t MR, size_t NR>
+    void generic_gemm_micro_kernel(size_t kc, const T *packedA, const T *packedB, T *C, size_t ldc)
+    {
+        T acc[MR][NR] = {};
+        for (size_t p = 0; p < kc; ++p)
+        {
+            for (size_t i = 0; i < MR; ++i)
+            {
+                const T a = packedA[i];
+                for (size_t j = 0; j < NR; ++j)
+                {
+                    acc[i][j] += a * packedB[j];
+                }
+            }
+            packedA += MR;
+            packedB += NR;
+        }
+        for (size_t i = 0; i < MR; ++i)
+        {
+            for (size_t j = 0; j < NR; ++j)
+            {
+                C[(i * ldc) + j] += acc[i][j];
+            }
+        }
+    }
+
+    /**
+     * Select the best micro-kernel for the type T.
+     * @return Generic micro-kernel.
+     */
+    template<typename T>
+    GemmKernel<T> select_gemm_kernel()
+    {
+        return GemmKernel<T>{4, 4, &generic_gemm_micro_kernel<T, 4, 4>, "generic"};
+    }
+
+    /**
+     * Select the best single precision micro-kernel (AVX-512, AVX2 or generic) for the running CPU.
+     */
+    template<>
+    GemmKernel<f32> select_gemm_kernel<f32>();
+
+    /**
+     * Select the best double precision micro-kernel (AVX-512, AVX2 or generic) for the running CPU.
+     */
+    template<>
+    GemmKernel<f64> select_gemm_kernel<f64>();
+
+    /**
+     * Cache blocking parameters. KC panel of B stays in L1, MC x KC block of A in L2 and KC x NC block of B in L3.
+     */
+    constexpr size_t GemmBlockKC = 256;
+    constexpr size_t GemmBlockMC = 96;
+    constexpr size_t GemmBlockNC = 4096;
+
+    /**
+     * Pack mb x kb block of A into panels of mr rows, padding the last panel with zeros.
+     */
+    template<typename T>
+    void gemm_pack_a(const size_t mb, const size_t kb, const T *A, const std::ptrdiff_t rsA, const std::ptrdiff_t csA,
+                     const size_t mr, T *packed)
+    {
+        for (size_t i0 = 0; i0 < mb; i0 += mr)
+        {
+            const size_t rows = std::min(mr, mb - i0);
+            for (size_t p = 0; p < kb; ++p)
+            {
+                const T *src = A + (static_cast<std::ptrdiff_t>(i0) * rsA) + (static_cast<std::ptrdiff_t>(p) * csA);
+                for (size_t i = 0; i < rows; ++i)
+                {
+                    *packed++ = src[static_cast<std::ptrdiff_t>(i) * rsA];
+                }
+                for (size_t i = rows; i < mr; ++i)
+                {
+                    *packed++ = T{};
+                }
+            }
+        }
+    }
+
+    /**
+     * Pack kb x nb block of B into panels of nr columns, padding the last panel with zeros.
+     */
+    template<typename T>
+    void gemm_pack_b(const size_t kb, const size_t nb, const T *B, const std::ptrdiff_t rsB, const std::ptrdiff_t csB,
+                     const size_t nr, T *packed)
+    {
+        for (size_t j0 = 0; j0 < nb; j0 += nr)
+        {
+            const size_t cols = std::min(nr, nb - j0);
+            for (size_t p = 0; p < kb; ++p)
+            {
+                const T *src = B + (static_cast<std::ptrdiff_t>(p) * rsB) + (static_cast<std::ptrdiff_t>(j0) * csB);
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    *packed++ = src[static_cast<std::ptrdiff_t>(j) * csB];
+                }
+                for (size_t j = cols; j < nr; ++j)
+                {
+                    *packed++ = T{};
+                }
+            }
+        }
+    }
+
+    /**
+     * Run the micro-kernel over all tiles of packed mb x kb block of A and kb x nb block of B.
+     */
+    template<typename T>
+    void gemm_macro_kernel(const size_t mb, const size_t nb, const size_t kb, const T *packedA, const T *packedB,
+                           T *C, const size_t ldc, const GemmKernel<T> &kernel)
+    {
+        std::vector<T, PoolAllocator<T>> edgeTile(kernel.mr * kernel.nr);
+        for (size_t jr = 0; jr < nb; jr += kernel.nr)
+        {
+            const size_t cols = std::min(kernel.nr, nb - jr);
+            const T *panelB = packedB + (jr * kb);
+            for (size_t ir = 0; ir < mb; ir += kernel.mr)
+            {
+                const size_t rows = std::min(kernel.mr, mb - ir);
+                const T *panelA = packedA + (ir * kb);
+                T *tileC = C + (ir * ldc) + jr;
+                if (rows == kernel.mr && cols == kernel.nr)
+                {
+                    kernel.kernel(kb, panelA, panelB, tileC, ldc);
+                }
+                else
+                {
+                    // Partial tile is computed into the temporary tile and then only valid part is added.
+                    std::fill(edgeTile.begin(), edgeTile.end(), T{});
+                    kernel.kernel(kb, panelA, panelB, edgeTile.data(), kernel.nr);
+                    for (size_t i = 0; i < rows; ++i)
+                    {
+                        for (size_t j = 0; j < cols; ++j)
+                        {
+                            tileC[(i * ldc) + j] += edgeTile[(i * kernel.nr) + j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * General matrix multiplication C += A * B, where A is m x k, B is k x n and C is m x n.
+     * Every operand is described by its row and column stride, so both row and column based storage
+     * is handled without transposing the operands.
+     * @param m Number of rows of A and C.
+     * @param n Number of columns of B and C.
+     * @param k Number of columns of A and rows of B.
+     * @param A Pointer to A data.
+     * @param rsA Distance between two rows of A.
+     * @param csA Distance between two columns of A.
+     * @param B Pointer to B data.
+     * @param rsB Distance between two rows of B.
+     * @param csB Distance between two columns of B.
+     * @param C Pointer to C data.
+     * @param rsC Distance between two rows of C.
+     * @param csC Distance between two columns of C.
+     */
+    template<typename T>
+    void gemm(const size_t m, const size_t n, const size_t k,
+              const T *A, const std::ptrdiff_t rsA, const std::ptrdiff_t csA,
+              const T *B, const std::ptrdiff_t rsB, const std::ptrdiff_t csB,
+              T *C, const std::ptrdiff_t rsC, const std::ptrdiff_t csC)
+    {
+        if (m == 0 || n == 0 || k == 0)
+        {
+            return;
+        }
+
+        if (csC != 1)
+        {
+            // Micro-kernels write continuous rows of C. Column based C is handled as C^T = B^T * A^T.
+            always_assert(rsC == 1);
+            gemm(n, m, k, B, csB, rsB, A, csA, rsA, C, csC, rsC);
+            return;
+        }
+
+        const GemmKernel<T> kernel = select_gemm_kernel<T>();
+        const size_t mc = std::max(kernel.mr, (GemmBlockMC / kernel.mr) * kernel.mr);
+        const size_t nc = std::max(kernel.nr, (GemmBlockNC / kernel.nr) * kernel.nr);
+        const size_t kc = GemmBlockKC;
+        const size_t ldc = static_cast<size_t>(rsC);
+
+        // Packed panels are fully overwritten, pooled uninitialized buffers avoid allocation and zeroing on every call.
+        std::vector<T, PoolAllocator<T>> packedA(mc * kc);
+        std::vector<T, PoolAllocator<T>> packedB(std::min(nc, ((n + kernel.nr - 1) / kernel.nr) * kernel.nr) * kc);
+
+        for (size_t jc = 0; jc < n; jc += nc)
+        {
+            const size_t nb = std::min(nc, n - jc);
+            for (size_t pc = 0; pc < k; pc += kc)
+            {
+                const size_t kb = std::min(kc, k - pc);
+                gemm_pack_b(kb, nb,
+                            B + (static_cast<std::ptrdiff_t>(pc) * rsB) + (static_cast<std::ptrdiff_t>(jc) * csB),
+                            rsB, csB, kernel.nr, packedB.data());
+
+                for (size_t ic = 0; ic < m; ic += mc)
+                {
+                    const size_t mb = std::min(mc, m - ic);
+                    gemm_pack_a(mb, kb,
+                                A + (static_cast<std::ptrdiff_t>(ic) * rsA) + (static_cast<std::ptrdiff_t>(pc) * csA),
+                                rsA, csA, kernel.mr, packedA.data());
+                    gemm_macro_kernel(mb, nb, kb, packedA.data(), packedB.data(), C + (ic * ldc) + jc, ldc, kernel);
+                }
+            }
+        }
+    }
+}
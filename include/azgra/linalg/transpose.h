@@ -0,0 +1,269 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <azgra/utilities/parallel.h>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define AZGRA_TRANSPOSE_SSE2
+#endif
+
+namespace azgra::linalg
+{
+    /**
+     * Side of the block below which the recursion stops. Two 32x32 blocks of doubles fit into L1 cache.
+     */
+    constexpr size_t TransposeBlockSize = 32;
+
+    /**
+     * Side of the micro tile, which is transposed through local buffer, so that both reads and writes
+     * are continuous runs instead of one cache line per element.
+     */
+    constexpr size_t TransposeTileSize = 8;
+
+    /**
+     * Transpose rows x cols block: dst[c * ldDst + r] = src[r * ldSrc + c].
+     */
+    template<typename T>
+    void transpose_block(const size_t rows, const size_t cols, const T *src, const size_t ldSrc,
+                         T *dst, const size_t ldDst)
+    {
+        constexpr size_t S = TransposeTileSize;
+        for (size_t r0 = 0; r0 < rows; r0 += S)
+        {
+            for (size_t c0 = 0; c0 < cols; c0 += S)
+            {
+                if ((r0 + S) <= rows && (c0 + S) <= cols)
+                {
+#ifdef AZGRA_TRANSPOSE_SSE2
+                    if constexpr (sizeof(T) == 4 && std::is_trivially_copyable<T>::value)
+                    {
+                        // 4-byte elements are transposed as four 4x4 tiles in SSE registers.
+                        for (size_t i = 0; i < S; i += 4)
+                        {
+                            for (size_t j = 0; j < S; j += 4)
+                            {
+                                const T *s = src + ((r0 + i) * ldSrc) + c0 + j;
+                                __m128 row0 = _mm_loadu_ps(reinterpret_cast<const float *>(s));
+                                __m128 row1 = _mm_loadu_ps(reinterpret_cast<const float *>(s + ldSrc));
+                                __m128 row2 = _mm_loadu_ps(reinterpret_cast<const float *>(s + (2 * ldSrc)));
+                                __m128 row3 = _mm_loadu_ps(reinterpret_cast<const float *>(s + (3 * ldSrc)));
+                                _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+                                T *d = dst + ((c0 + j) * ldDst) + r0 + i;
+                                _mm_storeu_ps(reinterpret_cast<float *>(d), row0);
+                                _mm_storeu_ps(reinterpret_cast<float *>(d + ldDst), row1);
+                                _mm_storeu_ps(reinterpret_cast<float *>(d + (2 * ldDst)), row2);
+                                _mm_storeu_ps(reinterpret_cast<float *>(d + (3 * ldDst)), row3);
+                            }
+                        }
+                        continue;
+                    }
+#endif
+                    T tile[S][S];
+                    for (size_t i = 0; i < S; ++i)
+                    {
+                        const T *srcRow = src + ((r0 + i) * ldSrc) + c0;
+                        for (size_t j = 0; j < S; ++j)
+                        {
+                            tile[j][i] = srcRow[j];
+                        }
+                    }
+                    for (size_t j = 0; j < S; ++j)
+                    {
+                        T *dstRow = dst + ((c0 + j) * ldDst) + r0;
+                        for (size_t i = 0; i < S; ++i)
+                        {
+                            dstRow[i] = tile[j][i];
+                        }
+                    }
+                }
+                else
+                {
+                    const size_t rowEnd = std::min(rows, r0 + S);
+                    const size_t colEnd = std::min(cols, c0 + S);
+                    for (size_t r = r0; r < rowEnd; ++r)
+                    {
+                        for (size_t c = c0; c < colEnd; ++c)
+                        {
+                            dst[(c * ldDst) + r] = src[(r * ldSrc) + c];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Cache-oblivious copy of rows x cols block between two different memory layouts.
+     * Larger dimension is halved until the block fits into the cache, so both source and destination
+     * are accessed in cache friendly blocks regardless of their strides.
+     */
+    template<typename T>
+    void strided_copy_recursive(const size_t rows, const size_t cols,
+                                const T *src, const std::ptrdiff_t rsSrc, const std::ptrdiff_t csSrc,
+                                T *dst, const std::ptrdiff_t rsDst, const std::ptrdiff_t csDst)
+    {
+        if (rows <= TransposeBlockSize && cols <= TransposeBlockSize)
+        {
+            if (csSrc == 1 && rsDst == 1 && rsSrc > 0 && csDst > 0)
+            {
+                transpose_block(rows, cols, src, static_cast<size_t>(rsSrc), dst, static_cast<size_t>(csDst));
+            }
+            else if (rsSrc == 1 && csDst == 1 && csSrc > 0 && rsDst > 0)
+            {
+                transpose_block(cols, rows, src, static_cast<size_t>(csSrc), dst, static_cast<size_t>(rsDst));
+            }
+            else if (csSrc == 1 || csDst == 1)
+            {
+                // Walk along the continuous rows.
+                for (size_t r = 0; r < rows; ++r)
+                {
+                    const T *srcRow = src + (static_cast<std::ptrdiff_t>(r) * rsSrc);
+                    T *dstRow = dst + (static_cast<std::ptrdiff_t>(r) * rsDst);
+                    for (size_t c = 0; c < cols; ++c)
+                    {
+                        dstRow[static_cast<std::ptrdiff_t>(c) * csDst] = srcRow[static_cast<std::ptrdiff_t>(c) * csSrc];
+                    }
+                }
+            }
+            else
+            {
+                // Walk along the continuous columns.
+                for (size_t c = 0; c < cols; ++c)
+                {
+                    const T *srcCol = src + (static_cast<std::ptrdiff_t>(c) * csSrc);
+                    T *dstCol = dst + (static_cast<std::ptrdiff_t>(c) * csDst);
+                    for (size_t r = 0; r < rows; ++r)
+                    {
+                        dstCol[static_cast<std::ptrdiff_t>(r) * rsDst] = srcCol[static_cast<std::ptrdiff_t>(r) * rsSrc];
+                    }
+                }
+            }
+            return;
+        }
+
+        if (rows >= cols)
+        {
+            const size_t half = rows / 2;
+            strided_copy_recursive(half, cols, src, rsSrc, csSrc, dst, rsDst, csDst);
+            strided_copy_recursive(rows - half, cols,
+                                   src + (static_cast<std::ptrdiff_t>(half) * rsSrc), rsSrc, csSrc,
+                                   dst + (static_cast<std::ptrdiff_t>(half) * rsDst), rsDst, csDst);
+        }
+        else
+        {
+            const size_t half = cols / 2;
+            strided_copy_recursive(rows, half, src, rsSrc, csSrc, dst, rsDst, csDst);
+            strided_copy_recursive(rows, cols - half,
+                                   src + (static_cast<std::ptrdiff_t>(half) * csSrc), rsSrc, csSrc,
+                                   dst + (static_cast<std::ptrdiff_t>(half) * csDst), rsDst, csDst);
+        }
+    }
+
+    /**
+     * Copy rows x cols matrix between memory layouts described by row and column strides.
+     * Transposition is a copy with swapped destination strides.
+     * Large matrices are split into bands of rows, which are copied in parallel.
+     */
+    template<typename T>
+    void strided_copy(const size_t rows, const size_t cols,
+                      const T *src, const std::ptrdiff_t rsSrc, const std::ptrdiff_t csSrc,
+                      T *dst, const std::ptrdiff_t rsDst, const std::ptrdiff_t csDst,
+                      const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        const size_t count = rows * cols;
+        if (count == 0)
+        {
+            return;
+        }
+        const size_t chunkSize = parallel_chunk_size<T>(count, policy);
+        if (chunkSize >= count || rows < 2)
+        {
+            strided_copy_recursive(rows, cols, src, rsSrc, csSrc, dst, rsDst, csDst);
+            return;
+        }
+
+        // Bands are multiples of the block size, so neighbouring bands don't share the destination blocks.
+        size_t bandRows = std::max<size_t>(1, chunkSize / cols);
+        bandRows = ((bandRows + TransposeBlockSize - 1) / TransposeBlockSize) * TransposeBlockSize;
+        const size_t bandCount = (rows + bandRows - 1) / bandRows;
+        ThreadPool::global().run(bandCount, [&](const size_t band)
+        {
+            const size_t fromRow = band * bandRows;
+            const size_t bandSize = std::min(bandRows, rows - fromRow);
+            strided_copy_recursive(bandSize, cols,
+                                   src + (static_cast<std::ptrdiff_t>(fromRow) * rsSrc), rsSrc, csSrc,
+                                   dst + (static_cast<std::ptrdiff_t>(fromRow) * rsDst), rsDst, csDst);
+        });
+    }
+
+    /**
+     * Swap block A[r0 + i][c0 + j] with A[c0 + j][r0 + i], the blocks must not overlap.
+     */
+    template<typename T>
+    void transpose_swap_blocks(T *data, const size_t ld, const size_t r0, const size_t c0,
+                               const size_t rows, const size_t cols)
+    {
+        if (rows <= TransposeBlockSize && cols <= TransposeBlockSize)
+        {
+            for (size_t i = r0; i < r0 + rows; ++i)
+            {
+                for (size_t j = c0; j < c0 + cols; ++j)
+                {
+                    std::swap(data[(i * ld) + j], data[(j * ld) + i]);
+                }
+            }
+            return;
+        }
+        if (rows >= cols)
+        {
+            const size_t half = rows / 2;
+            transpose_swap_blocks(data, ld, r0, c0, half, cols);
+            transpose_swap_blocks(data, ld, r0 + half, c0, rows - half, cols);
+        }
+        else
+        {
+            const size_t half = cols / 2;
+            transpose_swap_blocks(data, ld, r0, c0, rows, half);
+            transpose_swap_blocks(data, ld, r0, c0 + half, rows, cols - half);
+        }
+    }
+
+    /**
+     * Cache-oblivious in-place transposition of the diagonal block of size n starting at [from, from].
+     */
+    template<typename T>
+    void transpose_square_recursive(T *data, const size_t ld, const size_t from, const size_t n)
+    {
+        if (n <= TransposeBlockSize)
+        {
+            for (size_t i = from; i < from + n; ++i)
+            {
+                for (size_t j = i + 1; j < from + n; ++j)
+                {
+                    std::swap(data[(i * ld) + j], data[(j * ld) + i]);
+                }
+            }
+            return;
+        }
+        const size_t half = n / 2;
+        transpose_square_recursive(data, ld, from, half);
+        transpose_square_recursive(data, ld, from + half, n - half);
+        transpose_swap_blocks(data, ld, from, from + half, half, n - half);
+    }
+
+    /**
+     * Transpose square n x n matrix in place, without any allocation.
+     * @param data Matrix data, same for row and column based storage.
+     * @param n Matrix dimension.
+     */
+    template<typename T>
+    void transpose_square_in_place(T *data, const size_t n)
+    {
+        transpose_square_recursive(data, n, 0, n);
+    }
+}
@@ -2,18 +2,40 @@
 
 #include <azgra/azgra.h>
 #include <azgra/utilities/custom_advancement_iterator.h>
+#include <azgra/linalg/gemm.h>
+#include <azgra/linalg/transpose.h>
+#include <azgra/matrix_expression.h>
+#include <azgra/matrix_view.h>
+#include <azgra/utilities/allocators.h>
+#include <azgra/utilities/parallel.h>
+#include <cmath>
 
 namespace azgra
 {
+    /**
+     * Tag of the Matrix constructor, which doesn't initialize the elements, because the caller overwrites
+     * all of them. Elements of trivial types stay uninitialized with the library allocators,
+     * other allocators value-initialize them.
+     */
+    struct MatrixUninitializedTag
+    {
+    };
+
+    inline constexpr MatrixUninitializedTag MatrixUninitialized{};
+
     /**
      * Matrix data structure. Elements are accessible through row and column indices.
      * @tparam T Type of matrix element.
      * @tparam RowBased True if elements are saved by rows, otherwise elements are saved by columns.
+     * @tparam Allocator Allocator of the matrix data. Default std::allocator keeps get_data() and the data-moving
+     *                   constructor compatible with std::vector<T>. AlignedAllocator<T> (see AlignedMatrix) aligns data
+     *                   for SIMD, PoolAllocator<T> recycles buffers of the temporary matrices. Only these two skip
+     *                   the zeroing of MatrixUninitialized matrices.
      */
-    template<typename T, bool RowBased = true>
-    class Matrix
+    template<typename T, bool RowBased = true, typename Allocator = std::allocator<T>>
+    class Matrix : public MatrixExpression<Matrix<T, RowBased, Allocator>>
     {
-        template<typename U, bool SaveByRow_>
+        template<typename U, bool SaveByRow_, typename Allocator_>
         friend
         class Matrix;
 
@@ -31,7 +53,7 @@ namespace azgra
         /**
          * Matrix data.
          */
-        std::vector<T> m_data;
+        std::vector<T, Allocator> m_data;
 
 
         /**
@@ -73,7 +95,73 @@ namespace azgra
             }
         }
 
+        /**
+         * Distance between two consecutive rows in the 1d vector.
+         * @return Row stride.
+         */
+        [[nodiscard]] constexpr std::ptrdiff_t row_stride() const
+        {
+            return RowBased ? static_cast<std::ptrdiff_t>(m_colCount) : 1;
+        }
+
+        /**
+         * Distance between two consecutive columns in the 1d vector.
+         * @return Column stride.
+         */
+        [[nodiscard]] constexpr std::ptrdiff_t col_stride() const
+        {
+            return RowBased ? 1 : static_cast<std::ptrdiff_t>(m_rowCount);
+        }
+
+        /**
+         * Check whether the expression is evaluated in single flat loop over the matrix data.
+         * Expressions with views or operands of other storage order are evaluated by rows and columns.
+         */
+        template<typename E>
+        static constexpr bool is_linear_expression()
+        {
+            using Operand = MatrixOperandType<E>;
+            return Operand::IsLinear && (Operand::IsRowBased == RowBased);
+        }
+
+        /**
+         * Evaluate the expression in single pass into the matrix data. Dimensions must already match.
+         * Linear expression computes every element only from the elements at the same index, so it can
+         * reference this matrix.
+         * @param expression Matrix expression.
+         * @param policy Execution policy of the evaluation.
+         */
+        template<typename E>
+        void evaluate(const MatrixExpression<E> &expression, const ExecutionPolicy policy)
+        {
+            using Operand = MatrixOperandType<E>;
+            static_assert(std::is_convertible<typename Operand::ValueType, T>::value,
+                          "Matrix expression element type is not convertible to T.");
+
+            const Operand operand = as_operand(expression);
+            always_assert(operand.rows() == m_rowCount && operand.cols() == m_colCount);
+            T *r = m_data.data();
+            if constexpr (is_linear_expression<E>())
+            {
+                parallel_for<T>(m_data.size(), policy, [r, &operand](const size_t from, const size_t to)
+                {
+                    for (size_t i = from; i < to; ++i)
+                    {
+                        r[i] = static_cast<T>(operand.element(i));
+                    }
+                });
+            }
+            else
+            {
+                evaluate_strided(operand, r, m_rowCount, m_colCount, row_stride(), col_stride(), policy);
+            }
+        }
+
     public:
+        using ValueType = T;
+        using AllocatorType = Allocator;
+        static constexpr bool IsRowBased = RowBased;
+
         /**
          * Default constructor, without any initialization.
          */
@@ -83,11 +171,11 @@ namespace azgra
          * Copy constructor, copy the vector data.
          * @param copySrc Source matrix.
          */
-        explicit Matrix(const Matrix<T> &copySrc)
+        explicit Matrix(const Matrix &copySrc)
         {
             m_rowCount = copySrc.m_rowCount;
             m_colCount = copySrc.m_colCount;
-            m_data = std::vector<T>(copySrc.m_data.begin(), copySrc.m_data.end());
+            m_data = std::vector<T, Allocator>(copySrc.m_data.begin(), copySrc.m_data.end());
         }
 
         /**
@@ -111,7 +199,7 @@ namespace azgra
         {
             m_rowCount = dimensionSize;
             m_colCount = dimensionSize;
-            m_data.resize(dimensionSize * dimensionSize);
+            m_data.resize(dimensionSize * dimensionSize, T());
         }
 
         /**
@@ -120,6 +208,18 @@ namespace azgra
          * @param colCount Matrix column count.
          */
         explicit Matrix(size_t rowCount, size_t colCount)
+        {
+            this->m_rowCount = rowCount;
+            this->m_colCount = colCount;
+            m_data.resize(rowCount * colCount, T());
+        }
+
+        /**
+         * Initialize matrix by dimensions, without initializing the elements. Caller must overwrite all of them.
+         * @param rowCount Matrix row count.
+         * @param colCount Matrix column count.
+         */
+        explicit Matrix(size_t rowCount, size_t colCount, MatrixUninitializedTag)
         {
             this->m_rowCount = rowCount;
             this->m_colCount = colCount;
@@ -131,14 +231,17 @@ namespace azgra
          * @param rowCount Matrix row count.
          * @param colCount Matrix column count.
          * @param initialValue Value set for all elements.
+         * @param policy Execution policy of the fill.
          */
-        explicit Matrix(size_t rowCount, size_t colCount, const T &initialValue) : Matrix(rowCount, colCount)
+        explicit Matrix(size_t rowCount, size_t colCount, const T &initialValue,
+                        const ExecutionPolicy policy = ExecutionPolicy_Parallel) :
+                Matrix(rowCount, colCount, MatrixUninitialized)
         {
-            const size_t dataCount = rowCount * colCount;
-            for (size_t i = 0; i < dataCount; ++i)
+            T *data = m_data.data();
+            parallel_for<T>(m_data.size(), policy, [data, &initialValue](const size_t from, const size_t to)
             {
-                m_data[i] = initialValue;
-            }
+                std::fill(data + from, data + to, initialValue);
+            });
         }
 
         explicit Matrix(size_t rowCount, size_t colCount, std::initializer_list<T> initializerList)
@@ -146,21 +249,85 @@ namespace azgra
             this->m_rowCount = rowCount;
             this->m_colCount = colCount;
             always_assert((rowCount * colCount) == initializerList.size());
-            m_data = std::vector<T>(initializerList.begin(), initializerList.end());
+            m_data = std::vector<T, Allocator>(initializerList.begin(), initializerList.end());
         }
 
         /**
          * Initialize matrix by dimensions and move the initial data.
+         * Only vector with the same allocator is moved without copy. Data of vector with other allocator
+         * is copied element by element and the vector is cleared.
          * @param rowCount Matrix row count.
          * @param colCount Matrix column count.
          * @param dataToMove Initial data to be moved to this matrix.
          */
-        explicit Matrix(size_t rowCount, size_t colCount, std::vector<T> &dataToMove)
+        template<typename VectorAllocator>
+        explicit Matrix(size_t rowCount, size_t colCount, std::vector<T, VectorAllocator> &dataToMove)
         {
             this->m_rowCount = rowCount;
             this->m_colCount = colCount;
             always_assert((rowCount * colCount) == dataToMove.size());
-            m_data = std::move(dataToMove);
+            if constexpr (std::is_same<VectorAllocator, Allocator>::value)
+            {
+                m_data = std::move(dataToMove);
+            }
+            else
+            {
+                m_data = std::vector<T, Allocator>(std::make_move_iterator(dataToMove.begin()),
+                                                   std::make_move_iterator(dataToMove.end()));
+                dataToMove.clear();
+            }
+        }
+
+        /**
+         * Evaluate the matrix expression into new matrix, in single fused pass.
+         * @param expression Matrix expression, for example `a + b * 2`.
+         * @param policy Execution policy of the evaluation.
+         */
+        template<typename E, typename = std::enable_if_t<!IsMatrix<E>::value>>
+        Matrix(const MatrixExpression<E> &expression, const ExecutionPolicy policy = ExecutionPolicy_Parallel) :
+                Matrix(expression.derived().rows(), expression.derived().cols(), MatrixUninitialized)
+        {
+            evaluate(expression, policy);
+        }
+
+        /**
+         * Assign the evaluated matrix expression. Expression can reference this matrix, e.g. `a = a + b`.
+         * @param expression Matrix expression.
+         * @return Reference to this matrix.
+         */
+        template<typename E, typename = std::enable_if_t<!IsMatrix<E>::value>>
+        Matrix &operator=(const MatrixExpression<E> &expression)
+        {
+            return assign(expression);
+        }
+
+        /**
+         * Assign the evaluated matrix expression. Expression can reference this matrix, e.g. `a = a + b`
+         * or `a = a.transpose_view() * 2`. Storage is reused when the dimensions match, temporary matrix is used
+         * only for the non-linear expression reading this matrix.
+         * @param expression Matrix expression.
+         * @param policy Execution policy of the evaluation.
+         * @return Reference to this matrix.
+         */
+        template<typename E>
+        Matrix &assign(const MatrixExpression<E> &expression, const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+        {
+            const E &derived = expression.derived();
+            const bool sameShape = (derived.rows() == m_rowCount && derived.cols() == m_colCount);
+            // Linear expression reads only the element it writes. Other expression reading our data could
+            // read already overwritten elements, e.g. `a = a.transpose_view()`.
+            if (sameShape && (is_linear_expression<E>() ||
+                              !as_operand(expression).references(m_data.data(), m_data.data() + m_data.size())))
+            {
+                evaluate(expression, policy);
+            }
+            else
+            {
+                Matrix result(derived.rows(), derived.cols(), MatrixUninitialized);
+                result.evaluate(expression, policy);
+                *this = std::move(result);
+            }
+            return *this;
         }
 
         /**
@@ -364,68 +531,345 @@ namespace azgra
             }
         }
 
+        /**
+         * Get mutable view of the whole matrix.
+         * @return Matrix view.
+         */
+        MatrixView<T> view()
+        {
+            return MatrixView<T>(m_data.data(), m_rowCount, m_colCount, row_stride(), col_stride());
+        }
+
+        /**
+         * Get read-only view of the whole matrix.
+         * @return Matrix view.
+         */
+        MatrixView<const T> view() const
+        {
+            return MatrixView<const T>(m_data.data(), m_rowCount, m_colCount, row_stride(), col_stride());
+        }
+
+        /**
+         * Get view of the rectangular block, without copying the elements.
+         * @param row Row of the block's first element.
+         * @param col Column of the block's first element.
+         * @param rowCount Number of rows of the block.
+         * @param colCount Number of columns of the block.
+         * @return Block view.
+         */
+        MatrixView<T> block(const size_t row, const size_t col, const size_t rowCount, const size_t colCount)
+        {
+            return view().block(row, col, rowCount, colCount);
+        }
+
+        MatrixView<const T> block(const size_t row, const size_t col, const size_t rowCount, const size_t colCount) const
+        {
+            return view().block(row, col, rowCount, colCount);
+        }
+
+        /**
+         * Get 1 x cols view of the row, without copying the elements.
+         * @param row Zero based row index.
+         * @return Row view.
+         */
+        MatrixView<T> row_view(const size_t row)
+        {
+            return view().row_view(row);
+        }
+
+        MatrixView<const T> row_view(const size_t row) const
+        {
+            return view().row_view(row);
+        }
+
+        /**
+         * Get rows x 1 view of the column, without copying the elements.
+         * @param col Zero based column index.
+         * @return Column view.
+         */
+        MatrixView<T> col_view(const size_t col)
+        {
+            return view().col_view(col);
+        }
+
+        MatrixView<const T> col_view(const size_t col) const
+        {
+            return view().col_view(col);
+        }
+
+        /**
+         * Get transposed view of the matrix, without copying the elements.
+         * @return Transposed view.
+         */
+        MatrixView<T> transpose_view()
+        {
+            return view().transpose();
+        }
+
+        MatrixView<const T> transpose_view() const
+        {
+            return view().transpose();
+        }
+
         /**
          * Check whether two matrices are same. All their values are equal.
          * @param mat Another matrix.
+         * @param policy Execution policy of the comparison.
          * @return True if dimensions match and all values are equal.
          */
-        bool equals(const Matrix &mat) const
+        bool equals(const Matrix &mat, const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
         {
             if (mat.m_rowCount != m_rowCount || mat.m_colCount != m_colCount)
             {
                 return false;
             }
-            const size_t dataCount = (m_rowCount * m_colCount);
-            for (size_t i = 0; i < dataCount; ++i)
-            {
-                if (m_data[i] != mat.m_data[i])
-                {
-                    return false;
-                }
-            }
-            return true;
+            const T *a = m_data.data();
+            const T *b = mat.m_data.data();
+            return parallel_reduce<T>(m_data.size(), policy, true,
+                                      [a, b](const size_t from, const size_t to, const bool)
+                                      {
+                                          return std::equal(a + from, a + to, b + from);
+                                      },
+                                      [](const bool x, const bool y)
+                                      { return x && y; });
+        }
+
+        /**
+         * Element-wise sum of two matrices.
+         * @param other Matrix of the same dimensions.
+         * @param policy Execution policy of the operation.
+         * @return New matrix with summed elements.
+         */
+        Matrix add(const Matrix &other, const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            return Matrix(*this + other, policy);
         }
 
-        Matrix<T> operator+(const Matrix &other) const
+        /**
+         * Element-wise difference of two matrices.
+         * @param other Matrix of the same dimensions.
+         * @param policy Execution policy of the operation.
+         * @return New matrix with subtracted elements.
+         */
+        Matrix subtract(const Matrix &other, const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
         {
-            always_assert(m_rowCount == other.m_rowCount && m_colCount == other.m_colCount);
-            Matrix<T> result(m_rowCount, m_colCount);
-            for (size_t i = 0; i < (m_rowCount * m_colCount); ++i)
-            {
-                result.m_data[i] = m_data[i] + other.m_data[i];
-            }
+            return Matrix(*this - other, policy);
+        }
+
+        /**
+         * Add elements of another matrix or expression to this matrix.
+         * @param other Matrix or matrix expression of the same dimensions.
+         * @param policy Execution policy of the operation.
+         * @return Reference to this matrix.
+         */
+        template<typename E>
+        Matrix &add_in_place(const MatrixExpression<E> &other, const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+        {
+            return assign(*this + other, policy);
+        }
+
+        /**
+         * Subtract elements of another matrix or expression from this matrix.
+         * @param other Matrix or matrix expression of the same dimensions.
+         * @param policy Execution policy of the operation.
+         * @return Reference to this matrix.
+         */
+        template<typename E>
+        Matrix &subtract_in_place(const MatrixExpression<E> &other,
+                                  const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+        {
+            return assign(*this - other, policy);
+        }
+
+        template<typename E>
+        Matrix &operator+=(const MatrixExpression<E> &other)
+        {
+            return add_in_place(other);
+        }
+
+        template<typename E>
+        Matrix &operator-=(const MatrixExpression<E> &other)
+        {
+            return subtract_in_place(other);
+        }
+
+        /**
+         * Sum of all matrix elements.
+         * @param policy Execution policy of the reduction.
+         * @return Sum of elements.
+         */
+        T sum(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            const T *a = m_data.data();
+            return parallel_reduce<T>(m_data.size(), policy, T{},
+                                      [a](const size_t from, const size_t to, T partial)
+                                      {
+                                          for (size_t i = from; i < to; ++i)
+                                          {
+                                              partial += a[i];
+                                          }
+                                          return partial;
+                                      },
+                                      [](const T &x, const T &y)
+                                      { return x + y; });
+        }
+
+        /**
+         * Smallest matrix element. Matrix must not be empty.
+         * @param policy Execution policy of the reduction.
+         * @return Minimal value.
+         */
+        T min(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            always_assert(!m_data.empty());
+            const T *a = m_data.data();
+            return parallel_reduce<T>(m_data.size(), policy, a[0],
+                                      [a](const size_t from, const size_t to, T partial)
+                                      {
+                                          for (size_t i = from; i < to; ++i)
+                                          {
+                                              partial = (a[i] < partial) ? a[i] : partial;
+                                          }
+                                          return partial;
+                                      },
+                                      [](const T &x, const T &y)
+                                      { return (y < x) ? y : x; });
+        }
+
+        /**
+         * Largest matrix element. Matrix must not be empty.
+         * @param policy Execution policy of the reduction.
+         * @return Maximal value.
+         */
+        T max(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            always_assert(!m_data.empty());
+            const T *a = m_data.data();
+            return parallel_reduce<T>(m_data.size(), policy, a[0],
+                                      [a](const size_t from, const size_t to, T partial)
+                                      {
+                                          for (size_t i = from; i < to; ++i)
+                                          {
+                                              partial = (partial < a[i]) ? a[i] : partial;
+                                          }
+                                          return partial;
+                                      },
+                                      [](const T &x, const T &y)
+                                      { return (x < y) ? y : x; });
+        }
+
+        /**
+         * Frobenius norm, square root of the sum of squared elements.
+         * @param policy Execution policy of the reduction.
+         * @return Matrix norm.
+         */
+        f64 norm(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            const T *a = m_data.data();
+            const f64 squareSum = parallel_reduce<T>(m_data.size(), policy, 0.0,
+                                                     [a](const size_t from, const size_t to, f64 partial)
+                                                     {
+                                                         for (size_t i = from; i < to; ++i)
+                                                         {
+                                                             const f64 value = static_cast<f64>(a[i]);
+                                                             partial += value * value;
+                                                         }
+                                                         return partial;
+                                                     },
+                                                     [](const f64 x, const f64 y)
+                                                     { return x + y; });
+            return std::sqrt(squareSum);
+        }
+
+        /**
+         * Create transposed matrix with the same storage order, using cache-oblivious blocked copy.
+         * @param policy Execution policy of the copy.
+         * @return Transposed matrix.
+         */
+        Matrix transpose(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            Matrix result(m_colCount, m_rowCount, MatrixUninitialized);
+            // Element (row, col) is written to (col, row) of the result, which is a copy with swapped strides.
+            linalg::strided_copy(m_rowCount, m_colCount, m_data.data(), row_stride(), col_stride(),
+                                 result.m_data.data(), result.col_stride(), result.row_stride(), policy);
             return result;
         }
 
-        Matrix<T> &operator+=(const Matrix &other)
+        /**
+         * Transpose square matrix in place, without any allocation.
+         */
+        void transpose_in_place()
         {
-            always_assert(m_rowCount == other.m_rowCount && m_colCount == other.m_colCount);
-            for (size_t i = 0; i < (m_rowCount * m_colCount); ++i)
-            {
-                m_data[i] += other.m_data[i];
-            }
-            return *this;
+            always_assert(m_rowCount == m_colCount && "In-place transposition requires square matrix.");
+            linalg::transpose_square_in_place(m_data.data(), m_rowCount);
         }
 
-        Matrix<T> operator-(const Matrix &other) const
+        /**
+         * Copy the matrix into the requested storage order, using cache-oblivious blocked copy.
+         * @tparam TargetRowBased Storage order of the result.
+         * @param policy Execution policy of the copy.
+         * @return Same matrix, stored by rows if TargetRowBased is true, otherwise by columns.
+         */
+        template<bool TargetRowBased>
+        Matrix<T, TargetRowBased, Allocator> to_layout(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const &
         {
-            always_assert(m_rowCount == other.m_rowCount && m_colCount == other.m_colCount);
-            Matrix<T> result(m_rowCount, m_colCount);
-            for (size_t i = 0; i < (m_rowCount * m_colCount); ++i)
-            {
-                result.m_data[i] = m_data[i] - other.m_data[i];
-            }
+            Matrix<T, TargetRowBased, Allocator> result(m_rowCount, m_colCount, MatrixUninitialized);
+            linalg::strided_copy(m_rowCount, m_colCount, m_data.data(), row_stride(), col_stride(),
+                                 result.m_data.data(), result.row_stride(), result.col_stride(), policy);
             return result;
         }
 
-        Matrix<T> &operator-=(const Matrix &other)
+        /**
+         * Convert the matrix into the requested storage order. Square matrices are converted in place,
+         * their data is transposed and moved into the result without any allocation.
+         * @tparam TargetRowBased Storage order of the result.
+         * @param policy Execution policy of the copy of non-square matrix.
+         * @return Same matrix, stored by rows if TargetRowBased is true, otherwise by columns.
+         */
+        template<bool TargetRowBased>
+        Matrix<T, TargetRowBased, Allocator> to_layout(const ExecutionPolicy policy = ExecutionPolicy_Parallel) &&
         {
-            always_assert(m_rowCount == other.m_rowCount && m_colCount == other.m_colCount);
-            for (size_t i = 0; i < (m_rowCount * m_colCount); ++i)
+            if (m_rowCount != m_colCount)
             {
-                m_data[i] -= other.m_data[i];
+                return static_cast<const Matrix &>(*this).template to_layout<TargetRowBased>(policy);
             }
-            return *this;
+            if (TargetRowBased != RowBased)
+            {
+                // Transposed storage of the square matrix is the same matrix in the other storage order.
+                linalg::transpose_square_in_place(m_data.data(), m_rowCount);
+            }
+            Matrix<T, TargetRowBased, Allocator> result;
+            result.m_rowCount = m_rowCount;
+            result.m_colCount = m_colCount;
+            result.m_data = std::move(m_data);
+            m_rowCount = 0;
+            m_colCount = 0;
+            return result;
+        }
+
+        /**
+         * Multiply this matrix by another matrix, using cache blocked kernel. Both matrices can have any storage order.
+         * @tparam OtherRowBased Storage order of the right hand side matrix.
+         * @tparam OtherAllocator Allocator of the right hand side matrix.
+         * @param other Right hand side matrix, its row count must match column count of this matrix.
+         * @return Matrix product with the same storage order and allocator as this matrix.
+         */
+        template<bool OtherRowBased, typename OtherAllocator>
+        Matrix multiply(const Matrix<T, OtherRowBased, OtherAllocator> &other) const
+        {
+            always_assert(m_colCount == other.m_rowCount);
+            Matrix result(m_rowCount, other.m_colCount);
+            linalg::gemm(m_rowCount, other.m_colCount, m_colCount,
+                         m_data.data(), row_stride(), col_stride(),
+                         other.m_data.data(), other.row_stride(), other.col_stride(),
+                         result.m_data.data(), result.row_stride(), result.col_stride());
+            return result;
+        }
+
+        template<bool OtherRowBased, typename OtherAllocator>
+        Matrix operator*(const Matrix<T, OtherRowBased, OtherAllocator> &other) const
+        {
+            return multiply(other);
         }
 
         bool operator==(const Matrix &other) const
@@ -502,9 +946,15 @@ namespace azgra
          * Get constant reference to the matrix data.
          * @return Constant reference to vector data.
          */
-        std::vector<T> const &get_data() const
+        std::vector<T, Allocator> const &get_data() const
         {
             return m_data;
         }
     };
+
+    /**
+     * Matrix with the data aligned to SimdAlignment bytes.
+     */
+    template<typename T, bool RowBased = true>
+    using AlignedMatrix = Matrix<T, RowBased, AlignedAllocator<T>>;
 }
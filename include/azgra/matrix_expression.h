@@ -0,0 +1,402 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <azgra/utilities/parallel.h>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace azgra
+{
+    template<typename T, bool RowBased, typename Allocator>
+    class Matrix;
+
+    /**
+     * Base of all lazy matrix expressions. Expression is evaluated element by element, in single pass,
+     * when it is assigned into the Matrix.
+     *
+     * Expressions hold references to matrices, so they must not outlive them. Store result into the Matrix
+     * instead of keeping `auto expr = a + b` around.
+     *
+     * Every expression provides element(row, col). Expressions built only from continuous matrices of the same
+     * storage order are also linear (IsLinear), they provide element(index) and are evaluated in one flat loop.
+     * references(begin, end) tells whether the expression reads any memory in [begin, end).
+     * @tparam Derived Type of the concrete expression.
+     */
+    template<typename Derived>
+    struct MatrixExpression
+    {
+        const Derived &derived() const noexcept
+        {
+            return static_cast<const Derived &>(*this);
+        }
+    };
+
+    /**
+     * Check whether the memory ranges [aBegin, aEnd) and [bBegin, bEnd) overlap.
+     */
+    inline bool memory_overlaps(const void *aBegin, const void *aEnd, const void *bBegin, const void *bEnd)
+    {
+        const std::less<const void *> less;
+        return less(aBegin, bEnd) && less(bBegin, aEnd);
+    }
+
+    template<typename E>
+    struct IsMatrix : std::false_type
+    {
+    };
+
+    template<typename T, bool RowBased, typename Allocator>
+    struct IsMatrix<Matrix<T, RowBased, Allocator>> : std::true_type
+    {
+    };
+
+    /**
+     * Leaf of the expression tree, referencing data of the Matrix.
+     */
+    template<typename T, bool RowBased>
+    class MatrixLeafExpression : public MatrixExpression<MatrixLeafExpression<T, RowBased>>
+    {
+    private:
+        const T *m_data;
+        size_t m_rowCount;
+        size_t m_colCount;
+    public:
+        using ValueType = T;
+        static constexpr bool IsRowBased = RowBased;
+        static constexpr bool IsLinear = true;
+
+        MatrixLeafExpression(const T *data, const size_t rowCount, const size_t colCount) :
+                m_data(data), m_rowCount(rowCount), m_colCount(colCount)
+        {
+        }
+
+        [[nodiscard]] size_t rows() const noexcept
+        { return m_rowCount; }
+
+        [[nodiscard]] size_t cols() const noexcept
+        { return m_colCount; }
+
+        [[nodiscard]] bool references(const void *begin, const void *end) const
+        {
+            return memory_overlaps(m_data, m_data + (m_rowCount * m_colCount), begin, end);
+        }
+
+        [[nodiscard]] const T &element(const size_t index) const
+        {
+            return m_data[index];
+        }
+
+        [[nodiscard]] const T &element(const size_t row, const size_t col) const
+        {
+            if constexpr (RowBased)
+            {
+                return m_data[(row * m_colCount) + col];
+            }
+            else
+            {
+                return m_data[(col * m_rowCount) + row];
+            }
+        }
+    };
+
+    /**
+     * Type in which the expression operand is stored inside of the parent expression.
+     * Matrices are stored as leaves, other expressions by value.
+     */
+    template<typename E>
+    struct MatrixExpressionOperand
+    {
+        using Type = E;
+
+        static const E &wrap(const E &expression)
+        {
+            return expression;
+        }
+    };
+
+    template<typename T, bool RowBased, typename Allocator>
+    struct MatrixExpressionOperand<Matrix<T, RowBased, Allocator>>
+    {
+        using Type = MatrixLeafExpression<T, RowBased>;
+
+        static Type wrap(const Matrix<T, RowBased, Allocator> &matrix)
+        {
+            return Type(matrix.get_data().data(), matrix.rows(), matrix.cols());
+        }
+    };
+
+    template<typename E>
+    using MatrixOperandType = typename MatrixExpressionOperand<E>::Type;
+
+    /**
+     * Element-wise binary operation of two expressions.
+     */
+    template<typename Lhs, typename Rhs, typename Op>
+    class MatrixBinaryExpression : public MatrixExpression<MatrixBinaryExpression<Lhs, Rhs, Op>>
+    {
+    private:
+        Lhs m_lhs;
+        Rhs m_rhs;
+        Op m_op;
+    public:
+        using ValueType = typename Lhs::ValueType;
+        static constexpr bool IsRowBased = Lhs::IsRowBased;
+        // Operands of different storage order can be combined only by row and column.
+        static constexpr bool IsLinear = Lhs::IsLinear && Rhs::IsLinear && (Lhs::IsRowBased == Rhs::IsRowBased);
+
+        static_assert(std::is_same<typename Lhs::ValueType, typename Rhs::ValueType>::value,
+                      "Matrix expression operands must have same element type.");
+
+        MatrixBinaryExpression(const Lhs &lhs, const Rhs &rhs, const Op &op = Op()) : m_lhs(lhs), m_rhs(rhs), m_op(op)
+        {
+            always_assert(lhs.rows() == rhs.rows() && lhs.cols() == rhs.cols());
+        }
+
+        [[nodiscard]] size_t rows() const noexcept
+        { return m_lhs.rows(); }
+
+        [[nodiscard]] size_t cols() const noexcept
+        { return m_lhs.cols(); }
+
+        [[nodiscard]] bool references(const void *begin, const void *end) const
+        {
+            return m_lhs.references(begin, end) || m_rhs.references(begin, end);
+        }
+
+        [[nodiscard]] ValueType element(const size_t index) const
+        {
+            return m_op(m_lhs.element(index), m_rhs.element(index));
+        }
+
+        [[nodiscard]] ValueType element(const size_t row, const size_t col) const
+        {
+            return m_op(m_lhs.element(row, col), m_rhs.element(row, col));
+        }
+    };
+
+    /**
+     * Element-wise operation of the expression and a scalar value.
+     */
+    template<typename E, typename Op>
+    class MatrixScalarExpression : public MatrixExpression<MatrixScalarExpression<E, Op>>
+    {
+    public:
+        using ValueType = typename E::ValueType;
+        static constexpr bool IsRowBased = E::IsRowBased;
+        static constexpr bool IsLinear = E::IsLinear;
+    private:
+        E m_expression;
+        ValueType m_scalar;
+        Op m_op;
+    public:
+        MatrixScalarExpression(const E &expression, const ValueType &scalar, const Op &op = Op()) :
+                m_expression(expression), m_scalar(scalar), m_op(op)
+        {
+        }
+
+        [[nodiscard]] size_t rows() const noexcept
+        { return m_expression.rows(); }
+
+        [[nodiscard]] size_t cols() const noexcept
+        { return m_expression.cols(); }
+
+        [[nodiscard]] bool references(const void *begin, const void *end) const
+        {
+            return m_expression.references(begin, end);
+        }
+
+        [[nodiscard]] ValueType element(const size_t index) const
+        {
+            return m_op(m_expression.element(index), m_scalar);
+        }
+
+        [[nodiscard]] ValueType element(const size_t row, const size_t col) const
+        {
+            return m_op(m_expression.element(row, col), m_scalar);
+        }
+    };
+
+    /**
+     * Element-wise unary function applied to the expression.
+     */
+    template<typename E, typename Fn>
+    class MatrixUnaryExpression : public MatrixExpression<MatrixUnaryExpression<E, Fn>>
+    {
+    private:
+        E m_expression;
+        Fn m_fn;
+    public:
+        using ValueType = std::decay_t<decltype(std::declval<const Fn &>()(std::declval<typename E::ValueType>()))>;
+        static constexpr bool IsRowBased = E::IsRowBased;
+        static constexpr bool IsLinear = E::IsLinear;
+
+        MatrixUnaryExpression(const E &expression, const Fn &fn) : m_expression(expression), m_fn(fn)
+        {
+        }
+
+        [[nodiscard]] size_t rows() const noexcept
+        { return m_expression.rows(); }
+
+        [[nodiscard]] size_t cols() const noexcept
+        { return m_expression.cols(); }
+
+        [[nodiscard]] bool references(const void *begin, const void *end) const
+        {
+            return m_expression.references(begin, end);
+        }
+
+        [[nodiscard]] ValueType element(const size_t index) const
+        {
+            return m_fn(m_expression.element(index));
+        }
+
+        [[nodiscard]] ValueType element(const size_t row, const size_t col) const
+        {
+            return m_fn(m_expression.element(row, col));
+        }
+    };
+
+    struct MatrixAddOp
+    {
+        template<typename T>
+        T operator()(const T &a, const T &b) const
+        { return a + b; }
+    };
+
+    struct MatrixSubtractOp
+    {
+        template<typename T>
+        T operator()(const T &a, const T &b) const
+        { return a - b; }
+    };
+
+    struct MatrixMultiplyOp
+    {
+        template<typename T>
+        T operator()(const T &a, const T &b) const
+        { return a * b; }
+    };
+
+    struct MatrixDivideOp
+    {
+        template<typename T>
+        T operator()(const T &a, const T &b) const
+        { return a / b; }
+    };
+
+    struct MatrixNegateOp
+    {
+        template<typename T>
+        T operator()(const T &a) const
+        { return -a; }
+    };
+
+    /**
+     * Evaluate the operand by rows and columns into rows x cols destination described by row and column strides.
+     * The inner loop runs along the destination dimension with smaller stride, lines are split across the threads.
+     * @param operand Expression operand of matching dimensions.
+     * @param dst Pointer to the first destination element.
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     * @param rowStride Distance between two rows of the destination.
+     * @param colStride Distance between two columns of the destination.
+     * @param policy Execution policy.
+     */
+    template<typename Operand, typename T>
+    void evaluate_strided(const Operand &operand, T *dst, const size_t rows, const size_t cols,
+                          const std::ptrdiff_t rowStride, const std::ptrdiff_t colStride,
+                          const ExecutionPolicy policy = ExecutionPolicy_Parallel)
+    {
+        if (rows == 0 || cols == 0)
+        {
+            return;
+        }
+        if (colStride <= rowStride)
+        {
+            parallel_for_lines<T>(rows, cols, policy, [&](const size_t fromRow, const size_t toRow)
+            {
+                for (size_t row = fromRow; row < toRow; ++row)
+                {
+                    T *dstRow = dst + (static_cast<std::ptrdiff_t>(row) * rowStride);
+                    for (size_t col = 0; col < cols; ++col)
+                    {
+                        dstRow[static_cast<std::ptrdiff_t>(col) * colStride] =
+                                static_cast<T>(operand.element(row, col));
+                    }
+                }
+            });
+        }
+        else
+        {
+            parallel_for_lines<T>(cols, rows, policy, [&](const size_t fromCol, const size_t toCol)
+            {
+                for (size_t col = fromCol; col < toCol; ++col)
+                {
+                    T *dstCol = dst + (static_cast<std::ptrdiff_t>(col) * colStride);
+                    for (size_t row = 0; row < rows; ++row)
+                    {
+                        dstCol[static_cast<std::ptrdiff_t>(row) * rowStride] =
+                                static_cast<T>(operand.element(row, col));
+                    }
+                }
+            });
+        }
+    }
+
+    template<typename E>
+    MatrixOperandType<E> as_operand(const MatrixExpression<E> &expression)
+    {
+        return MatrixExpressionOperand<E>::wrap(expression.derived());
+    }
+
+    template<typename Lhs, typename Rhs>
+    auto operator+(const MatrixExpression<Lhs> &lhs, const MatrixExpression<Rhs> &rhs)
+    {
+        return MatrixBinaryExpression<MatrixOperandType<Lhs>, MatrixOperandType<Rhs>, MatrixAddOp>(as_operand(lhs),
+                                                                                                  as_operand(rhs));
+    }
+
+    template<typename Lhs, typename Rhs>
+    auto operator-(const MatrixExpression<Lhs> &lhs, const MatrixExpression<Rhs> &rhs)
+    {
+        return MatrixBinaryExpression<MatrixOperandType<Lhs>, MatrixOperandType<Rhs>, MatrixSubtractOp>(as_operand(lhs),
+                                                                                                       as_operand(rhs));
+    }
+
+    template<typename E>
+    auto operator*(const MatrixExpression<E> &expression, const typename MatrixOperandType<E>::ValueType &scalar)
+    {
+        return MatrixScalarExpression<MatrixOperandType<E>, MatrixMultiplyOp>(as_operand(expression), scalar);
+    }
+
+    template<typename E>
+    auto operator*(const typename MatrixOperandType<E>::ValueType &scalar, const MatrixExpression<E> &expression)
+    {
+        return MatrixScalarExpression<MatrixOperandType<E>, MatrixMultiplyOp>(as_operand(expression), scalar);
+    }
+
+    template<typename E>
+    auto operator/(const MatrixExpression<E> &expression, const typename MatrixOperandType<E>::ValueType &scalar)
+    {
+        return MatrixScalarExpression<MatrixOperandType<E>, MatrixDivideOp>(as_operand(expression), scalar);
+    }
+
+    template<typename E>
+    auto operator-(const MatrixExpression<E> &expression)
+    {
+        return MatrixUnaryExpression<MatrixOperandType<E>, MatrixNegateOp>(as_operand(expression), MatrixNegateOp());
+    }
+
+    /**
+     * Lazily apply unary function to every element of the expression.
+     * @param expression Matrix or matrix expression.
+     * @param fn Function taking one element, its result type becomes element type of the expression.
+     * @return Unary expression.
+     */
+    template<typename E, typename Fn>
+    auto apply(const MatrixExpression<E> &expression, Fn fn)
+    {
+        return MatrixUnaryExpression<MatrixOperandType<E>, Fn>(as_operand(expression), fn);
+    }
+}
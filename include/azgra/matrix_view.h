@@ -0,0 +1,362 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <azgra/linalg/gemm.h>
+#include <azgra/matrix_expression.h>
+#include <azgra/utilities/custom_advancement_iterator.h>
+#include <azgra/utilities/parallel.h>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace azgra
+{
+    /**
+     * Non-owning strided view of matrix elements. Element (row, col) is data[row * rowStride + col * colStride],
+     * so the same type describes the whole matrix, its block, single row or column and the transposition,
+     * without copying any element.
+     *
+     * View doesn't own the data and must not outlive the viewed matrix. Constness of the view is shallow,
+     * like with pointers, use MatrixView<const T> for read-only access.
+     * Copy of the view rebinds it, use assign() to copy the elements.
+     * @tparam T Type of matrix element, const qualified for read-only view.
+     */
+    template<typename T>
+    class MatrixView : public MatrixExpression<MatrixView<T>>
+    {
+    private:
+        T *m_data = nullptr;
+        size_t m_rowCount = 0;
+        size_t m_colCount = 0;
+        std::ptrdiff_t m_rowStride = 0;
+        std::ptrdiff_t m_colStride = 0;
+
+        [[nodiscard]] T *line_end(T *start, const size_t count, const std::ptrdiff_t stride) const
+        {
+            return (count == 0) ? start : (start + (static_cast<std::ptrdiff_t>(count - 1) * stride) + 1);
+        }
+
+        [[nodiscard]] T *row_start(const size_t row) const
+        {
+            return m_data + (static_cast<std::ptrdiff_t>(row) * m_rowStride);
+        }
+
+        [[nodiscard]] T *col_start(const size_t col) const
+        {
+            return m_data + (static_cast<std::ptrdiff_t>(col) * m_colStride);
+        }
+
+    public:
+        using ValueType = std::remove_const_t<T>;
+        // View has no fixed storage order, it is evaluated by rows and columns.
+        static constexpr bool IsRowBased = true;
+        static constexpr bool IsLinear = false;
+
+        /**
+         * Create empty view.
+         */
+        MatrixView() = default;
+
+        /**
+         * Create view of the strided data.
+         * @param data Pointer to the element (0, 0).
+         * @param rowCount Number of rows.
+         * @param colCount Number of columns.
+         * @param rowStride Distance between two consecutive rows, in elements.
+         * @param colStride Distance between two consecutive columns, in elements.
+         */
+        MatrixView(T *data, const size_t rowCount, const size_t colCount,
+                   const std::ptrdiff_t rowStride, const std::ptrdiff_t colStride) :
+                m_data(data), m_rowCount(rowCount), m_colCount(colCount), m_rowStride(rowStride), m_colStride(colStride)
+        {
+            always_assert(rowStride >= 0 && colStride >= 0);
+        }
+
+        /**
+         * Read-only view of the mutable view.
+         */
+        template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value && !std::is_const<U>::value>>
+        MatrixView(const MatrixView<U> &other) :
+                m_data(other.data()), m_rowCount(other.rows()), m_colCount(other.cols()),
+                m_rowStride(other.row_stride()), m_colStride(other.col_stride())
+        {
+        }
+
+        MatrixView(const MatrixView &) = default;
+
+        MatrixView &operator=(const MatrixView &) = default;
+
+        [[nodiscard]] size_t rows() const noexcept
+        { return m_rowCount; }
+
+        [[nodiscard]] size_t cols() const noexcept
+        { return m_colCount; }
+
+        [[nodiscard]] std::ptrdiff_t row_stride() const noexcept
+        { return m_rowStride; }
+
+        [[nodiscard]] std::ptrdiff_t col_stride() const noexcept
+        { return m_colStride; }
+
+        /**
+         * Get pointer to the element (0, 0).
+         * @return Data pointer.
+         */
+        [[nodiscard]] T *data() const noexcept
+        { return m_data; }
+
+        /**
+         * Access reference of the element at given row and column.
+         * @param row Zero based row index.
+         * @param col Zero based column index.
+         * @return Reference to the matrix element.
+         */
+        T &at(const size_t row, const size_t col) const
+        {
+            return m_data[(static_cast<std::ptrdiff_t>(row) * m_rowStride) +
+                          (static_cast<std::ptrdiff_t>(col) * m_colStride)];
+        }
+
+        [[nodiscard]] const ValueType &element(const size_t row, const size_t col) const
+        {
+            return at(row, col);
+        }
+
+        [[nodiscard]] bool references(const void *begin, const void *end) const
+        {
+            if (m_rowCount == 0 || m_colCount == 0)
+            {
+                return false;
+            }
+            // Strides aren't negative, so the last element is the furthest one.
+            const T *last = &at(m_rowCount - 1, m_colCount - 1);
+            return memory_overlaps(m_data, last + 1, begin, end);
+        }
+
+        /**
+         * Get view of the rectangular block.
+         * @param row Row of the block's first element.
+         * @param col Column of the block's first element.
+         * @param rowCount Number of rows of the block.
+         * @param colCount Number of columns of the block.
+         * @return Block view.
+         */
+        [[nodiscard]] MatrixView block(const size_t row, const size_t col,
+                                       const size_t rowCount, const size_t colCount) const
+        {
+            always_assert((row + rowCount) <= m_rowCount && (col + colCount) <= m_colCount);
+            if (rowCount == 0 || colCount == 0)
+            {
+                return MatrixView(m_data, rowCount, colCount, m_rowStride, m_colStride);
+            }
+            return MatrixView(&at(row, col), rowCount, colCount, m_rowStride, m_colStride);
+        }
+
+        /**
+         * Get 1 x cols view of the row.
+         * @param row Zero based row index.
+         * @return Row view.
+         */
+        [[nodiscard]] MatrixView row_view(const size_t row) const
+        {
+            return block(row, 0, 1, m_colCount);
+        }
+
+        /**
+         * Get rows x 1 view of the column.
+         * @param col Zero based column index.
+         * @return Column view.
+         */
+        [[nodiscard]] MatrixView col_view(const size_t col) const
+        {
+            return block(0, col, m_rowCount, 1);
+        }
+
+        /**
+         * Get transposed view, which only swaps dimensions and strides.
+         * @return Transposed view.
+         */
+        [[nodiscard]] MatrixView transpose() const
+        {
+            return MatrixView(m_data, m_colCount, m_rowCount, m_colStride, m_rowStride);
+        }
+
+        /**
+         * Get constant iterator for row beginning.
+         * @param row Zero based row index.
+         * @return Constant input iterator.
+         */
+        auto row_cbegin(const size_t row) const
+        {
+            const ValueType *start = row_start(row);
+            return ConstCustomAdvancementIterator<ValueType>(start, line_end(row_start(row), m_colCount, m_colStride),
+                                                             static_cast<size_t>(m_colStride));
+        }
+
+        /**
+         * Get constant iterator for row end.
+         * @param row Zero based row index.
+         * @return Constant input iterator.
+         */
+        auto row_cend(const size_t row) const
+        {
+            return ConstCustomAdvancementIterator<ValueType>(line_end(row_start(row), m_colCount, m_colStride),
+                                                             static_cast<size_t>(m_colStride));
+        }
+
+        /**
+         * Get iterator for row beginning.
+         * @param row Zero based row index.
+         * @return Forward iterator.
+         */
+        auto row_begin(const size_t row) const
+        {
+            return CustomAdvancementIterator<T>(row_start(row), line_end(row_start(row), m_colCount, m_colStride),
+                                                static_cast<size_t>(m_colStride));
+        }
+
+        /**
+         * Get iterator for row end.
+         * @param row Zero based row index.
+         * @return Forward iterator.
+         */
+        auto row_end(const size_t row) const
+        {
+            return CustomAdvancementIterator<T>(line_end(row_start(row), m_colCount, m_colStride),
+                                                static_cast<size_t>(m_colStride));
+        }
+
+        /**
+         * Get constant iterator for column beginning.
+         * @param col Zero based column index.
+         * @return Constant input iterator.
+         */
+        auto col_cbegin(const size_t col) const
+        {
+            const ValueType *start = col_start(col);
+            return ConstCustomAdvancementIterator<ValueType>(start, line_end(col_start(col), m_rowCount, m_rowStride),
+                                                             static_cast<size_t>(m_rowStride));
+        }
+
+        /**
+         * Get constant iterator for column end.
+         * @param col Zero based column index.
+         * @return Constant input iterator.
+         */
+        auto col_cend(const size_t col) const
+        {
+            return ConstCustomAdvancementIterator<ValueType>(line_end(col_start(col), m_rowCount, m_rowStride),
+                                                             static_cast<size_t>(m_rowStride));
+        }
+
+        /**
+         * Get iterator for column beginning.
+         * @param col Zero based column index.
+         * @return Forward iterator.
+         */
+        auto col_begin(const size_t col) const
+        {
+            return CustomAdvancementIterator<T>(col_start(col), line_end(col_start(col), m_rowCount, m_rowStride),
+                                                static_cast<size_t>(m_rowStride));
+        }
+
+        /**
+         * Get iterator for column end.
+         * @param col Zero based column index.
+         * @return Forward iterator.
+         */
+        auto col_end(const size_t col) const
+        {
+            return CustomAdvancementIterator<T>(line_end(col_start(col), m_rowCount, m_rowStride),
+                                                static_cast<size_t>(m_rowStride));
+        }
+
+        /**
+         * Evaluate the matrix expression into the viewed elements. Expression can reference the viewed elements only
+         * at the same positions, e.g. `v.assign(v * 2)`. Overlapping views with different mapping, like transposition
+         * of the same data, must be evaluated into Matrix first.
+         * @param expression Matrix or matrix expression of the same dimensions.
+         * @param policy Execution policy of the evaluation.
+         * @return Reference to this view.
+         */
+        template<typename E>
+        const MatrixView &assign(const MatrixExpression<E> &expression,
+                                 const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            static_assert(!std::is_const<T>::value, "Can't assign into read-only matrix view.");
+            using Operand = MatrixOperandType<E>;
+            static_assert(std::is_convertible<typename Operand::ValueType, ValueType>::value,
+                          "Matrix expression element type is not convertible to T.");
+
+            const Operand operand = as_operand(expression);
+            always_assert(operand.rows() == m_rowCount && operand.cols() == m_colCount);
+            evaluate_strided(operand, m_data, m_rowCount, m_colCount, m_rowStride, m_colStride, policy);
+            return *this;
+        }
+
+        /**
+         * Assign the evaluated matrix expression into the viewed elements, see assign().
+         */
+        template<typename E, typename = std::enable_if_t<!std::is_same<E, MatrixView>::value>>
+        const MatrixView &operator=(const MatrixExpression<E> &expression) const
+        {
+            return assign(expression);
+        }
+
+        template<typename E>
+        const MatrixView &operator+=(const MatrixExpression<E> &other) const
+        {
+            return assign(*this + other);
+        }
+
+        template<typename E>
+        const MatrixView &operator-=(const MatrixExpression<E> &other) const
+        {
+            return assign(*this - other);
+        }
+
+        /**
+         * Set all viewed elements to the value.
+         * @param value Value to set.
+         * @param policy Execution policy of the fill.
+         */
+        void fill(const ValueType &value, const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            static_assert(!std::is_const<T>::value, "Can't fill read-only matrix view.");
+            assign(apply(*this, [value](const ValueType &)
+            { return value; }), policy);
+        }
+    };
+
+    /**
+     * Compute C += A * B on the viewed elements, using cache blocked kernel. Views can have any strides,
+     * so blocks of larger matrices are multiplied without any copy.
+     * @param a Left hand side view, rows x k.
+     * @param b Right hand side view, k x cols.
+     * @param c Result view, rows x cols, must not overlap with a or b.
+     */
+    template<typename TA, typename TB, typename T>
+    void multiply_accumulate(const MatrixView<TA> &a, const MatrixView<TB> &b, const MatrixView<T> &c)
+    {
+        static_assert(!std::is_const<T>::value, "Can't accumulate into read-only matrix view.");
+        static_assert(std::is_same<std::remove_const_t<TA>, T>::value && std::is_same<std::remove_const_t<TB>, T>::value,
+                      "Matrix views must have same element type.");
+        always_assert(a.cols() == b.rows() && a.rows() == c.rows() && b.cols() == c.cols());
+        if (c.row_stride() != 1 && c.col_stride() != 1)
+        {
+            // Kernel writes continuous rows or columns of C, other strides go through temporary product.
+            std::vector<T> product(c.rows() * c.cols(), T{});
+            const std::ptrdiff_t ldp = static_cast<std::ptrdiff_t>(c.cols());
+            linalg::gemm(c.rows(), c.cols(), a.cols(),
+                         a.data(), a.row_stride(), a.col_stride(),
+                         b.data(), b.row_stride(), b.col_stride(),
+                         product.data(), ldp, 1);
+            c += MatrixView<const T>(product.data(), c.rows(), c.cols(), ldp, 1);
+            return;
+        }
+        linalg::gemm(c.rows(), c.cols(), a.cols(),
+                     a.data(), a.row_stride(), a.col_stride(),
+                     b.data(), b.row_stride(), b.col_stride(),
+                     c.data(), c.row_stride(), c.col_stride());
+    }
+}
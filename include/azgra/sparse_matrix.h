@@ -0,0 +1,608 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <azgra/matrix.h>
+#include <azgra/collection/vector_utilities.h>
+#include <azgra/utilities/parallel.h>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+
+namespace azgra
+{
+    /**
+     * Single non-zero element, used to build the sparse matrix from coordinate list.
+     */
+    template<typename T>
+    struct SparseTriplet
+    {
+        size_t row;
+        size_t col;
+        T value;
+    };
+
+    /**
+     * Compressed sparse matrix, which stores only the non-zero elements. Layout follows the dense Matrix:
+     * row based matrix is stored as CSR (compressed rows), column based matrix as CSC (compressed columns),
+     * so the conversions between dense and sparse matrix are single linear pass.
+     *
+     * Elements of the line (row for CSR, column for CSC) are stored in m_values, with their inner indices
+     * (column for CSR, row for CSC) in m_indices, sorted in ascending order. Line i occupies range
+     * [m_offsets[i], m_offsets[i + 1]).
+     * @tparam T Type of matrix element.
+     * @tparam RowBased True for CSR, false for CSC.
+     * @tparam IndexType Type of the stored inner indices, smaller type saves memory.
+     */
+    template<typename T, bool RowBased = true, typename IndexType = u32>
+    class SparseMatrix
+    {
+        static_assert(std::is_integral<IndexType>::value && std::is_unsigned<IndexType>::value,
+                      "Sparse matrix index type must be unsigned integer.");
+
+        template<typename U, bool RowBased_, typename IndexType_>
+        friend
+        class SparseMatrix;
+
+    private:
+        size_t m_rowCount = 0;
+        size_t m_colCount = 0;
+        std::vector<size_t> m_offsets;
+        std::vector<IndexType> m_indices;
+        std::vector<T> m_values;
+
+        [[nodiscard]] size_t outer_count() const noexcept
+        {
+            return RowBased ? m_rowCount : m_colCount;
+        }
+
+        [[nodiscard]] size_t inner_count() const noexcept
+        {
+            return RowBased ? m_colCount : m_rowCount;
+        }
+
+        /**
+         * Average number of stored elements in the line, used as the line length of the parallel loops.
+         */
+        [[nodiscard]] size_t average_line_length() const noexcept
+        {
+            return std::max<size_t>(1, m_values.size() / std::max<size_t>(1, outer_count()));
+        }
+
+        static bool is_zero(const T &value)
+        {
+            return value == T{};
+        }
+
+        /**
+         * Turn the element counts of the lines into offsets and allocate the element storage.
+         */
+        void allocate_from_counts()
+        {
+            const size_t offset = collection::exclusive_prefix_sum(m_offsets);
+            m_indices.resize(offset);
+            m_values.resize(offset);
+        }
+
+        /**
+         * Merge the sorted lines of two sparse matrices, calling emit(index, value) for every non-zero result.
+         */
+        template<typename Op, typename Emit>
+        void merge_line(const SparseMatrix &other, const size_t line, Op op, Emit emit) const
+        {
+            size_t a = m_offsets[line];
+            size_t b = other.m_offsets[line];
+            const size_t aEnd = m_offsets[line + 1];
+            const size_t bEnd = other.m_offsets[line + 1];
+            while (a < aEnd || b < bEnd)
+            {
+                IndexType index;
+                T value;
+                if (b == bEnd || (a < aEnd && m_indices[a] < other.m_indices[b]))
+                {
+                    index = m_indices[a];
+                    value = op(m_values[a++], T{});
+                }
+                else if (a == aEnd || other.m_indices[b] < m_indices[a])
+                {
+                    index = other.m_indices[b];
+                    value = op(T{}, other.m_values[b++]);
+                }
+                else
+                {
+                    index = m_indices[a];
+                    value = op(m_values[a++], other.m_values[b++]);
+                }
+                if (!is_zero(value))
+                {
+                    emit(index, value);
+                }
+            }
+        }
+
+        template<typename Op>
+        SparseMatrix element_wise(const SparseMatrix &other, Op op, const ExecutionPolicy policy) const
+        {
+            always_assert(m_rowCount == other.m_rowCount && m_colCount == other.m_colCount);
+            SparseMatrix result(m_rowCount, m_colCount);
+            const size_t lineLength = average_line_length() + other.average_line_length();
+            parallel_for_lines<T>(outer_count(), lineLength, policy, [&](const size_t from, const size_t to)
+            {
+                for (size_t line = from; line < to; ++line)
+                {
+                    size_t count = 0;
+                    merge_line(other, line, op, [&count](const IndexType, const T &)
+                    { ++count; });
+                    result.m_offsets[line] = count;
+                }
+            });
+            result.allocate_from_counts();
+            parallel_for_lines<T>(outer_count(), lineLength, policy, [&](const size_t from, const size_t to)
+            {
+                for (size_t line = from; line < to; ++line)
+                {
+                    size_t position = result.m_offsets[line];
+                    merge_line(other, line, op, [&](const IndexType index, const T &value)
+                    {
+                        result.m_indices[position] = index;
+                        result.m_values[position] = value;
+                        ++position;
+                    });
+                }
+            });
+            return result;
+        }
+
+    public:
+        using ValueType = T;
+        static constexpr bool IsRowBased = RowBased;
+
+        /**
+         * Create empty 0x0 matrix.
+         */
+        SparseMatrix() : m_offsets(1, 0)
+        {
+        }
+
+        /**
+         * Create matrix of given dimensions without any non-zero element.
+         * @param rowCount Matrix row count.
+         * @param colCount Matrix column count.
+         */
+        explicit SparseMatrix(const size_t rowCount, const size_t colCount) :
+                m_rowCount(rowCount), m_colCount(colCount), m_offsets((RowBased ? rowCount : colCount) + 1, 0)
+        {
+            always_assert(inner_count() == 0 ||
+                          (inner_count() - 1) <= static_cast<size_t>(std::numeric_limits<IndexType>::max()));
+        }
+
+        /**
+         * Compress the dense matrix of the same layout. Non-zeros of the lines are counted and then copied,
+         * both in parallel linear pass over the dense data.
+         * @param dense Dense matrix.
+         * @param policy Execution policy of the conversion.
+         */
+        template<typename Allocator>
+        explicit SparseMatrix(const Matrix<T, RowBased, Allocator> &dense,
+                              const ExecutionPolicy policy = ExecutionPolicy_Parallel) :
+                SparseMatrix(dense.rows(), dense.cols())
+        {
+            const size_t inner = inner_count();
+            const T *data = dense.get_data().data();
+            parallel_for_lines<T>(outer_count(), inner, policy, [&](const size_t from, const size_t to)
+            {
+                for (size_t line = from; line < to; ++line)
+                {
+                    const T *lineData = data + (line * inner);
+                    m_offsets[line] = static_cast<size_t>(
+                            std::count_if(lineData, lineData + inner, [](const T &value)
+                            { return !is_zero(value); }));
+                }
+            });
+            allocate_from_counts();
+            parallel_for_lines<T>(outer_count(), inner, policy, [&](const size_t from, const size_t to)
+            {
+                for (size_t line = from; line < to; ++line)
+                {
+                    const T *lineData = data + (line * inner);
+                    size_t position = m_offsets[line];
+                    for (size_t i = 0; i < inner; ++i)
+                    {
+                        if (!is_zero(lineData[i]))
+                        {
+                            m_indices[position] = static_cast<IndexType>(i);
+                            m_values[position] = lineData[i];
+                            ++position;
+                        }
+                    }
+                }
+            });
+        }
+
+        /**
+         * Build the matrix from coordinate list. Elements with the same coordinates are summed.
+         * @param rowCount Matrix row count.
+         * @param colCount Matrix column count.
+         * @param triplets Non-zero elements in any order.
+         * @return Sparse matrix.
+         */
+        static SparseMatrix from_triplets(const size_t rowCount, const size_t colCount,
+                                          const std::vector<SparseTriplet<T>> &triplets)
+        {
+            SparseMatrix result(rowCount, colCount);
+            for (const SparseTriplet<T> &triplet : triplets)
+            {
+                always_assert(triplet.row < rowCount && triplet.col < colCount);
+                ++result.m_offsets[RowBased ? triplet.row : triplet.col];
+            }
+            result.allocate_from_counts();
+
+            // Counting sort into the lines, then sort every line and sum the duplicates.
+            std::vector<size_t> positions(result.m_offsets.begin(), result.m_offsets.end() - 1);
+            std::vector<std::pair<IndexType, T>> entries(triplets.size());
+            for (const SparseTriplet<T> &triplet : triplets)
+            {
+                const size_t line = RowBased ? triplet.row : triplet.col;
+                const size_t inner = RowBased ? triplet.col : triplet.row;
+                entries[positions[line]++] = std::make_pair(static_cast<IndexType>(inner), triplet.value);
+            }
+
+            size_t position = 0;
+            for (size_t line = 0; line < result.outer_count(); ++line)
+            {
+                const auto lineBegin = entries.begin() + result.m_offsets[line];
+                const auto lineEnd = entries.begin() + result.m_offsets[line + 1];
+                std::stable_sort(lineBegin, lineEnd, [](const auto &a, const auto &b)
+                { return a.first < b.first; });
+
+                result.m_offsets[line] = position;
+                for (auto it = lineBegin; it != lineEnd;)
+                {
+                    const IndexType index = it->first;
+                    T value = it->second;
+                    for (++it; it != lineEnd && it->first == index; ++it)
+                    {
+                        value += it->second;
+                    }
+                    if (!is_zero(value))
+                    {
+                        result.m_indices[position] = index;
+                        result.m_values[position] = value;
+                        ++position;
+                    }
+                }
+            }
+            result.m_offsets[result.outer_count()] = position;
+            result.m_indices.resize(position);
+            result.m_values.resize(position);
+            return result;
+        }
+
+        [[nodiscard]] size_t rows() const noexcept
+        {
+            return m_rowCount;
+        }
+
+        [[nodiscard]] size_t cols() const noexcept
+        {
+            return m_colCount;
+        }
+
+        /**
+         * Get number of stored (non-zero) elements.
+         * @return Non-zero element count.
+         */
+        [[nodiscard]] size_t non_zero_count() const noexcept
+        {
+            return m_values.size();
+        }
+
+        /**
+         * Get value of the element, zero if it isn't stored. Element is found by binary search in its line.
+         * @param row Zero based row index.
+         * @param col Zero based column index.
+         * @return Element value.
+         */
+        T at(const size_t row, const size_t col) const
+        {
+            always_assert(row < m_rowCount && col < m_colCount);
+            const size_t line = RowBased ? row : col;
+            const IndexType inner = static_cast<IndexType>(RowBased ? col : row);
+            const auto lineBegin = m_indices.begin() + m_offsets[line];
+            const auto lineEnd = m_indices.begin() + m_offsets[line + 1];
+            const auto it = std::lower_bound(lineBegin, lineEnd, inner);
+            return (it != lineEnd && *it == inner) ? m_values[static_cast<size_t>(it - m_indices.begin())] : T{};
+        }
+
+        /**
+         * Get offsets of the lines, line i occupies [offsets[i], offsets[i + 1]).
+         */
+        const std::vector<size_t> &get_offsets() const
+        {
+            return m_offsets;
+        }
+
+        /**
+         * Get inner indices of the stored elements, columns for CSR, rows for CSC.
+         */
+        const std::vector<IndexType> &get_indices() const
+        {
+            return m_indices;
+        }
+
+        /**
+         * Get values of the stored elements.
+         */
+        const std::vector<T> &get_values() const
+        {
+            return m_values;
+        }
+
+        /**
+         * Expand into the dense matrix of the same layout.
+         * @param policy Execution policy of the conversion.
+         * @return Dense matrix.
+         */
+        Matrix<T, RowBased> to_dense(const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            Matrix<T, RowBased> dense(m_rowCount, m_colCount, MatrixUninitialized);
+            const size_t inner = inner_count();
+            T *data = dense.view().data();
+            parallel_for_lines<T>(outer_count(), inner, policy, [&](const size_t from, const size_t to)
+            {
+                for (size_t line = from; line < to; ++line)
+                {
+                    T *lineData = data + (line * inner);
+                    std::fill(lineData, lineData + inner, T{});
+                    for (size_t i = m_offsets[line]; i < m_offsets[line + 1]; ++i)
+                    {
+                        lineData[m_indices[i]] = m_values[i];
+                    }
+                }
+            });
+            return dense;
+        }
+
+        /**
+         * Transposed matrix in the other layout. CSR of the matrix is CSC of its transposition,
+         * so the compressed arrays are only copied.
+         * @return Transposed matrix.
+         */
+        SparseMatrix<T, !RowBased, IndexType> transpose() const
+        {
+            SparseMatrix<T, !RowBased, IndexType> result;
+            result.m_rowCount = m_colCount;
+            result.m_colCount = m_rowCount;
+            result.m_offsets = m_offsets;
+            result.m_indices = m_indices;
+            result.m_values = m_values;
+            return result;
+        }
+
+        /**
+         * Sparse matrix-vector multiplication y = A * x. CSR computes the rows in parallel, CSC scatters
+         * the columns into per-thread partial results, which are summed at the end.
+         * @param x Vector with cols elements.
+         * @param policy Execution policy of the multiplication.
+         * @return Vector with rows elements.
+         */
+        std::vector<T> multiply(const std::vector<T> &x, const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            always_assert(x.size() == m_colCount);
+            std::vector<T> y(m_rowCount, T{});
+            if constexpr (RowBased)
+            {
+                parallel_for_lines<T>(m_rowCount, average_line_length(), policy, [&](const size_t from, const size_t to)
+                {
+                    for (size_t row = from; row < to; ++row)
+                    {
+                        T sum{};
+                        for (size_t i = m_offsets[row]; i < m_offsets[row + 1]; ++i)
+                        {
+                            sum += m_values[i] * x[m_indices[i]];
+                        }
+                        y[row] = sum;
+                    }
+                });
+            }
+            else
+            {
+                const auto scatter = [&](const size_t from, const size_t to, std::vector<T> &target)
+                {
+                    for (size_t col = from; col < to; ++col)
+                    {
+                        const T xValue = x[col];
+                        for (size_t i = m_offsets[col]; i < m_offsets[col + 1]; ++i)
+                        {
+                            target[m_indices[i]] += m_values[i] * xValue;
+                        }
+                    }
+                };
+                const size_t chunkSize = parallel_chunk_size<T>(m_values.size(), policy);
+                const size_t chunkCount = std::min(m_colCount, ThreadPool::global().thread_count());
+                if (chunkSize >= m_values.size() || chunkCount < 2)
+                {
+                    scatter(0, m_colCount, y);
+                    return y;
+                }
+                const size_t colsPerChunk = (m_colCount + chunkCount - 1) / chunkCount;
+                std::vector<std::vector<T>> partials(chunkCount);
+                ThreadPool::global().run(chunkCount, [&](const size_t chunk)
+                {
+                    partials[chunk].assign(m_rowCount, T{});
+                    const size_t from = chunk * colsPerChunk;
+                    scatter(from, std::min(m_colCount, from + colsPerChunk), partials[chunk]);
+                });
+                parallel_for<T>(m_rowCount, policy, [&](const size_t from, const size_t to)
+                {
+                    for (const std::vector<T> &partial : partials)
+                    {
+                        for (size_t row = from; row < to; ++row)
+                        {
+                            y[row] += partial[row];
+                        }
+                    }
+                });
+            }
+            return y;
+        }
+
+        /**
+         * Sparse-dense matrix multiplication C = A * B. Result has the layout of this matrix,
+         * so every thread computes whole rows (CSR) or columns (CSC) of C without synchronization.
+         * @param dense Dense matrix with cols rows, in any layout.
+         * @param policy Execution policy of the multiplication.
+         * @return Dense product.
+         */
+        template<bool DenseRowBased, typename Allocator>
+        Matrix<T, RowBased> multiply(const Matrix<T, DenseRowBased, Allocator> &dense,
+                                     const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            always_assert(dense.rows() == m_colCount);
+            const size_t n = dense.cols();
+            Matrix<T, RowBased> result(m_rowCount, n);
+            const auto b = dense.view();
+            const T *bData = b.data();
+            const std::ptrdiff_t rsB = b.row_stride();
+            const std::ptrdiff_t csB = b.col_stride();
+            T *c = result.view().data();
+
+            if constexpr (RowBased)
+            {
+                // Row r of C is the combination of the rows of B selected by the non-zeros of row r of A.
+                parallel_for_lines<T>(m_rowCount, average_line_length() * n, policy,
+                                      [&](const size_t from, const size_t to)
+                                      {
+                                          for (size_t row = from; row < to; ++row)
+                                          {
+                                              T *cRow = c + (row * n);
+                                              for (size_t i = m_offsets[row]; i < m_offsets[row + 1]; ++i)
+                                              {
+                                                  const T a = m_values[i];
+                                                  const T *bRow = bData + (static_cast<std::ptrdiff_t>(m_indices[i]) * rsB);
+                                                  if (csB == 1)
+                                                  {
+                                                      // Continuous rows of B, the loop is vectorized.
+                                                      for (size_t j = 0; j < n; ++j)
+                                                      {
+                                                          cRow[j] += a * bRow[j];
+                                                      }
+                                                  }
+                                                  else
+                                                  {
+                                                      for (size_t j = 0; j < n; ++j)
+                                                      {
+                                                          cRow[j] += a * bRow[static_cast<std::ptrdiff_t>(j) * csB];
+                                                      }
+                                                  }
+                                              }
+                                          }
+                                      });
+            }
+            else
+            {
+                // Column j of C is the combination of the columns of A weighted by column j of B.
+                parallel_for_lines<T>(n, std::max<size_t>(1, m_values.size()), policy,
+                                      [&](const size_t from, const size_t to)
+                                      {
+                                          for (size_t j = from; j < to; ++j)
+                                          {
+                                              T *cCol = c + (j * m_rowCount);
+                                              const T *bCol = bData + (static_cast<std::ptrdiff_t>(j) * csB);
+                                              for (size_t k = 0; k < m_colCount; ++k)
+                                              {
+                                                  const T bValue = bCol[static_cast<std::ptrdiff_t>(k) * rsB];
+                                                  if (is_zero(bValue))
+                                                  {
+                                                      continue;
+                                                  }
+                                                  for (size_t i = m_offsets[k]; i < m_offsets[k + 1]; ++i)
+                                                  {
+                                                      cCol[m_indices[i]] += m_values[i] * bValue;
+                                                  }
+                                              }
+                                          }
+                                      });
+            }
+            return result;
+        }
+
+        template<bool DenseRowBased, typename Allocator>
+        Matrix<T, RowBased> operator*(const Matrix<T, DenseRowBased, Allocator> &dense) const
+        {
+            return multiply(dense);
+        }
+
+        std::vector<T> operator*(const std::vector<T> &x) const
+        {
+            return multiply(x);
+        }
+
+        /**
+         * Element-wise sum of two sparse matrices, by merging their sorted lines in parallel.
+         * Elements which sum to zero are not stored.
+         * @param other Sparse matrix of the same dimensions.
+         * @param policy Execution policy of the operation.
+         * @return Sparse sum.
+         */
+        SparseMatrix add(const SparseMatrix &other, const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            return element_wise(other, [](const T &a, const T &b)
+            { return a + b; }, policy);
+        }
+
+        /**
+         * Element-wise difference of two sparse matrices. Elements which are equal are not stored.
+         * @param other Sparse matrix of the same dimensions.
+         * @param policy Execution policy of the operation.
+         * @return Sparse difference.
+         */
+        SparseMatrix subtract(const SparseMatrix &other, const ExecutionPolicy policy = ExecutionPolicy_Parallel) const
+        {
+            return element_wise(other, [](const T &a, const T &b)
+            { return a - b; }, policy);
+        }
+
+        SparseMatrix operator+(const SparseMatrix &other) const
+        {
+            return add(other);
+        }
+
+        SparseMatrix operator-(const SparseMatrix &other) const
+        {
+            return subtract(other);
+        }
+
+        /**
+         * Check whether two sparse matrices are same.
+         * @param other Another sparse matrix.
+         * @return True if dimensions and all stored elements are equal.
+         */
+        bool equals(const SparseMatrix &other) const
+        {
+            return m_rowCount == other.m_rowCount && m_colCount == other.m_colCount &&
+                   m_offsets == other.m_offsets && m_indices == other.m_indices && m_values == other.m_values;
+        }
+
+        bool operator==(const SparseMatrix &other) const
+        {
+            return equals(other);
+        }
+
+        bool operator!=(const SparseMatrix &other) const
+        {
+            return !equals(other);
+        }
+    };
+
+    /**
+     * Compressed sparse row matrix, sparse counterpart of Matrix<T, true>.
+     */
+    template<typename T, typename IndexType = u32>
+    using CsrMatrix = SparseMatrix<T, true, IndexType>;
+
+    /**
+     * Compressed sparse column matrix, sparse counterpart of Matrix<T, false>.
+     */
+    template<typename T, typename IndexType = u32>
+    using CscMatrix = SparseMatrix<T, false, IndexType>;
+}
@@ -2,6 +2,7 @@
 
 #include <azgra/azgra.h>
 #include <algorithm>
+#include <cctype>
 
 namespace azgra
 {
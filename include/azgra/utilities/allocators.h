@@ -0,0 +1,159 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace azgra
+{
+    /**
+     * Alignment of the SIMD friendly storage, matches the width of AVX-512 register and the cache line.
+     */
+    constexpr size_t SimdAlignment = 64;
+
+    /**
+     * Allocate memory aligned to SimdAlignment from the calling thread's size-class pool.
+     * Buffers are rounded up to the power of two and recycled by pool_deallocate, so repeated temporaries
+     * of the same size don't touch the heap.
+     * @param byteCount Number of bytes.
+     * @return Pointer to the aligned memory.
+     */
+    void *pool_allocate(size_t byteCount);
+
+    /**
+     * Return memory from pool_allocate into the calling thread's pool. Memory can be returned from other thread
+     * than it was allocated on. Buffers over the cache limit are released to the heap.
+     * @param memory Pointer returned by pool_allocate.
+     * @param byteCount Same byte count as was passed into pool_allocate.
+     */
+    void pool_deallocate(void *memory, size_t byteCount) noexcept;
+
+    /**
+     * Release all buffers cached by the calling thread's pool to the heap.
+     */
+    void pool_release_thread_cache() noexcept;
+
+    /**
+     * Get number of bytes currently cached by the calling thread's pool.
+     * @return Cached byte count.
+     */
+    size_t pool_thread_cached_bytes() noexcept;
+
+    /**
+     * Set maximal number of bytes cached by the pool of every thread. Zero disables caching.
+     * @param byteCount Cache limit in bytes.
+     */
+    void set_pool_cache_limit(size_t byteCount);
+
+    /**
+     * Get maximal number of bytes cached by the pool of every thread.
+     * @return Cache limit in bytes.
+     */
+    size_t get_pool_cache_limit();
+
+    /**
+     * Base of the library allocators. Construction without arguments default-initializes the element,
+     * so std::vector::resize(n) of trivial type leaves the memory uninitialized. Use resize(n, T()) for zeroed
+     * storage.
+     */
+    template<typename T>
+    struct DefaultInitAllocatorBase
+    {
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        template<typename U>
+        void construct(U *ptr) noexcept(std::is_nothrow_default_constructible<U>::value)
+        {
+            ::new(static_cast<void *>(ptr)) U;
+        }
+
+        template<typename U, typename ...Args>
+        void construct(U *ptr, Args &&...args)
+        {
+            ::new(static_cast<void *>(ptr)) U(std::forward<Args>(args)...);
+        }
+    };
+
+    /**
+     * Allocator returning memory aligned to the Alignment bytes.
+     * @tparam T Type of allocated elements.
+     * @tparam Alignment Alignment in bytes, power of two.
+     */
+    template<typename T, size_t Alignment = SimdAlignment>
+    struct AlignedAllocator : DefaultInitAllocatorBase<T>
+    {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be power of two.");
+
+        template<typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept
+        {
+        }
+
+        T *allocate(const size_t count)
+        {
+            constexpr size_t alignment = (Alignment < alignof(T)) ? alignof(T) : Alignment;
+            return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(alignment)));
+        }
+
+        void deallocate(T *ptr, const size_t count) noexcept
+        {
+            constexpr size_t alignment = (Alignment < alignof(T)) ? alignof(T) : Alignment;
+            ::operator delete(ptr, count * sizeof(T), std::align_val_t(alignment));
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept
+        { return true; }
+
+        template<typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment> &) const noexcept
+        { return false; }
+    };
+
+    /**
+     * Allocator backed by the thread-local size-class pool, see pool_allocate.
+     * Memory is aligned to SimdAlignment bytes.
+     * @tparam T Type of allocated elements.
+     */
+    template<typename T>
+    struct PoolAllocator : DefaultInitAllocatorBase<T>
+    {
+        static_assert(alignof(T) <= SimdAlignment, "Type alignment is bigger than the pool alignment.");
+
+        PoolAllocator() noexcept = default;
+
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U> &) noexcept
+        {
+        }
+
+        T *allocate(const size_t count)
+        {
+            return static_cast<T *>(pool_allocate(count * sizeof(T)));
+        }
+
+        void deallocate(T *ptr, const size_t count) noexcept
+        {
+            pool_deallocate(ptr, count * sizeof(T));
+        }
+
+        template<typename U>
+        bool operator==(const PoolAllocator<U> &) const noexcept
+        { return true; }
+
+        template<typename U>
+        bool operator!=(const PoolAllocator<U> &) const noexcept
+        { return false; }
+    };
+}
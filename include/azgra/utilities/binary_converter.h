@@ -18,7 +18,9 @@
 
 
 #include <azgra/azgra.h>
+#include <cstring>
 #include <string>
+#include <type_traits>
 #include <boost/locale.hpp>
 #include <locale>
 #include <codecvt>
@@ -26,6 +28,41 @@
 
 namespace azgra
 {
+    // Order of the bytes of multi-byte values in the binary data.
+    enum ByteOrder
+    {
+        // Least significant byte first, native order of the supported platforms.
+        ByteOrder_LittleEndian,
+        // Most significant byte first, network order.
+        ByteOrder_BigEndian
+    };
+
+    // Reverse the bytes of the arithmetic value.
+    template<typename T>
+    T byte_swap(const T value)
+    {
+        static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be byte swapped.");
+        if constexpr (sizeof(T) == 1)
+        {
+            return value;
+        }
+        else
+        {
+            using Bits = std::conditional_t<sizeof(T) == 2, azgra::u16, std::conditional_t<sizeof(T) == 4, azgra::u32, azgra::u64>>;
+            static_assert(sizeof(T) == sizeof(Bits), "Unsupported value size.");
+            Bits bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            if constexpr (sizeof(T) == 2)
+                bits = __builtin_bswap16(bits);
+            else if constexpr (sizeof(T) == 4)
+                bits = __builtin_bswap32(bits);
+            else
+                bits = __builtin_bswap64(bits);
+            T result;
+            std::memcpy(&result, &bits, sizeof(T));
+            return result;
+        }
+    }
 
     // Convert two bytes, from specified index, to azgra::i16.
     azgra::i16 bytes_to_i16(const ByteArray &bytes, const azgra::u64 fromIndex = 0);
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <azgra/azgra.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace azgra
+{
+    /**
+     * Size of the cache line, chunks of parallel loops are aligned to it to avoid false sharing.
+     */
+    constexpr size_t CacheLineSize = 64;
+
+    enum ExecutionPolicy
+    {
+        // Run on the calling thread.
+        ExecutionPolicy_Sequential,
+        // Split the work across the library thread pool, if there is enough of it.
+        ExecutionPolicy_Parallel
+    };
+
+    /**
+     * Pool of worker threads shared by the whole library.
+     * Tasks are executed by workers and by the thread which submitted them.
+     */
+    class ThreadPool
+    {
+    private:
+        std::vector<std::thread> m_workers;
+        // Size of m_workers, which is rebuilt under m_submitMutex, so that it can be read without the lock.
+        std::atomic<size_t> m_workerCount{0};
+        std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_workDone;
+        // Serializes submissions from multiple external threads.
+        std::mutex m_submitMutex;
+
+        const std::function<void(size_t)> *m_task = nullptr;
+        size_t m_taskCount = 0;
+        std::atomic<size_t> m_nextTask{0};
+        size_t m_activeWorkers = 0;
+        size_t m_generation = 0;
+        bool m_stop = false;
+        // First exception thrown by a task of the current run, rethrown on the submitting thread.
+        std::exception_ptr m_exception;
+
+        void worker_loop(size_t seenGeneration);
+
+        void execute_tasks();
+
+        void start_workers(size_t workerCount);
+
+        void stop_workers();
+
+    public:
+        /**
+         * Create thread pool.
+         * @param threadCount Number of threads executing tasks, including the submitting thread.
+         */
+        explicit ThreadPool(size_t threadCount = std::thread::hardware_concurrency());
+
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /**
+         * Get the library wide thread pool.
+         * @return Reference to the global thread pool.
+         */
+        static ThreadPool &global();
+
+        /**
+         * Get number of threads executing tasks, including the submitting thread.
+         * @return Thread count.
+         */
+        [[nodiscard]] size_t thread_count() const noexcept;
+
+        /**
+         * Change number of threads. Value of 1 disables the parallel execution. Waits for the running tasks,
+         * so it mustn't be called from inside of a task.
+         * @param threadCount New thread count, 0 means hardware concurrency.
+         */
+        void set_thread_count(size_t threadCount);
+
+        /**
+         * Execute task for every index in [0, taskCount) and wait for all of them to finish.
+         * When called from inside of a task, the tasks are executed sequentially.
+         * When a task throws, the tasks which didn't start yet are skipped and the first exception is rethrown
+         * after all threads finished.
+         * @param taskCount Number of tasks.
+         * @param task Task function receiving the task index.
+         */
+        void run(size_t taskCount, const std::function<void(size_t)> &task);
+    };
+
+    /**
+     * Set minimal number of elements, for which the parallel policy actually uses the thread pool.
+     * @param elementCount Element count threshold.
+     */
+    void set_parallel_threshold(size_t elementCount);
+
+    /**
+     * Get minimal number of elements, for which the parallel policy actually uses the thread pool.
+     * @return Element count threshold.
+     */
+    size_t get_parallel_threshold();
+
+    /**
+     * Compute static chunk size for the parallel loop. Chunks are multiples of cache line worth of elements.
+     * @tparam T Type of the processed elements.
+     * @param count Number of elements.
+     * @param policy Execution policy.
+     * @return Number of elements in one chunk, equal to count when the loop should run sequentially.
+     */
+    template<typename T>
+    size_t parallel_chunk_size(const size_t count, const ExecutionPolicy policy)
+    {
+        const size_t threadCount = ThreadPool::global().thread_count();
+        if (policy == ExecutionPolicy_Sequential || threadCount <= 1 || count < get_parallel_threshold())
+        {
+            return std::max<size_t>(count, 1);
+        }
+        const size_t elementsPerLine = std::max<size_t>(1, CacheLineSize / sizeof(T));
+        const size_t chunkSize = (count + threadCount - 1) / threadCount;
+        return ((chunkSize + elementsPerLine - 1) / elementsPerLine) * elementsPerLine;
+    }
+
+    /**
+     * Call fn(from, to) for static chunks covering [0, count).
+     * @tparam T Type of the processed elements, used to align chunks to cache lines.
+     * @param count Number of elements.
+     * @param policy Execution policy.
+     * @param fn Chunk function receiving the half open range of element indices.
+     */
+    template<typename T, typename ChunkFunction>
+    void parallel_for(const size_t count, const ExecutionPolicy policy, ChunkFunction fn)
+    {
+        const size_t chunkSize = parallel_chunk_size<T>(count, policy);
+        if (chunkSize >= count)
+        {
+            fn(static_cast<size_t>(0), count);
+            return;
+        }
+        const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        ThreadPool::global().run(chunkCount, [&](const size_t chunk)
+        {
+            const size_t from = chunk * chunkSize;
+            fn(from, std::min(count, from + chunkSize));
+        });
+    }
+
+    /**
+     * Call fn(fromLine, toLine) for static chunks of lines covering [0, lineCount).
+     * Used by 2D loops, where every line of lineLength elements is processed at once.
+     * @tparam T Type of the processed elements.
+     * @param lineCount Number of lines.
+     * @param lineLength Number of elements in one line.
+     * @param policy Execution policy.
+     * @param fn Chunk function receiving the half open range of line indices.
+     */
+    template<typename T, typename ChunkFunction>
+    void parallel_for_lines(const size_t lineCount, const size_t lineLength, const ExecutionPolicy policy,
+                            ChunkFunction fn)
+    {
+        const size_t count = lineCount * lineLength;
+        const size_t chunkSize = parallel_chunk_size<T>(count, policy);
+        if (chunkSize >= count || lineCount < 2)
+        {
+            fn(static_cast<size_t>(0), lineCount);
+            return;
+        }
+        const size_t linesPerChunk = std::max<size_t>(1, chunkSize / std::max<size_t>(1, lineLength));
+        const size_t chunkCount = (lineCount + linesPerChunk - 1) / linesPerChunk;
+        ThreadPool::global().run(chunkCount, [&](const size_t chunk)
+        {
+            const size_t from = chunk * linesPerChunk;
+            fn(from, std::min(lineCount, from + linesPerChunk));
+        });
+    }
+
+    /**
+     * Reduce [0, count) by static chunks. Partial results are combined in chunk order on the calling thread.
+     * @tparam T Type of the processed elements, used to align chunks to cache lines.
+     * @param count Number of elements.
+     * @param policy Execution policy.
+     * @param identity Initial value of every partial result.
+     * @param fn Chunk function fn(from, to, partial) returning the updated partial result.
+     * @param combine Function combining two partial results.
+     * @return Reduced value.
+     */
+    template<typename T, typename R, typename ChunkFunction, typename CombineFunction>
+    R parallel_reduce(const size_t count, const ExecutionPolicy policy, const R &identity, ChunkFunction fn,
+                      CombineFunction combine)
+    {
+        const size_t chunkSize = parallel_chunk_size<T>(count, policy);
+        if (chunkSize >= count)
+        {
+            return fn(static_cast<size_t>(0), count, identity);
+        }
+        const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        std::vector<R> partials(chunkCount, identity);
+        ThreadPool::global().run(chunkCount, [&](const size_t chunk)
+        {
+            const size_t from = chunk * chunkSize;
+            partials[chunk] = fn(from, std::min(count, from + chunkSize), identity);
+        });
+
+        R result = partials[0];
+        for (size_t i = 1; i < chunkCount; ++i)
+        {
+            result = combine(result, partials[i]);
+        }
+        return result;
+    }
+}
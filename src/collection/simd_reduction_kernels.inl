@@ -0,0 +1,149 @@
+// Reduction kernels written against the Ops interface of one instruction set:
+//  Scalar, Vector, Lanes, zero(), broadcast(), load(), store(), add(), sub(), min(), max()
+//  and equal_mask(), which returns bit mask of the lanes with equal values.
+// This file is included by simd_reductions.cpp inside the target pragma region of every instruction set,
+// so that the kernels are compiled with its target options.
+
+template<typename Ops>
+static typename Ops::Scalar sum_kernel(const typename Ops::Scalar *data, const size_t count)
+{
+    using T = typename Ops::Scalar;
+    constexpr size_t L = Ops::Lanes;
+    // Four accumulators hide the latency of the vector addition.
+    typename Ops::Vector acc0 = Ops::zero(), acc1 = Ops::zero(), acc2 = Ops::zero(), acc3 = Ops::zero();
+    size_t i = 0;
+    for (; i + (4 * L) <= count; i += 4 * L)
+    {
+        acc0 = Ops::add(acc0, Ops::load(data + i));
+        acc1 = Ops::add(acc1, Ops::load(data + i + L));
+        acc2 = Ops::add(acc2, Ops::load(data + i + (2 * L)));
+        acc3 = Ops::add(acc3, Ops::load(data + i + (3 * L)));
+    }
+    for (; i + L <= count; i += L)
+    {
+        acc0 = Ops::add(acc0, Ops::load(data + i));
+    }
+    T lanes[L];
+    Ops::store(lanes, Ops::add(Ops::add(acc0, acc1), Ops::add(acc2, acc3)));
+    T sum = generic_sum(lanes, L);
+    for (; i < count; ++i)
+    {
+        sum += data[i];
+    }
+    return sum;
+}
+
+template<typename Ops>
+static typename Ops::Scalar compensated_sum_kernel(const typename Ops::Scalar *data, const size_t count)
+{
+    using T = typename Ops::Scalar;
+    constexpr size_t L = Ops::Lanes;
+    typename Ops::Vector sum = Ops::zero(), compensation = Ops::zero();
+    size_t i = 0;
+    for (; i + L <= count; i += L)
+    {
+        const typename Ops::Vector y = Ops::sub(Ops::load(data + i), compensation);
+        const typename Ops::Vector t = Ops::add(sum, y);
+        compensation = Ops::sub(Ops::sub(t, sum), y);
+        sum = t;
+    }
+    T sumLanes[L];
+    T compensationLanes[L];
+    Ops::store(sumLanes, sum);
+    Ops::store(compensationLanes, compensation);
+    T result{};
+    T resultCompensation{};
+    for (size_t lane = 0; lane < L; ++lane)
+    {
+        compensated_add(result, resultCompensation, sumLanes[lane]);
+        compensated_add(result, resultCompensation, -compensationLanes[lane]);
+    }
+    for (; i < count; ++i)
+    {
+        compensated_add(result, resultCompensation, data[i]);
+    }
+    return result + resultCompensation;
+}
+
+template<typename Ops>
+static std::pair<typename Ops::Scalar, typename Ops::Scalar> min_max_kernel(const typename Ops::Scalar *data,
+                                                                            const size_t count)
+{
+    using T = typename Ops::Scalar;
+    constexpr size_t L = Ops::Lanes;
+    T minimum = data[0];
+    T maximum = data[0];
+    size_t i = 0;
+    if (count >= 2 * L)
+    {
+        typename Ops::Vector min0 = Ops::load(data), max0 = min0;
+        typename Ops::Vector min1 = Ops::load(data + L), max1 = min1;
+        for (i = 2 * L; i + (2 * L) <= count; i += 2 * L)
+        {
+            const typename Ops::Vector v0 = Ops::load(data + i);
+            const typename Ops::Vector v1 = Ops::load(data + i + L);
+            min0 = Ops::min(min0, v0);
+            max0 = Ops::max(max0, v0);
+            min1 = Ops::min(min1, v1);
+            max1 = Ops::max(max1, v1);
+        }
+        T minLanes[L];
+        T maxLanes[L];
+        Ops::store(minLanes, Ops::min(min0, min1));
+        Ops::store(maxLanes, Ops::max(max0, max1));
+        for (size_t lane = 0; lane < L; ++lane)
+        {
+            minimum = std::min(minimum, minLanes[lane]);
+            maximum = std::max(maximum, maxLanes[lane]);
+        }
+    }
+    for (; i < count; ++i)
+    {
+        minimum = std::min(minimum, data[i]);
+        maximum = std::max(maximum, data[i]);
+    }
+    return std::make_pair(minimum, maximum);
+}
+
+template<typename Ops>
+static size_t count_kernel(const typename Ops::Scalar *data, const size_t count, const typename Ops::Scalar value)
+{
+    constexpr size_t L = Ops::Lanes;
+    const typename Ops::Vector needle = Ops::broadcast(value);
+    size_t result = 0;
+    size_t i = 0;
+    // Masks of four vectors are packed into one word, so that only one popcount is needed for them.
+    for (; i + (4 * L) <= count; i += 4 * L)
+    {
+        const unsigned mask = static_cast<unsigned>(Ops::equal_mask(Ops::load(data + i), needle)) |
+                              (static_cast<unsigned>(Ops::equal_mask(Ops::load(data + i + L), needle)) << L) |
+                              (static_cast<unsigned>(Ops::equal_mask(Ops::load(data + i + (2 * L)), needle)) << (2 * L)) |
+                              (static_cast<unsigned>(Ops::equal_mask(Ops::load(data + i + (3 * L)), needle)) << (3 * L));
+        result += static_cast<size_t>(__builtin_popcount(mask));
+    }
+    for (; i < count; ++i)
+    {
+        result += (data[i] == value) ? 1 : 0;
+    }
+    return result;
+}
+
+template<typename Ops>
+static bool contains_kernel(const typename Ops::Scalar *data, const size_t count, const typename Ops::Scalar value)
+{
+    constexpr size_t L = Ops::Lanes;
+    const typename Ops::Vector needle = Ops::broadcast(value);
+    size_t i = 0;
+    for (; i + (4 * L) <= count; i += 4 * L)
+    {
+        const int mask = Ops::equal_mask(Ops::load(data + i), needle) |
+                         Ops::equal_mask(Ops::load(data + i + L), needle) |
+                         Ops::equal_mask(Ops::load(data + i + (2 * L)), needle) |
+                         Ops::equal_mask(Ops::load(data + i + (3 * L)), needle);
+        if (mask != 0)
+        {
+            return true;
+        }
+    }
+    return generic_contains(data + i, count - i, value);
+}
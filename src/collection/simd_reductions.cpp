@@ -0,0 +1,498 @@
+#include <azgra/collection/simd_reductions.h>
+#include <algorithm>
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define AZGRA_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace azgra::collection
+{
+    /**
+     * Number of values summed by the vector kernel, before the block sums are combined pairwise.
+     */
+    constexpr size_t PairwiseBlockSize = 512;
+
+    /**
+     * Reduction kernels for one type, selected once for the running CPU.
+     */
+    template<typename T>
+    struct ReductionKernels
+    {
+        T (*sum)(const T *data, size_t count);
+        T (*compensatedSum)(const T *data, size_t count);
+        std::pair<T, T> (*minMax)(const T *data, size_t count);
+        size_t (*count)(const T *data, size_t count, T value);
+        bool (*contains)(const T *data, size_t count, T value);
+        const char *name;
+    };
+
+    // Neumaier variant of the Kahan summation, it also compensates values larger than the running sum.
+    // Compensated result is sum + compensation.
+    template<typename T>
+    static void compensated_add(T &sum, T &compensation, const T value)
+    {
+        const T t = sum + value;
+        if (std::abs(sum) >= std::abs(value))
+        {
+            compensation += (sum - t) + value;
+        }
+        else
+        {
+            compensation += (value - t) + sum;
+        }
+        sum = t;
+    }
+
+    template<typename T>
+    static T generic_sum(const T *data, const size_t count)
+    {
+        T sum{};
+        for (size_t i = 0; i < count; ++i)
+        {
+            sum += data[i];
+        }
+        return sum;
+    }
+
+    template<typename T>
+    static T generic_compensated_sum(const T *data, const size_t count)
+    {
+        T sum{};
+        T compensation{};
+        for (size_t i = 0; i < count; ++i)
+        {
+            compensated_add(sum, compensation, data[i]);
+        }
+        return sum + compensation;
+    }
+
+    template<typename T>
+    static std::pair<T, T> generic_min_max(const T *data, const size_t count)
+    {
+        T minimum = data[0];
+        T maximum = data[0];
+        for (size_t i = 1; i < count; ++i)
+        {
+            minimum = std::min(minimum, data[i]);
+            maximum = std::max(maximum, data[i]);
+        }
+        return std::make_pair(minimum, maximum);
+    }
+
+    template<typename T>
+    static size_t generic_count(const T *data, const size_t count, const T value)
+    {
+        return static_cast<size_t>(std::count(data, data + count, value));
+    }
+
+    template<typename T>
+    static bool generic_contains(const T *data, const size_t count, const T value)
+    {
+        return std::find(data, data + count, value) != (data + count);
+    }
+
+#ifdef AZGRA_X86_SIMD
+
+    // Every instruction set defines its Ops and instantiates the kernels from simd_reduction_kernels.inl
+    // in its own namespace, so that they are compiled with its target options.
+
+#pragma GCC push_options
+#pragma GCC target("avx2,popcnt")
+
+    template<typename T>
+    struct Avx2Ops;
+
+    template<>
+    struct Avx2Ops<f32>
+    {
+        using Scalar = f32;
+        using Vector = __m256;
+        static constexpr size_t Lanes = 8;
+
+        static Vector zero() { return _mm256_setzero_ps(); }
+
+        static Vector broadcast(const Scalar value) { return _mm256_set1_ps(value); }
+
+        static Vector load(const Scalar *data) { return _mm256_loadu_ps(data); }
+
+        static void store(Scalar *data, const Vector v) { _mm256_storeu_ps(data, v); }
+
+        static Vector add(const Vector a, const Vector b) { return _mm256_add_ps(a, b); }
+
+        static Vector sub(const Vector a, const Vector b) { return _mm256_sub_ps(a, b); }
+
+        static Vector min(const Vector a, const Vector b) { return _mm256_min_ps(a, b); }
+
+        static Vector max(const Vector a, const Vector b) { return _mm256_max_ps(a, b); }
+
+        static int equal_mask(const Vector a, const Vector b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+    };
+
+    template<>
+    struct Avx2Ops<f64>
+    {
+        using Scalar = f64;
+        using Vector = __m256d;
+        static constexpr size_t Lanes = 4;
+
+        static Vector zero() { return _mm256_setzero_pd(); }
+
+        static Vector broadcast(const Scalar value) { return _mm256_set1_pd(value); }
+
+        static Vector load(const Scalar *data) { return _mm256_loadu_pd(data); }
+
+        static void store(Scalar *data, const Vector v) { _mm256_storeu_pd(data, v); }
+
+        static Vector add(const Vector a, const Vector b) { return _mm256_add_pd(a, b); }
+
+        static Vector sub(const Vector a, const Vector b) { return _mm256_sub_pd(a, b); }
+
+        static Vector min(const Vector a, const Vector b) { return _mm256_min_pd(a, b); }
+
+        static Vector max(const Vector a, const Vector b) { return _mm256_max_pd(a, b); }
+
+        static int equal_mask(const Vector a, const Vector b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+    };
+
+    template<>
+    struct Avx2Ops<i32>
+    {
+        using Scalar = i32;
+        using Vector = __m256i;
+        static constexpr size_t Lanes = 8;
+
+        static Vector zero() { return _mm256_setzero_si256(); }
+
+        static Vector broadcast(const Scalar value) { return _mm256_set1_epi32(value); }
+
+        static Vector load(const Scalar *data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data)); }
+
+        static void store(Scalar *data, const Vector v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(data), v); }
+
+        static Vector add(const Vector a, const Vector b) { return _mm256_add_epi32(a, b); }
+
+        static Vector min(const Vector a, const Vector b) { return _mm256_min_epi32(a, b); }
+
+        static Vector max(const Vector a, const Vector b) { return _mm256_max_epi32(a, b); }
+
+        static int equal_mask(const Vector a, const Vector b)
+        {
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+        }
+    };
+
+    template<>
+    struct Avx2Ops<i64>
+    {
+        using Scalar = i64;
+        using Vector = __m256i;
+        static constexpr size_t Lanes = 4;
+
+        static Vector zero() { return _mm256_setzero_si256(); }
+
+        static Vector broadcast(const Scalar value) { return _mm256_set1_epi64x(value); }
+
+        static Vector load(const Scalar *data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data)); }
+
+        static void store(Scalar *data, const Vector v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(data), v); }
+
+        static Vector add(const Vector a, const Vector b) { return _mm256_add_epi64(a, b); }
+
+        // AVX2 has no 64-bit min and max, lanes are selected by the comparison.
+        static Vector min(const Vector a, const Vector b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+
+        static Vector max(const Vector a, const Vector b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a)); }
+
+        static int equal_mask(const Vector a, const Vector b)
+        {
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+        }
+    };
+
+    namespace avx2
+    {
+#include "simd_reduction_kernels.inl"
+    }
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("sse4.2,popcnt")
+
+    template<typename T>
+    struct SseOps;
+
+    template<>
+    struct SseOps<f32>
+    {
+        using Scalar = f32;
+        using Vector = __m128;
+        static constexpr size_t Lanes = 4;
+
+        static Vector zero() { return _mm_setzero_ps(); }
+
+        static Vector broadcast(const Scalar value) { return _mm_set1_ps(value); }
+
+        static Vector load(const Scalar *data) { return _mm_loadu_ps(data); }
+
+        static void store(Scalar *data, const Vector v) { _mm_storeu_ps(data, v); }
+
+        static Vector add(const Vector a, const Vector b) { return _mm_add_ps(a, b); }
+
+        static Vector sub(const Vector a, const Vector b) { return _mm_sub_ps(a, b); }
+
+        static Vector min(const Vector a, const Vector b) { return _mm_min_ps(a, b); }
+
+        static Vector max(const Vector a, const Vector b) { return _mm_max_ps(a, b); }
+
+        static int equal_mask(const Vector a, const Vector b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    };
+
+    template<>
+    struct SseOps<f64>
+    {
+        using Scalar = f64;
+        using Vector = __m128d;
+        static constexpr size_t Lanes = 2;
+
+        static Vector zero() { return _mm_setzero_pd(); }
+
+        static Vector broadcast(const Scalar value) { return _mm_set1_pd(value); }
+
+        static Vector load(const Scalar *data) { return _mm_loadu_pd(data); }
+
+        static void store(Scalar *data, const Vector v) { _mm_storeu_pd(data, v); }
+
+        static Vector add(const Vector a, const Vector b) { return _mm_add_pd(a, b); }
+
+        static Vector sub(const Vector a, const Vector b) { return _mm_sub_pd(a, b); }
+
+        static Vector min(const Vector a, const Vector b) { return _mm_min_pd(a, b); }
+
+        static Vector max(const Vector a, const Vector b) { return _mm_max_pd(a, b); }
+
+        static int equal_mask(const Vector a, const Vector b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+    };
+
+    template<>
+    struct SseOps<i32>
+    {
+        using Scalar = i32;
+        using Vector = __m128i;
+        static constexpr size_t Lanes = 4;
+
+        static Vector zero() { return _mm_setzero_si128(); }
+
+        static Vector broadcast(const Scalar value) { return _mm_set1_epi32(value); }
+
+        static Vector load(const Scalar *data) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)); }
+
+        static void store(Scalar *data, const Vector v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(data), v); }
+
+        static Vector add(const Vector a, const Vector b) { return _mm_add_epi32(a, b); }
+
+        static Vector min(const Vector a, const Vector b) { return _mm_min_epi32(a, b); }
+
+        static Vector max(const Vector a, const Vector b) { return _mm_max_epi32(a, b); }
+
+        static int equal_mask(const Vector a, const Vector b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+    };
+
+    template<>
+    struct SseOps<i64>
+    {
+        using Scalar = i64;
+        using Vector = __m128i;
+        static constexpr size_t Lanes = 2;
+
+        static Vector zero() { return _mm_setzero_si128(); }
+
+        static Vector broadcast(const Scalar value) { return _mm_set1_epi64x(value); }
+
+        static Vector load(const Scalar *data) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)); }
+
+        static void store(Scalar *data, const Vector v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(data), v); }
+
+        static Vector add(const Vector a, const Vector b) { return _mm_add_epi64(a, b); }
+
+        static Vector min(const Vector a, const Vector b) { return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b)); }
+
+        static Vector max(const Vector a, const Vector b) { return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(b, a)); }
+
+        static int equal_mask(const Vector a, const Vector b) { return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b))); }
+    };
+
+    namespace sse
+    {
+#include "simd_reduction_kernels.inl"
+    }
+
+#pragma GCC pop_options
+
+    static bool cpu_supports_avx2()
+    {
+        static const bool supported = (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"));
+        return supported;
+    }
+
+    static bool cpu_supports_sse42()
+    {
+        static const bool supported = (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"));
+        return supported;
+    }
+
+#endif
+
+    template<typename T>
+    static ReductionKernels<T> select_reduction_kernels()
+    {
+#ifdef AZGRA_X86_SIMD
+        if (cpu_supports_avx2())
+        {
+            using Ops = Avx2Ops<T>;
+            ReductionKernels<T> kernels{&avx2::sum_kernel<Ops>, &avx2::sum_kernel<Ops>, &avx2::min_max_kernel<Ops>,
+                                        &avx2::count_kernel<Ops>, &avx2::contains_kernel<Ops>, "avx2"};
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                kernels.compensatedSum = &avx2::compensated_sum_kernel<Ops>;
+            }
+            return kernels;
+        }
+        if (cpu_supports_sse42())
+        {
+            using Ops = SseOps<T>;
+            ReductionKernels<T> kernels{&sse::sum_kernel<Ops>, &sse::sum_kernel<Ops>, &sse::min_max_kernel<Ops>,
+                                        &sse::count_kernel<Ops>, &sse::contains_kernel<Ops>, "sse4.2"};
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                kernels.compensatedSum = &sse::compensated_sum_kernel<Ops>;
+            }
+            return kernels;
+        }
+#endif
+        return ReductionKernels<T>{&generic_sum<T>, &generic_compensated_sum<T>, &generic_min_max<T>,
+                                   &generic_count<T>, &generic_contains<T>, "generic"};
+    }
+
+    template<typename T>
+    static const ReductionKernels<T> &reduction_kernels()
+    {
+        static const ReductionKernels<T> kernels = select_reduction_kernels<T>();
+        return kernels;
+    }
+
+    template<typename T>
+    static T pairwise_sum(const T *data, const size_t count, T (*blockSum)(const T *, size_t))
+    {
+        if (count <= PairwiseBlockSize)
+        {
+            return blockSum(data, count);
+        }
+        // Split at the block boundary, so that all blocks, but the last one, are full.
+        const size_t half = (((count / PairwiseBlockSize) + 1) / 2) * PairwiseBlockSize;
+        return pairwise_sum(data, half, blockSum) + pairwise_sum(data + half, count - half, blockSum);
+    }
+
+    template<typename T>
+    static T float_sum(const T *data, const size_t count, const SummationMode mode)
+    {
+        const ReductionKernels<T> &kernels = reduction_kernels<T>();
+        switch (mode)
+        {
+            case SummationMode_Pairwise:
+                return pairwise_sum(data, count, kernels.sum);
+            case SummationMode_Kahan:
+                return kernels.compensatedSum(data, count);
+            case SummationMode_Fast:
+            default:
+                return kernels.sum(data, count);
+        }
+    }
+
+    const char *simd_reduction_kernel_name()
+    {
+        return reduction_kernels<f32>().name;
+    }
+
+    f32 simd_sum(const f32 *data, const size_t count, const SummationMode mode)
+    {
+        return float_sum(data, count, mode);
+    }
+
+    f64 simd_sum(const f64 *data, const size_t count, const SummationMode mode)
+    {
+        return float_sum(data, count, mode);
+    }
+
+    i32 simd_sum(const i32 *data, const size_t count)
+    {
+        return reduction_kernels<i32>().sum(data, count);
+    }
+
+    i64 simd_sum(const i64 *data, const size_t count)
+    {
+        return reduction_kernels<i64>().sum(data, count);
+    }
+
+    std::pair<f32, f32> simd_min_max(const f32 *data, const size_t count)
+    {
+        return reduction_kernels<f32>().minMax(data, count);
+    }
+
+    std::pair<f64, f64> simd_min_max(const f64 *data, const size_t count)
+    {
+        return reduction_kernels<f64>().minMax(data, count);
+    }
+
+    std::pair<i32, i32> simd_min_max(const i32 *data, const size_t count)
+    {
+        return reduction_kernels<i32>().minMax(data, count);
+    }
+
+    std::pair<i64, i64> simd_min_max(const i64 *data, const size_t count)
+    {
+        return reduction_kernels<i64>().minMax(data, count);
+    }
+
+    size_t simd_count(const f32 *data, const size_t count, const f32 value)
+    {
+        return reduction_kernels<f32>().count(data, count, value);
+    }
+
+    size_t simd_count(const f64 *data, const size_t count, const f64 value)
+    {
+        return reduction_kernels<f64>().count(data, count, value);
+    }
+
+    size_t simd_count(const i32 *data, const size_t count, const i32 value)
+    {
+        return reduction_kernels<i32>().count(data, count, value);
+    }
+
+    size_t simd_count(const i64 *data, const size_t count, const i64 value)
+    {
+        return reduction_kernels<i64>().count(data, count, value);
+    }
+
+    bool simd_contains(const f32 *data, const size_t count, const f32 value)
+    {
+        return reduction_kernels<f32>().contains(data, count, value);
+    }
+
+    bool simd_contains(const f64 *data, const size_t count, const f64 value)
+    {
+        return reduction_kernels<f64>().contains(data, count, value);
+    }
+
+    bool simd_contains(const i32 *data, const size_t count, const i32 value)
+    {
+        return reduction_kernels<i32>().contains(data, count, value);
+    }
+
+    bool simd_contains(const i64 *data, const size_t count, const i64 value)
+    {
+        return reduction_kernels<i64>().contains(data, count, value);
+    }
+}
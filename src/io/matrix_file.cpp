@@ -0,0 +1,79 @@
+#include <azgra/io/matrix_file.h>
+#include <algorithm>
+
+namespace azgra::io
+{
+    size_t matrix_element_size(const MatrixElementType elementType)
+    {
+        switch (elementType)
+        {
+            case MatrixElementType_U8:
+            case MatrixElementType_I8:
+                return 1;
+            case MatrixElementType_U16:
+            case MatrixElementType_I16:
+                return 2;
+            case MatrixElementType_U32:
+            case MatrixElementType_I32:
+            case MatrixElementType_F32:
+                return 4;
+            case MatrixElementType_U64:
+            case MatrixElementType_I64:
+            case MatrixElementType_F64:
+                return 8;
+        }
+        return 0;
+    }
+
+    MatrixFileHeader make_matrix_file_header(const MatrixElementType elementType, const size_t rowCount,
+                                             const size_t colCount, const bool rowBased)
+    {
+        MatrixFileHeader header{};
+        std::memcpy(header.magic, MatrixFileMagic, sizeof(MatrixFileMagic));
+        header.version = MatrixFileVersion;
+        header.byteOrderMark = MatrixFileByteOrderMark;
+        header.elementType = static_cast<u32>(elementType);
+        header.elementSize = static_cast<u32>(matrix_element_size(elementType));
+        header.rowBased = rowBased ? 1 : 0;
+        header.alignment = static_cast<u32>(SimdAlignment);
+        header.rowCount = rowCount;
+        header.colCount = colCount;
+        header.dataOffset = ((sizeof(MatrixFileHeader) + SimdAlignment - 1) / SimdAlignment) * SimdAlignment;
+        return header;
+    }
+
+    bool is_valid_matrix_file_header(const MatrixFileHeader &header, const size_t fileSize)
+    {
+        if (fileSize < sizeof(MatrixFileHeader) ||
+            std::memcmp(header.magic, MatrixFileMagic, sizeof(MatrixFileMagic)) != 0 ||
+            header.version != MatrixFileVersion ||
+            header.byteOrderMark != MatrixFileByteOrderMark ||
+            header.elementType > MatrixElementType_F64 ||
+            header.elementSize != matrix_element_size(static_cast<MatrixElementType>(header.elementType)) ||
+            header.alignment == 0 ||
+            (header.dataOffset % header.alignment) != 0 ||
+            header.dataOffset < sizeof(MatrixFileHeader))
+        {
+            return false;
+        }
+        // Guard the multiplication against overflow of the forged header.
+        const u64 availableBytes = fileSize - std::min<u64>(fileSize, header.dataOffset);
+        if (header.rowCount != 0 && header.colCount > (availableBytes / header.elementSize) / header.rowCount)
+        {
+            return false;
+        }
+        return (header.dataOffset + (header.rowCount * header.colCount * header.elementSize)) <= fileSize;
+    }
+
+    MappedMatrixFile::MappedMatrixFile(const char *fileName) : m_file(fileName)
+    {
+        always_assert(m_file.size() >= sizeof(MatrixFileHeader) && "File is too small to be a matrix file.");
+        std::memcpy(&m_header, m_file.data(), sizeof(MatrixFileHeader));
+        always_assert(is_valid_matrix_file_header(m_header, m_file.size()) && "Invalid matrix file header.");
+    }
+
+    void MappedMatrixFile::advise(const MemoryAccessPattern pattern) const
+    {
+        m_file.advise(pattern, m_header.dataOffset, m_file.size() - m_header.dataOffset);
+    }
+}
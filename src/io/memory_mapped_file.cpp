@@ -0,0 +1,124 @@
+#include <azgra/io/memory_mapped_file.h>
+#include <utility>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+namespace azgra::io
+{
+    MemoryMappedFile::MemoryMappedFile(const char *fileName)
+    {
+#ifdef _WIN32
+        std::ifstream fileStream(fileName, std::ios::in | std::ios::binary | std::ios::ate);
+        always_assert(fileStream.is_open() && "Failed to open file for mapping.");
+        m_size = static_cast<size_t>(fileStream.tellg());
+        fileStream.seekg(0);
+        m_buffer.resize(m_size);
+        fileStream.read(reinterpret_cast<char *>(m_buffer.data()), static_cast<std::streamsize>(m_size));
+        m_data = m_buffer.empty() ? nullptr : m_buffer.data();
+#else
+        const int fd = ::open(fileName, O_RDONLY);
+        always_assert(fd >= 0 && "Failed to open file for mapping.");
+        struct stat fileStat{};
+        const int statResult = ::fstat(fd, &fileStat);
+        always_assert(statResult == 0 && "Failed to get size of the mapped file.");
+        m_size = static_cast<size_t>(fileStat.st_size);
+        if (m_size > 0)
+        {
+            void *mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            always_assert(mapping != MAP_FAILED && "Failed to map file.");
+            m_data = static_cast<const byte *>(mapping);
+        }
+        // Mapping stays valid after the descriptor is closed.
+        ::close(fd);
+#endif
+        m_mapped = true;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        unmap();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile &&other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MemoryMappedFile &MemoryMappedFile::operator=(MemoryMappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_mapped = std::exchange(other.m_mapped, false);
+#ifdef _WIN32
+            m_buffer = std::move(other.m_buffer);
+#endif
+        }
+        return *this;
+    }
+
+    void MemoryMappedFile::unmap() noexcept
+    {
+#ifdef _WIN32
+        m_buffer.clear();
+        m_buffer.shrink_to_fit();
+#else
+        if (m_data != nullptr)
+        {
+            ::munmap(const_cast<byte *>(m_data), m_size);
+        }
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_mapped = false;
+    }
+
+    void MemoryMappedFile::close() noexcept
+    {
+        unmap();
+    }
+
+    void MemoryMappedFile::advise(const MemoryAccessPattern pattern, const size_t offset, const size_t byteCount) const
+    {
+        always_assert((offset + byteCount) <= m_size);
+#ifdef _WIN32
+        (void) pattern;
+#else
+        if (m_data == nullptr || byteCount == 0)
+        {
+            return;
+        }
+        int advice = MADV_NORMAL;
+        switch (pattern)
+        {
+            case MemoryAccessPattern_Normal:
+                advice = MADV_NORMAL;
+                break;
+            case MemoryAccessPattern_Sequential:
+                advice = MADV_SEQUENTIAL;
+                break;
+            case MemoryAccessPattern_Random:
+                advice = MADV_RANDOM;
+                break;
+            case MemoryAccessPattern_WillNeed:
+                advice = MADV_WILLNEED;
+                break;
+        }
+        // madvise requires page aligned start, the range is extended down to the page boundary.
+        const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t alignedOffset = (offset / pageSize) * pageSize;
+        ::madvise(const_cast<byte *>(m_data) + alignedOffset, byteCount + (offset - alignedOffset), advice);
+#endif
+    }
+}
@@ -1,4 +1,5 @@
 #include <azgra/io/stream/in_binary_buffer_stream.h>
+#include <algorithm>
 
 namespace azgra::io::stream
 {
@@ -14,16 +15,21 @@ namespace azgra::io::stream
         this->isOpen = true;
         this->underlayingSourceType = BufferSourceType_Memory;
         this->memoryBuffer = bytes;
-        this->currentBufferPosition = 0;
+        set_buffer_position(0);
     }
 
-    InBinaryBufferStream::InBinaryBufferStream(InBinaryStreamBase *stream, const azgra::i64 streamBufferSize)
+    InBinaryBufferStream::InBinaryBufferStream(InBinaryStreamBase *stream, const azgra::i64 streamBufferSize,
+                                               const azgra::u32 readAheadDepth)
     {
         this->isOpen = stream->is_open();
         this->underlayingSourceType = BufferSourceType_Stream;
         this->streamBufferSize = streamBufferSize;
         this->underlayingStream = stream;
-        this->currentBufferPosition = 0;
+        set_buffer_position(0);
+        if (readAheadDepth > 1)
+        {
+            this->readAhead = std::make_unique<StreamReadAhead>(streamBufferSize, readAheadDepth);
+        }
     }
 
     InBinaryBufferStream::~InBinaryBufferStream()
@@ -75,14 +81,14 @@ namespace azgra::io::stream
         {
             case BufferSourceType_Memory:
             {
-                return this->currentBufferPosition;
+                return buffer_position();
             }
                 break;
             case BufferSourceType_Stream:
             {
-                always_assert(this->currentBufferPosition <= this->streamBufferSize);
-                azgra::i64 pos = (this->readedFromSource > 0) ? this->readedFromSource -
-                                                                (this->streamBufferSize - this->currentBufferPosition) : 0;
+                // Last buffer of the stream can be shorter than streamBufferSize.
+                always_assert(buffer_position() <= this->streamBuffer.size());
+                azgra::i64 pos = this->readedFromSource - (this->streamBuffer.size() - buffer_position());
                 return pos;
             }
                 break;
@@ -121,6 +127,55 @@ namespace azgra::io::stream
         return 0;
     }
 
+    azgra::u64 InBinaryBufferStream::buffer_position() const
+    {
+        const byte *bufferData = (this->underlayingSourceType == BufferSourceType_Memory) ? this->memoryBuffer->data()
+                                                                                          : this->streamBuffer.data();
+        return static_cast<azgra::u64>(this->directReadPosition - bufferData);
+    }
+
+    void InBinaryBufferStream::set_buffer_position(const azgra::u64 position)
+    {
+        const ByteArray &buffer = (this->underlayingSourceType == BufferSourceType_Memory) ? *this->memoryBuffer
+                                                                                           : this->streamBuffer;
+        always_assert(position <= buffer.size());
+        this->directReadPosition = buffer.data() + position;
+        this->directReadEnd = buffer.data() + buffer.size();
+    }
+
+    void InBinaryBufferStream::reload_stream_buffer(const azgra::i64 position)
+    {
+        if (this->readAhead)
+        {
+            // Buffers are filled by the read-ahead from the new position, the first read waits for them.
+            this->readAhead->stop();
+            this->streamBuffer.clear();
+            this->readedFromSource = position;
+            set_buffer_position(0);
+            this->readAhead->start(this->underlayingStream, position);
+            return;
+        }
+
+        this->underlayingStream->move_to(position);
+        azgra::u64 toConsume = get_consume_size();
+        this->streamBuffer.resize(toConsume);
+        this->underlayingStream->consume_into(this->streamBuffer, 0, toConsume);
+        this->readedFromSource = this->underlayingStream->get_position();
+        set_buffer_position(0);
+    }
+
+    void InBinaryBufferStream::next_read_ahead_buffer()
+    {
+        if (!this->readAhead->is_running())
+        {
+            this->readAhead->start(this->underlayingStream, this->readedFromSource);
+        }
+        const bool filled = this->readAhead->next_buffer(this->streamBuffer);
+        always_assert(filled && "Reading past the end of the stream.");
+        this->readedFromSource += this->streamBuffer.size();
+        set_buffer_position(0);
+    }
+
     void InBinaryBufferStream::move_to(const azgra::i64 position)
     {
         always_assert(position < get_size());
@@ -129,22 +184,13 @@ namespace azgra::io::stream
         {
             case BufferSourceType_Memory:
             {
-                this->currentBufferPosition = position;
+                set_buffer_position(position);
             }
                 break;
             case BufferSourceType_Stream:
             {
-
                 // move_to will always reload the buffer.
-                this->underlayingStream->move_to(position);
-                azgra::u64 toConsume = get_consume_size();
-                this->streamBuffer = this->underlayingStream->consume_bytes(toConsume);
-                this->readedFromSource = this->underlayingStream->get_position();
-
-                // Just for sure.
-                //always_assert(this->readedFromSource == position + this->streamBufferSize);
-
-                this->currentBufferPosition = 0;
+                reload_stream_buffer(position);
             }
                 break;
             default:
@@ -159,16 +205,13 @@ namespace azgra::io::stream
         {
             case BufferSourceType_Memory:
             {
-                this->currentBufferPosition = 0;
+                set_buffer_position(0);
             }
                 break;
             case BufferSourceType_Stream:
             {
                 // move_to_beginning will always reload the buffer.
-                this->underlayingStream->move_to_beginning();
-                this->streamBuffer = this->underlayingStream->consume_bytes(get_consume_size());
-                this->readedFromSource = this->streamBufferSize;
-                this->currentBufferPosition = 0;
+                reload_stream_buffer(0);
             }
                 break;
             default:
@@ -179,15 +222,23 @@ namespace azgra::io::stream
 
     void InBinaryBufferStream::move_to_end()
     {
-        this->currentBufferPosition = get_size();
         switch (this->underlayingSourceType)
         {
+            case BufferSourceType_Memory:
+            {
+                set_buffer_position(get_size());
+            }
+                break;
             case BufferSourceType_Stream:
             {
-                // move_to_beginning will always clear the buffer.
+                // move_to_end will always clear the buffer.
+                if (this->readAhead)
+                {
+                    this->readAhead->stop();
+                }
                 this->streamBuffer.clear();
-                this->readedFromSource = this->currentBufferPosition;
-                this->currentBufferPosition = 0;
+                this->readedFromSource = get_size();
+                set_buffer_position(0);
             }
                 break;
             default:
@@ -204,16 +255,16 @@ namespace azgra::io::stream
         {
             case BufferSourceType_Memory:
             {
-                always_assert((this->currentBufferPosition + distance) < this->memoryBuffer->size());
-                this->currentBufferPosition += distance;
+                always_assert((buffer_position() + distance) < this->memoryBuffer->size());
+                set_buffer_position(buffer_position() + distance);
             }
                 break;
             case BufferSourceType_Stream:
             {
                 // If atleast one byte can be read, just advance the buffer position.
-                if ((this->currentBufferPosition + distance + 1) < this->streamBufferSize)
+                if ((buffer_position() + distance + 1) < this->streamBuffer.size())
                 {
-                    this->currentBufferPosition += distance;
+                    set_buffer_position(buffer_position() + distance);
                 }
                 else
                 {
@@ -221,12 +272,7 @@ namespace azgra::io::stream
                     azgra::i64 currentPosInStreamRelativeToBufferPos = get_position();
 
                     always_assert((currentPosInStreamRelativeToBufferPos + distance) < this->underlayingStream->get_size());
-                    this->underlayingStream->move_to((currentPosInStreamRelativeToBufferPos + distance));
-
-                    azgra::u64 toConsume = get_consume_size();
-                    this->streamBuffer = this->underlayingStream->consume_bytes(toConsume);
-                    this->readedFromSource = this->underlayingStream->get_position();
-                    this->currentBufferPosition = 0;
+                    reload_stream_buffer(currentPosInStreamRelativeToBufferPos + distance);
                 }
             }
                 break;
@@ -238,32 +284,57 @@ namespace azgra::io::stream
 
     ByteArray InBinaryBufferStream::consume_bytes(const azgra::u64 byteCount)
     {
-        if (this->streamBufferSize < byteCount)
+        ByteArray result(byteCount);
+        read_raw(result.data(), byteCount);
+        return result;
+    }
+
+    void InBinaryBufferStream::read_raw(byte *dst, const azgra::u64 byteCount)
+    {
+        // We won't allow consuming more bytes than is buffer size, unless they are copied from the read-ahead buffers.
+        if (!this->readAhead && (this->streamBufferSize < byteCount))
         {
             printf("To parse this file, you need buffer of size atleast: %lu\n", byteCount);
         }
-        // We won't allow consuming more bytes than is buffer size.
-        always_assert(byteCount <= this->streamBufferSize && "Buffer is too small.");
+        always_assert((this->readAhead || byteCount <= this->streamBufferSize) && "Buffer is too small.");
+
+        if (byteCount == 0)
+            return;
 
         switch (this->underlayingSourceType)
         {
             case BufferSourceType_Memory:
             {
                 // Check how many bytes are avaible in memory buffer.
-                azgra::u64 bytesAvaible = this->memoryBuffer->size() - this->currentBufferPosition;
+                azgra::u64 bytesAvaible = this->memoryBuffer->size() - buffer_position();
                 always_assert(bytesAvaible >= byteCount);
 
-                auto fromIt = this->memoryBuffer->begin() + this->currentBufferPosition;
-                auto toIt = fromIt + byteCount;
-                this->currentBufferPosition += byteCount;
-
-                ByteArray result(fromIt, toIt);
-                return result;
+                std::memcpy(dst, this->memoryBuffer->data() + buffer_position(), byteCount);
+                set_buffer_position(buffer_position() + byteCount);
             }
                 break;
             case BufferSourceType_Stream:
             {
-                azgra::u64 bytesAvaible = this->streamBuffer.size() - this->currentBufferPosition;
+                azgra::u64 bytesAvaible = this->streamBuffer.size() - buffer_position();
+                if (this->readAhead && (byteCount > bytesAvaible))
+                {
+                    // Copy the end of the current buffer, the rest is in the next buffers of the read-ahead.
+                    azgra::u64 copied = 0;
+                    while (copied < byteCount)
+                    {
+                        if (bytesAvaible == 0)
+                        {
+                            next_read_ahead_buffer();
+                            bytesAvaible = this->streamBuffer.size();
+                        }
+                        const azgra::u64 toCopy = std::min(bytesAvaible, byteCount - copied);
+                        std::memcpy(dst + copied, this->streamBuffer.data() + buffer_position(), toCopy);
+                        set_buffer_position(buffer_position() + toCopy);
+                        bytesAvaible -= toCopy;
+                        copied += toCopy;
+                    }
+                    break;
+                }
                 if ((bytesAvaible == 0) || (byteCount > bytesAvaible))
                 {
                     azgra::i64 currentPos = get_position();
@@ -271,19 +342,13 @@ namespace azgra::io::stream
                     move_to(currentPos);
                 }
 
-                auto fromIt = this->streamBuffer.begin() + this->currentBufferPosition;
-                auto toIt = fromIt + byteCount;
-                this->currentBufferPosition += byteCount;
-
-                ByteArray result(fromIt, toIt);
-                return result;
+                std::memcpy(dst, this->streamBuffer.data() + buffer_position(), byteCount);
+                set_buffer_position(buffer_position() + byteCount);
             }
                 break;
             default:
                 always_assert(false && "Invalid BufferSourceType.");
                 break;
         }
-
-        return ByteArray();
     }
-} // namespace azgra
\ No newline at end of file
+} // namespace azgra
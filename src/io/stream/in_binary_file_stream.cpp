@@ -1,4 +1,5 @@
 #include <azgra/io/stream/in_binary_file_stream.h>
+#include <algorithm>
 
 namespace azgra::io::stream
 {
@@ -90,21 +91,37 @@ namespace azgra::io::stream
         this->fileStream.seekg(requiredPosition);
     }
 
+    ByteArray InBinaryFileStream::read_to_end(const azgra::i64 offset)
+    {
+        const azgra::u64 byteCount = (offset < this->fileSize) ? static_cast<azgra::u64>(this->fileSize - offset) : 0;
+        ByteArray result(byteCount);
+        azgra::u64 readCount = 0;
+        // Reads go through the opened stream, so that they see the same file even if its path was replaced.
+        // Reads larger than the stream buffer are passed directly to the file, without copying.
+        this->fileStream.clear();
+        this->fileStream.seekg(offset);
+        while (readCount < byteCount)
+        {
+            const azgra::u64 chunkSize = std::min(BulkReadChunkSize, byteCount - readCount);
+            this->fileStream.read(reinterpret_cast<char *>(result.data() + readCount), static_cast<std::streamsize>(chunkSize));
+            always_assert(this->fileStream.gcount() > 0 && "Failed to read the file.");
+            readCount += static_cast<azgra::u64>(this->fileStream.gcount());
+        }
+        this->fileStream.clear();
+        this->fileStream.seekg(this->fileSize);
+        return result;
+    }
+
     ByteArray InBinaryFileStream::consume_whole_file()
     {
         always_assert(this->isOpen);
-        ByteArray result;
-        this->fileStream.seekg(std::ios::beg);
-        result.insert(result.begin(), std::istream_iterator<byte>(this->fileStream), std::istream_iterator<byte>());
-        return result;
+        return read_to_end(0);
     }
 
     ByteArray InBinaryFileStream::consume_rest_of_file()
     {
         always_assert(this->isOpen);
-        ByteArray result;
-        result.insert(result.begin(), std::istream_iterator<byte>(this->fileStream), std::istream_iterator<byte>());
-        return result;
+        return read_to_end(get_position());
     }
 
     ByteArray InBinaryFileStream::consume_bytes(const azgra::u64 byteCount)
@@ -112,12 +129,17 @@ namespace azgra::io::stream
         always_assert(this->isOpen);
 
         ByteArray result(byteCount);
-        if (byteCount == 0)
-            return result;
+        read_raw(result.data(), byteCount);
+        return result;
+    }
 
-        fileStream.read(reinterpret_cast<char *>(result.data()), byteCount);
+    void InBinaryFileStream::read_raw(byte *dst, const azgra::u64 byteCount)
+    {
+        always_assert(this->isOpen);
+        if (byteCount == 0)
+            return;
 
-        return result;
+        fileStream.read(reinterpret_cast<char *>(dst), byteCount);
     }
 
     void InBinaryFileStream::consume_into(ByteArray &dst, size_t pos, size_t byteCount)
@@ -128,7 +150,16 @@ namespace azgra::io::stream
         if (byteCount == 0)
             return;
 
-        byte *writePtr = (dst.data() + pos);
-        fileStream.read(reinterpret_cast<char *>(writePtr), byteCount);
+        read_raw(dst.data() + pos, byteCount);
+    }
+
+    azgra::u64 InBinaryFileStream::consume_up_to(byte *dst, const azgra::u64 byteCount)
+    {
+        always_assert(this->isOpen);
+        if (byteCount == 0)
+            return 0;
+
+        fileStream.read(reinterpret_cast<char *>(dst), static_cast<std::streamsize>(byteCount));
+        return static_cast<azgra::u64>(fileStream.gcount());
     }
 } // namespace azgra
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <azgra/io/stream/in_binary_stream_base.h>
+#include <algorithm>
 
 namespace azgra::io::stream
 {
@@ -11,7 +12,7 @@ namespace azgra::io::stream
     byte InBinaryStreamBase::consume_byte()
     {
         always_assert(this->isOpen);
-        return consume_bytes(1)[0];
+        return read<byte>();
     }
 
     bool InBinaryStreamBase::consume_bool(const azgra::u16 byteCount)
@@ -29,49 +30,49 @@ namespace azgra::io::stream
     azgra::i16 InBinaryStreamBase::consume_short16()
     {
         always_assert(this->isOpen);
-        return bytes_to_i16(consume_bytes(2));
+        return read<azgra::i16>();
     }
 
     azgra::u16 InBinaryStreamBase::consume_ushort16()
     {
         always_assert(this->isOpen);
-        return bytes_to_u16(consume_bytes(2));
+        return read<azgra::u16>();
     }
 
     azgra::i32 InBinaryStreamBase::consume_int32()
     {
         always_assert(this->isOpen);
-        return bytes_to_i32(consume_bytes(4));
+        return read<azgra::i32>();
     }
 
     azgra::u32 InBinaryStreamBase::consume_uint32()
     {
         always_assert(this->isOpen);
-        return bytes_to_u32(consume_bytes(4));
+        return read<azgra::u32>();
     }
 
     azgra::i64 InBinaryStreamBase::consume_long64()
     {
         always_assert(this->isOpen);
-        return bytes_to_i64(consume_bytes(8));
+        return read<azgra::i64>();
     }
 
     azgra::u64 InBinaryStreamBase::consume_ulong64()
     {
         always_assert(this->isOpen);
-        return bytes_to_u64(consume_bytes(8));
+        return read<azgra::u64>();
     }
 
     float InBinaryStreamBase::consume_float()
     {
         always_assert(this->isOpen);
-        return bytes_to_float(consume_bytes(4));
+        return read<float>();
     }
 
     double InBinaryStreamBase::consume_double()
     {
         always_assert(this->isOpen);
-        return bytes_to_double(consume_bytes(8));
+        return read<double>();
     }
 
     ByteArray InBinaryStreamBase::move_and_consume_bytes(const azgra::i64 position, const azgra::i64 byteCount)
@@ -85,11 +86,26 @@ namespace azgra::io::stream
     {
         always_assert(this->isOpen);
         always_assert(dst.size() >= (pos + byteCount));
-        ByteArray tmpBuffer = consume_bytes(byteCount);
-        for (size_t i = 0; i < byteCount; i++)
+        read_array(dst.data() + pos, byteCount);
+    }
+
+    azgra::u64 InBinaryStreamBase::consume_up_to(byte *dst, const azgra::u64 byteCount)
+    {
+        always_assert(this->isOpen);
+        const azgra::i64 available = get_size() - get_position();
+        const azgra::u64 toRead = (available > 0) ? std::min(byteCount, static_cast<azgra::u64>(available)) : 0;
+        if (toRead > 0)
         {
-            dst[pos + i] = tmpBuffer[i];
+            read_raw(dst, toRead);
         }
+        return toRead;
+    }
+
+    void InBinaryStreamBase::read_raw(byte *dst, const azgra::u64 byteCount)
+    {
+        always_assert(this->isOpen);
+        const ByteArray bytes = consume_bytes(byteCount);
+        std::memcpy(dst, bytes.data(), byteCount);
     }
 
 } // namespace azgra
\ No newline at end of file
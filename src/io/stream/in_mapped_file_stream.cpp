@@ -0,0 +1,155 @@
+#include <azgra/io/stream/in_mapped_file_stream.h>
+
+namespace azgra::io::stream
+{
+
+    InMappedFileStream::InMappedFileStream()
+    {
+        this->isOpen = false;
+    }
+
+    InMappedFileStream::InMappedFileStream(const char *file, const MemoryAccessPattern accessPattern) : InMappedFileStream()
+    {
+        open_stream(file, accessPattern);
+    }
+
+    InMappedFileStream::InMappedFileStream(const std::string &file, const MemoryAccessPattern accessPattern)
+            : InMappedFileStream(file.c_str(), accessPattern)
+    {
+    }
+
+    InMappedFileStream::~InMappedFileStream()
+    {
+        close_stream();
+    }
+
+    void InMappedFileStream::open_stream(const char *file, const MemoryAccessPattern accessPattern)
+    {
+        always_assert(!this->isOpen);
+        this->mappedFile = MemoryMappedFile(file);
+        this->mappedFile.advise(accessPattern);
+        this->directReadPosition = this->mappedFile.data();
+        this->directReadEnd = this->mappedFile.data() + this->mappedFile.size();
+        this->isOpen = true;
+    }
+
+    void InMappedFileStream::close_stream()
+    {
+        if (this->isOpen)
+        {
+            this->mappedFile.close();
+            this->directReadPosition = nullptr;
+            this->directReadEnd = nullptr;
+            this->isOpen = false;
+        }
+    }
+
+    void InMappedFileStream::advise(const MemoryAccessPattern accessPattern) const
+    {
+        always_assert(this->isOpen);
+        this->mappedFile.advise(accessPattern);
+    }
+
+    void InMappedFileStream::advise(const MemoryAccessPattern accessPattern, const azgra::u64 offset, const azgra::u64 byteCount) const
+    {
+        always_assert(this->isOpen);
+        this->mappedFile.advise(accessPattern, offset, byteCount);
+    }
+
+    void InMappedFileStream::ensure_available(const azgra::u64 byteCount) const
+    {
+        always_assert(byteCount <= static_cast<azgra::u64>(this->directReadEnd - this->directReadPosition) &&
+                      "Read past the end of the mapped file.");
+    }
+
+    azgra::i64 InMappedFileStream::get_size() const
+    {
+        always_assert(this->isOpen);
+        return static_cast<azgra::i64>(this->mappedFile.size());
+    }
+
+    azgra::i64 InMappedFileStream::get_position()
+    {
+        always_assert(this->isOpen);
+        return static_cast<azgra::i64>(this->directReadPosition - this->mappedFile.data());
+    }
+
+    void InMappedFileStream::move_to(const azgra::i64 position)
+    {
+        always_assert(this->isOpen);
+        always_assert(position >= 0 && static_cast<azgra::u64>(position) <= this->mappedFile.size());
+        this->directReadPosition = this->mappedFile.data() + position;
+    }
+
+    void InMappedFileStream::move_to_beginning()
+    {
+        move_to(0);
+    }
+
+    void InMappedFileStream::move_to_end()
+    {
+        move_to(get_size());
+    }
+
+    void InMappedFileStream::move_by(const azgra::i64 distance)
+    {
+        move_to(get_position() + distance);
+    }
+
+    ByteArray InMappedFileStream::consume_bytes(const azgra::u64 byteCount)
+    {
+        const byte *bytes = consume_pointer(byteCount);
+        return ByteArray(bytes, bytes + byteCount);
+    }
+
+    void InMappedFileStream::consume_into(ByteArray &dst, size_t pos, size_t byteCount)
+    {
+        always_assert(dst.size() - pos >= byteCount);
+        const byte *bytes = consume_pointer(byteCount);
+        if (byteCount > 0)
+        {
+            std::memcpy(dst.data() + pos, bytes, byteCount);
+        }
+    }
+
+    void InMappedFileStream::read_raw(byte *dst, const azgra::u64 byteCount)
+    {
+        always_assert(this->isOpen);
+        ensure_available(byteCount);
+        std::memcpy(dst, this->directReadPosition, byteCount);
+        this->directReadPosition += byteCount;
+    }
+
+    ByteSpan InMappedFileStream::consume_span(const azgra::u64 byteCount)
+    {
+        return ByteSpan(consume_pointer(byteCount), byteCount);
+    }
+
+    const byte *InMappedFileStream::consume_pointer(const azgra::u64 byteCount)
+    {
+        always_assert(this->isOpen);
+        ensure_available(byteCount);
+        const byte *bytes = this->directReadPosition;
+        this->directReadPosition += byteCount;
+        return bytes;
+    }
+
+    ByteSpan InMappedFileStream::span_at(const azgra::u64 offset, const azgra::u64 byteCount) const
+    {
+        always_assert(this->isOpen);
+        always_assert(offset <= this->mappedFile.size() && byteCount <= this->mappedFile.size() - offset);
+        return ByteSpan(this->mappedFile.data() + offset, byteCount);
+    }
+
+    const byte *InMappedFileStream::current_pointer() const
+    {
+        always_assert(this->isOpen);
+        return this->directReadPosition;
+    }
+
+    const byte *InMappedFileStream::data() const
+    {
+        always_assert(this->isOpen);
+        return this->mappedFile.data();
+    }
+} // namespace azgra
@@ -1,49 +1,108 @@
 #include <azgra/io/stream/out_binary_buffer_stream.h>
+#include <algorithm>
 
 namespace azgra::io::stream
 {
     void OutBinaryBufferStream::ensure_capacity(const size_t &writeSize)
     {
+        const size_t position = get_position();
+        const size_t requiredSize = position + writeSize;
+        if (requiredSize <= buffer.size())
+            return;
 
+        // Doubling keeps the amortized cost of the reallocations constant per written byte.
+        buffer.resize(std::max(requiredSize, buffer.size() * 2));
+        set_position(position);
+    }
+
+    void OutBinaryBufferStream::set_position(const size_t position)
+    {
+        always_assert(position <= buffer.size());
+        directWritePosition = buffer.data() + position;
+        directWriteEnd = buffer.data() + buffer.size();
     }
 
     OutBinaryBufferStream::OutBinaryBufferStream(const size_t initialBufferSize)
     {
         buffer.resize(initialBufferSize);
-        bufferPtr = 0;
+        set_position(0);
         isOpen = true;
     }
 
     OutBinaryBufferStream::~OutBinaryBufferStream()
     {
         buffer.clear();
-        bufferPtr = 0;
+        directWritePosition = nullptr;
+        directWriteEnd = nullptr;
         isOpen = false;
     }
 
     size_t OutBinaryBufferStream::get_position()
     {
-        return bufferPtr;
+        return static_cast<size_t>(directWritePosition - buffer.data());
+    }
+
+    void OutBinaryBufferStream::reserve(const size_t byteCount)
+    {
+        if (byteCount <= buffer.size())
+            return;
+
+        const size_t position = get_position();
+        buffer.resize(byteCount);
+        set_position(position);
     }
 
     void OutBinaryBufferStream::write_byte(const byte &value)
     {
         ensure_capacity(1);
-        buffer[bufferPtr++] = value;
+        *directWritePosition++ = value;
     }
 
     void OutBinaryBufferStream::write_bytes(const ByteArray &bytes)
     {
-        size_t writeSize = bytes.size();
-        ensure_capacity(writeSize);
-        azgra::collection::vector_insert_at(buffer, bytes, bufferPtr, 0, writeSize);
-        bufferPtr += writeSize;
+        write_raw(bytes.data(), bytes.size());
+    }
+
+    void OutBinaryBufferStream::write_raw(const byte *src, const azgra::u64 byteCount)
+    {
+        if (byteCount == 0)
+            return;
+
+        ensure_capacity(byteCount);
+        std::memcpy(directWritePosition, src, byteCount);
+        directWritePosition += byteCount;
+    }
+
+    void OutBinaryBufferStream::write_replicated_bytes(const byte &repValue, const size_t repCount)
+    {
+        if (repCount == 0)
+            return;
+
+        ensure_capacity(repCount);
+        std::memset(directWritePosition, repValue, repCount);
+        directWritePosition += repCount;
     }
 
     ByteArray OutBinaryBufferStream::get_buffer_data() const
     {
-        ByteArray data = ByteArray(buffer.begin(), (buffer.begin() + bufferPtr));
-        always_assert(data.size() == bufferPtr);
+        const size_t position = static_cast<size_t>(directWritePosition - buffer.data());
+        ByteArray data = ByteArray(buffer.begin(), (buffer.begin() + position));
+        always_assert(data.size() == position);
         return data;
     }
-}
\ No newline at end of file
+
+    const byte *OutBinaryBufferStream::get_buffer_pointer() const
+    {
+        return buffer.data();
+    }
+
+    ByteArray OutBinaryBufferStream::release_buffer()
+    {
+        // Shrinking the size doesn't reallocate, the written bytes are moved out as they are.
+        buffer.resize(get_position());
+        ByteArray result = std::move(buffer);
+        buffer = ByteArray();
+        set_position(0);
+        return result;
+    }
+}
@@ -38,6 +38,12 @@ namespace azgra::io::stream
         fileStream.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
     }
 
+    void OutBinaryFileStream::write_raw(const byte *src, const azgra::u64 byteCount)
+    {
+        always_assert(isOpen);
+        fileStream.write(reinterpret_cast<const char *>(src), byteCount);
+    }
+
     void OutBinaryFileStream::write_bytes_from_buffer(const char *buffer, const size_t byteCount)
     {
         fileStream.write(buffer, byteCount);
@@ -46,10 +52,8 @@ namespace azgra::io::stream
     void OutBinaryFileStream::write_replicated_bytes(const byte &repValue, const size_t repCount)
     {
         always_assert(isOpen);
-        byte *buffer = static_cast<byte *> (::operator new(repCount));
-        std::memset(buffer, repValue, repCount);
-        fileStream.write(reinterpret_cast<const char *>(buffer), repCount);
-        std::free(buffer);
+        const ByteArray buffer(repCount, repValue);
+        fileStream.write(reinterpret_cast<const char *>(buffer.data()), repCount);
     }
 
 
@@ -21,74 +21,77 @@ namespace azgra::io::stream
     void OutBinaryStreamBase::write_short16(const azgra::i16 &value)
     {
         always_assert(isOpen);
-        write_bytes(short16_to_bytes(value));
+        write<azgra::i16>(value);
     }
 
     // Write ushort value to the stream.
     void OutBinaryStreamBase::write_ushort16(const azgra::u16 &value)
     {
         always_assert(isOpen);
-        write_bytes(ushort16_to_bytes(value));
+        write<azgra::u16>(value);
     }
 
     // Write int value to the stream.
     void OutBinaryStreamBase::write_int32(const azgra::i32 &value)
     {
         always_assert(isOpen);
-        write_bytes(int32_to_bytes(value));
+        write<azgra::i32>(value);
     }
 
     // Write uint value to the stream.
     void OutBinaryStreamBase::write_uint32(const azgra::u32 &value)
     {
         always_assert(isOpen);
-        write_bytes(uint32_to_bytes(value));
+        write<azgra::u32>(value);
     }
 
     // Write long value to the stream.
     void OutBinaryStreamBase::write_long64(const azgra::i64 &value)
     {
         always_assert(isOpen);
-        write_bytes(long64_to_bytes(value));
+        write<azgra::i64>(value);
     }
 
     // Write ulong value to the stream.
     void OutBinaryStreamBase::write_ulong64(const azgra::u64 &value)
     {
         always_assert(isOpen);
-        write_bytes(ulong64_to_bytes(value));
+        write<azgra::u64>(value);
     }
 
     // Write float value to the stream.
     void OutBinaryStreamBase::write_float(const float &value)
     {
         always_assert(isOpen);
-        write_bytes(float_to_bytes(value));
+        write<float>(value);
     }
 
     // Write float value to the stream.
     void OutBinaryStreamBase::write_double(const double &value)
     {
         always_assert(isOpen);
-        write_bytes(double_to_bytes(value));
+        write<double>(value);
+    }
+
+    void OutBinaryStreamBase::write_raw(const byte *src, const azgra::u64 byteCount)
+    {
+        for (size_t i = 0; i < byteCount; ++i)
+        {
+            write_byte(src[i]);
+        }
     }
 
     // Write bytes from buffer to the stream.
     void OutBinaryStreamBase::write_bytes_from_buffer(const ByteArray &buffer, const size_t bufferPos, const size_t byteCount)
     {
         always_assert(isOpen);
-        for (size_t i = 0; i < byteCount; i++)
-        {
-            write_byte(buffer[bufferPos + i]);
-        }
+        always_assert(bufferPos + byteCount <= buffer.size());
+        write_array(buffer.data() + bufferPos, byteCount);
     }
 
     void OutBinaryStreamBase::write_bytes_from_buffer(const char *buffer, const size_t byteCount)
     {
-        for (size_t i = 0; i < byteCount; ++i)
-        {
-            write_byte(*(buffer + i));
-        }
+        write_array(reinterpret_cast<const byte *>(buffer), byteCount);
     }
 
     void OutBinaryStreamBase::write_replicated_bytes(const byte &repValue, const size_t repCount)
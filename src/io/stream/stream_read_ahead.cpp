@@ -0,0 +1,149 @@
+#include <azgra/io/stream/stream_read_ahead.h>
+
+namespace azgra::io::stream
+{
+    StreamReadAhead::StreamReadAhead(const azgra::u64 bufferSize, const azgra::u32 depth)
+    {
+        always_assert(bufferSize > 0);
+        this->bufferSize = bufferSize;
+        this->depth = (depth < 2) ? 2 : depth;
+    }
+
+    StreamReadAhead::~StreamReadAhead()
+    {
+        stop();
+    }
+
+    void StreamReadAhead::start(InBinaryStreamBase *sourceStream, const azgra::i64 position)
+    {
+        always_assert(!is_running() && "Read-ahead is already running.");
+        this->stream = sourceStream;
+        this->streamSize = sourceStream->get_size();
+        this->nextPosition = position;
+        this->stopRequested = false;
+        this->endReached = false;
+        this->readFailed = false;
+        this->readError = nullptr;
+        // One buffer is always held by the consumer.
+        while (this->freeBuffers.size() < this->depth - 1)
+        {
+            this->freeBuffers.emplace_back();
+        }
+        if (position < this->streamSize)
+        {
+            sourceStream->move_to(position);
+        }
+        this->worker = std::thread(&StreamReadAhead::worker_loop, this);
+    }
+
+    void StreamReadAhead::stop()
+    {
+        if (!is_running())
+            return;
+
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->stopRequested = true;
+        }
+        this->bufferReleased.notify_one();
+        this->worker.join();
+
+        // Keep the allocated buffers for the next start.
+        for (ByteArray &buffer : this->filledBuffers)
+        {
+            this->freeBuffers.push_back(std::move(buffer));
+        }
+        this->filledBuffers.clear();
+    }
+
+    bool StreamReadAhead::is_running() const
+    {
+        return this->worker.joinable();
+    }
+
+    bool StreamReadAhead::next_buffer(ByteArray &buffer)
+    {
+        always_assert(is_running());
+        {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->bufferFilled.wait(guard, [this]()
+            { return !this->filledBuffers.empty() || this->endReached || this->readFailed; });
+
+            if (this->filledBuffers.empty())
+            {
+                if (this->readError)
+                {
+                    std::rethrow_exception(this->readError);
+                }
+                always_assert(!this->readFailed && "Read-ahead failed to read the stream.");
+                return false;
+            }
+
+            this->freeBuffers.push_back(std::move(buffer));
+            buffer = std::move(this->filledBuffers.front());
+            this->filledBuffers.pop_front();
+        }
+        this->bufferReleased.notify_one();
+        return true;
+    }
+
+    void StreamReadAhead::worker_loop()
+    {
+        while (true)
+        {
+            ByteArray buffer;
+            {
+                std::unique_lock<std::mutex> guard(this->lock);
+                this->bufferReleased.wait(guard, [this]()
+                { return this->stopRequested || !this->freeBuffers.empty(); });
+
+                if (this->stopRequested)
+                    return;
+
+                if (this->nextPosition >= this->streamSize)
+                {
+                    this->endReached = true;
+                    this->bufferFilled.notify_one();
+                    return;
+                }
+                buffer = std::move(this->freeBuffers.back());
+                this->freeBuffers.pop_back();
+            }
+
+            // The stream is read outside of the lock, while the consumer decodes the previous buffers.
+            const azgra::u64 available = static_cast<azgra::u64>(this->streamSize - this->nextPosition);
+            const azgra::u64 toRead = (available > this->bufferSize) ? this->bufferSize : available;
+            buffer.resize(toRead);
+            azgra::u64 readCount = 0;
+            std::exception_ptr error;
+            try
+            {
+                readCount = this->stream->consume_up_to(buffer.data(), toRead);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            this->nextPosition += toRead;
+            const bool failed = error || (readCount != toRead);
+
+            {
+                std::lock_guard<std::mutex> guard(this->lock);
+                if (failed)
+                {
+                    // Errors are reported on the consumer thread, after the buffers filled before them.
+                    this->readFailed = true;
+                    this->readError = error;
+                    this->freeBuffers.push_back(std::move(buffer));
+                }
+                else
+                {
+                    this->filledBuffers.push_back(std::move(buffer));
+                }
+            }
+            this->bufferFilled.notify_one();
+            if (failed)
+                return;
+        }
+    }
+} // namespace azgra
@@ -0,0 +1,245 @@
+#include <azgra/linalg/gemm.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define AZGRA_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace azgra::linalg
+{
+#ifdef AZGRA_X86_SIMD
+
+    // 6x16 single precision tile, 12 ymm accumulators.
+    __attribute__((target("avx2,fma")))
+    static void gemm_micro_kernel_f32_avx2(size_t kc, const f32 *a, const f32 *b, f32 *c, size_t ldc)
+    {
+        __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+        __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+        __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+        __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+        __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+        __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+        for (size_t p = 0; p < kc; ++p)
+        {
+            const __m256 b0 = _mm256_loadu_ps(b);
+            const __m256 b1 = _mm256_loadu_ps(b + 8);
+            __m256 ai;
+            ai = _mm256_broadcast_ss(a + 0);
+            c00 = _mm256_fmadd_ps(ai, b0, c00);
+            c01 = _mm256_fmadd_ps(ai, b1, c01);
+            ai = _mm256_broadcast_ss(a + 1);
+            c10 = _mm256_fmadd_ps(ai, b0, c10);
+            c11 = _mm256_fmadd_ps(ai, b1, c11);
+            ai = _mm256_broadcast_ss(a + 2);
+            c20 = _mm256_fmadd_ps(ai, b0, c20);
+            c21 = _mm256_fmadd_ps(ai, b1, c21);
+            ai = _mm256_broadcast_ss(a + 3);
+            c30 = _mm256_fmadd_ps(ai, b0, c30);
+            c31 = _mm256_fmadd_ps(ai, b1, c31);
+            ai = _mm256_broadcast_ss(a + 4);
+            c40 = _mm256_fmadd_ps(ai, b0, c40);
+            c41 = _mm256_fmadd_ps(ai, b1, c41);
+            ai = _mm256_broadcast_ss(a + 5);
+            c50 = _mm256_fmadd_ps(ai, b0, c50);
+            c51 = _mm256_fmadd_ps(ai, b1, c51);
+            a += 6;
+            b += 16;
+        }
+
+        const __m256 acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+        for (size_t i = 0; i < 6; ++i)
+        {
+            f32 *row = c + (i * ldc);
+            _mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), acc[i][0]));
+            _mm256_storeu_ps(row + 8, _mm256_add_ps(_mm256_loadu_ps(row + 8), acc[i][1]));
+        }
+    }
+
+    // 6x8 double precision tile, 12 ymm accumulators.
+    __attribute__((target("avx2,fma")))
+    static void gemm_micro_kernel_f64_avx2(size_t kc, const f64 *a, const f64 *b, f64 *c, size_t ldc)
+    {
+        __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+        __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+        __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+        __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+        __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+        __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+        for (size_t p = 0; p < kc; ++p)
+        {
+            const __m256d b0 = _mm256_loadu_pd(b);
+            const __m256d b1 = _mm256_loadu_pd(b + 4);
+            __m256d ai;
+            ai = _mm256_broadcast_sd(a + 0);
+            c00 = _mm256_fmadd_pd(ai, b0, c00);
+            c01 = _mm256_fmadd_pd(ai, b1, c01);
+            ai = _mm256_broadcast_sd(a + 1);
+            c10 = _mm256_fmadd_pd(ai, b0, c10);
+            c11 = _mm256_fmadd_pd(ai, b1, c11);
+            ai = _mm256_broadcast_sd(a + 2);
+            c20 = _mm256_fmadd_pd(ai, b0, c20);
+            c21 = _mm256_fmadd_pd(ai, b1, c21);
+            ai = _mm256_broadcast_sd(a + 3);
+            c30 = _mm256_fmadd_pd(ai, b0, c30);
+            c31 = _mm256_fmadd_pd(ai, b1, c31);
+            ai = _mm256_broadcast_sd(a + 4);
+            c40 = _mm256_fmadd_pd(ai, b0, c40);
+            c41 = _mm256_fmadd_pd(ai, b1, c41);
+            ai = _mm256_broadcast_sd(a + 5);
+            c50 = _mm256_fmadd_pd(ai, b0, c50);
+            c51 = _mm256_fmadd_pd(ai, b1, c51);
+            a += 6;
+            b += 8;
+        }
+
+        const __m256d acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+        for (size_t i = 0; i < 6; ++i)
+        {
+            f64 *row = c + (i * ldc);
+            _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), acc[i][0]));
+            _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), acc[i][1]));
+        }
+    }
+
+    // 6x32 single precision tile, 12 zmm accumulators.
+    __attribute__((target("avx512f")))
+    static void gemm_micro_kernel_f32_avx512(size_t kc, const f32 *a, const f32 *b, f32 *c, size_t ldc)
+    {
+        __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+        __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+        __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+        __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+        __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+        __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+
+        for (size_t p = 0; p < kc; ++p)
+        {
+            const __m512 b0 = _mm512_loadu_ps(b);
+            const __m512 b1 = _mm512_loadu_ps(b + 16);
+            __m512 ai;
+            ai = _mm512_set1_ps(a[0]);
+            c00 = _mm512_fmadd_ps(ai, b0, c00);
+            c01 = _mm512_fmadd_ps(ai, b1, c01);
+            ai = _mm512_set1_ps(a[1]);
+            c10 = _mm512_fmadd_ps(ai, b0, c10);
+            c11 = _mm512_fmadd_ps(ai, b1, c11);
+            ai = _mm512_set1_ps(a[2]);
+            c20 = _mm512_fmadd_ps(ai, b0, c20);
+            c21 = _mm512_fmadd_ps(ai, b1, c21);
+            ai = _mm512_set1_ps(a[3]);
+            c30 = _mm512_fmadd_ps(ai, b0, c30);
+            c31 = _mm512_fmadd_ps(ai, b1, c31);
+            ai = _mm512_set1_ps(a[4]);
+            c40 = _mm512_fmadd_ps(ai, b0, c40);
+            c41 = _mm512_fmadd_ps(ai, b1, c41);
+            ai = _mm512_set1_ps(a[5]);
+            c50 = _mm512_fmadd_ps(ai, b0, c50);
+            c51 = _mm512_fmadd_ps(ai, b1, c51);
+            a += 6;
+            b += 32;
+        }
+
+        const __m512 acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+        for (size_t i = 0; i < 6; ++i)
+        {
+            f32 *row = c + (i * ldc);
+            _mm512_storeu_ps(row, _mm512_add_ps(_mm512_loadu_ps(row), acc[i][0]));
+            _mm512_storeu_ps(row + 16, _mm512_add_ps(_mm512_loadu_ps(row + 16), acc[i][1]));
+        }
+    }
+
+    // 6x16 double precision tile, 12 zmm accumulators.
+    __attribute__((target("avx512f")))
+    static void gemm_micro_kernel_f64_avx512(size_t kc, const f64 *a, const f64 *b, f64 *c, size_t ldc)
+    {
+        __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd();
+        __m512d c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+        __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd();
+        __m512d c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+        __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd();
+        __m512d c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+
+        for (size_t p = 0; p < kc; ++p)
+        {
+            const __m512d b0 = _mm512_loadu_pd(b);
+            const __m512d b1 = _mm512_loadu_pd(b + 8);
+            __m512d ai;
+            ai = _mm512_set1_pd(a[0]);
+            c00 = _mm512_fmadd_pd(ai, b0, c00);
+            c01 = _mm512_fmadd_pd(ai, b1, c01);
+            ai = _mm512_set1_pd(a[1]);
+            c10 = _mm512_fmadd_pd(ai, b0, c10);
+            c11 = _mm512_fmadd_pd(ai, b1, c11);
+            ai = _mm512_set1_pd(a[2]);
+            c20 = _mm512_fmadd_pd(ai, b0, c20);
+            c21 = _mm512_fmadd_pd(ai, b1, c21);
+            ai = _mm512_set1_pd(a[3]);
+            c30 = _mm512_fmadd_pd(ai, b0, c30);
+            c31 = _mm512_fmadd_pd(ai, b1, c31);
+            ai = _mm512_set1_pd(a[4]);
+            c40 = _mm512_fmadd_pd(ai, b0, c40);
+            c41 = _mm512_fmadd_pd(ai, b1, c41);
+            ai = _mm512_set1_pd(a[5]);
+            c50 = _mm512_fmadd_pd(ai, b0, c50);
+            c51 = _mm512_fmadd_pd(ai, b1, c51);
+            a += 6;
+            b += 16;
+        }
+
+        const __m512d acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+        for (size_t i = 0; i < 6; ++i)
+        {
+            f64 *row = c + (i * ldc);
+            _mm512_storeu_pd(row, _mm512_add_pd(_mm512_loadu_pd(row), acc[i][0]));
+            _mm512_storeu_pd(row + 8, _mm512_add_pd(_mm512_loadu_pd(row + 8), acc[i][1]));
+        }
+    }
+
+    static bool cpu_supports_avx512()
+    {
+        static const bool supported = __builtin_cpu_supports("avx512f");
+        return supported;
+    }
+
+    static bool cpu_supports_avx2()
+    {
+        static const bool supported = (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"));
+        return supported;
+    }
+
+#endif
+
+    template<>
+    GemmKernel<f32> select_gemm_kernel<f32>()
+    {
+#ifdef AZGRA_X86_SIMD
+        if (cpu_supports_avx512())
+        {
+            return GemmKernel<f32>{6, 32, &gemm_micro_kernel_f32_avx512, "avx512"};
+        }
+        if (cpu_supports_avx2())
+        {
+            return GemmKernel<f32>{6, 16, &gemm_micro_kernel_f32_avx2, "avx2"};
+        }
+#endif
+        return GemmKernel<f32>{4, 8, &generic_gemm_micro_kernel<f32, 4, 8>, "generic"};
+    }
+
+    template<>
+    GemmKernel<f64> select_gemm_kernel<f64>()
+    {
+#ifdef AZGRA_X86_SIMD
+        if (cpu_supports_avx512())
+        {
+            return GemmKernel<f64>{6, 16, &gemm_micro_kernel_f64_avx512, "avx512"};
+        }
+        if (cpu_supports_avx2())
+        {
+            return GemmKernel<f64>{6, 8, &gemm_micro_kernel_f64_avx2, "avx2"};
+        }
+#endif
+        return GemmKernel<f64>{4, 4, &generic_gemm_micro_kernel<f64, 4, 4>, "generic"};
+    }
+}
@@ -0,0 +1,172 @@
+#include <azgra/utilities/allocators.h>
+#include <atomic>
+#include <vector>
+
+namespace azgra
+{
+    // Smallest size class is one cache line, largest pooled class is 1 GiB, bigger buffers go straight to the heap.
+    constexpr size_t MinPoolClassShift = 6;
+    constexpr size_t MaxPoolClassShift = 30;
+    constexpr size_t PoolClassCount = MaxPoolClassShift - MinPoolClassShift + 1;
+
+    static std::atomic<size_t> g_poolCacheLimit{static_cast<size_t>(64) << 20};
+
+    // Set when the thread's pool was already destroyed, buffers freed afterwards (by static objects) go to the heap.
+    static thread_local bool t_poolDestroyed = false;
+
+    static size_t size_class_index(const size_t byteCount)
+    {
+        size_t shift = MinPoolClassShift;
+        while ((static_cast<size_t>(1) << shift) < byteCount)
+        {
+            ++shift;
+        }
+        return shift - MinPoolClassShift;
+    }
+
+    static void *heap_allocate(const size_t byteCount)
+    {
+        return ::operator new(byteCount, std::align_val_t(SimdAlignment));
+    }
+
+    static void heap_deallocate(void *memory, const size_t byteCount) noexcept
+    {
+        ::operator delete(memory, byteCount, std::align_val_t(SimdAlignment));
+    }
+
+    class ThreadMemoryPool
+    {
+    private:
+        std::vector<void *> m_freeBuffers[PoolClassCount];
+        size_t m_cachedBytes = 0;
+
+    public:
+        ThreadMemoryPool() = default;
+
+        ThreadMemoryPool(const ThreadMemoryPool &) = delete;
+
+        ThreadMemoryPool &operator=(const ThreadMemoryPool &) = delete;
+
+        ~ThreadMemoryPool()
+        {
+            release();
+            t_poolDestroyed = true;
+        }
+
+        void *allocate(const size_t classIndex)
+        {
+            std::vector<void *> &freeBuffers = m_freeBuffers[classIndex];
+            const size_t classSize = static_cast<size_t>(1) << (classIndex + MinPoolClassShift);
+            if (freeBuffers.empty())
+            {
+                return heap_allocate(classSize);
+            }
+            void *memory = freeBuffers.back();
+            freeBuffers.pop_back();
+            m_cachedBytes -= classSize;
+            return memory;
+        }
+
+        void deallocate(void *memory, const size_t classIndex) noexcept
+        {
+            const size_t classSize = static_cast<size_t>(1) << (classIndex + MinPoolClassShift);
+            if ((m_cachedBytes + classSize) > g_poolCacheLimit.load(std::memory_order_relaxed))
+            {
+                heap_deallocate(memory, classSize);
+                return;
+            }
+            try
+            {
+                m_freeBuffers[classIndex].push_back(memory);
+                m_cachedBytes += classSize;
+            }
+            catch (const std::bad_alloc &)
+            {
+                heap_deallocate(memory, classSize);
+            }
+        }
+
+        void release() noexcept
+        {
+            for (size_t classIndex = 0; classIndex < PoolClassCount; ++classIndex)
+            {
+                const size_t classSize = static_cast<size_t>(1) << (classIndex + MinPoolClassShift);
+                for (void *memory : m_freeBuffers[classIndex])
+                {
+                    heap_deallocate(memory, classSize);
+                }
+                m_freeBuffers[classIndex].clear();
+                m_freeBuffers[classIndex].shrink_to_fit();
+            }
+            m_cachedBytes = 0;
+        }
+
+        [[nodiscard]] size_t cached_bytes() const noexcept
+        {
+            return m_cachedBytes;
+        }
+    };
+
+    static ThreadMemoryPool &thread_pool()
+    {
+        static thread_local ThreadMemoryPool pool;
+        return pool;
+    }
+
+    void *pool_allocate(const size_t byteCount)
+    {
+        if (byteCount > (static_cast<size_t>(1) << MaxPoolClassShift))
+        {
+            return heap_allocate(byteCount);
+        }
+        const size_t classIndex = size_class_index(byteCount);
+        if (t_poolDestroyed)
+        {
+            return heap_allocate(static_cast<size_t>(1) << (classIndex + MinPoolClassShift));
+        }
+        return thread_pool().allocate(classIndex);
+    }
+
+    void pool_deallocate(void *memory, const size_t byteCount) noexcept
+    {
+        if (memory == nullptr)
+        {
+            return;
+        }
+        if (byteCount > (static_cast<size_t>(1) << MaxPoolClassShift))
+        {
+            heap_deallocate(memory, byteCount);
+            return;
+        }
+        const size_t classIndex = size_class_index(byteCount);
+        if (t_poolDestroyed)
+        {
+            heap_deallocate(memory, static_cast<size_t>(1) << (classIndex + MinPoolClassShift));
+            return;
+        }
+        thread_pool().deallocate(memory, classIndex);
+    }
+
+    void pool_release_thread_cache() noexcept
+    {
+        if (!t_poolDestroyed)
+        {
+            thread_pool().release();
+        }
+    }
+
+    size_t pool_thread_cached_bytes() noexcept
+    {
+        return t_poolDestroyed ? 0 : thread_pool().cached_bytes();
+    }
+
+    void set_pool_cache_limit(const size_t byteCount)
+    {
+        g_poolCacheLimit.store(byteCount);
+    }
+
+    size_t get_pool_cache_limit()
+    {
+        return g_poolCacheLimit.load();
+    }
+}
@@ -0,0 +1,202 @@
+#include <azgra/utilities/parallel.h>
+
+namespace azgra
+{
+    // True when the current thread is executing a pool task, nested submissions then run sequentially.
+    static thread_local bool t_insideTask = false;
+
+    // Below this element count the parallel loops don't touch the pool, because waking the workers costs more.
+    static std::atomic<size_t> g_parallelThreshold{static_cast<size_t>(1) << 16};
+
+    void set_parallel_threshold(const size_t elementCount)
+    {
+        g_parallelThreshold.store(elementCount);
+    }
+
+    size_t get_parallel_threshold()
+    {
+        return g_parallelThreshold.load();
+    }
+
+    ThreadPool::ThreadPool(const size_t threadCount)
+    {
+        start_workers((threadCount > 0 ? threadCount : 1) - 1);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        stop_workers();
+    }
+
+    ThreadPool &ThreadPool::global()
+    {
+        static ThreadPool pool(std::max<size_t>(1, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+    size_t ThreadPool::thread_count() const noexcept
+    {
+        return m_workerCount.load() + 1;
+    }
+
+    void ThreadPool::set_thread_count(size_t threadCount)
+    {
+        always_assert(!t_insideTask && "Thread count can't be changed from inside of a task.");
+        if (threadCount == 0)
+        {
+            threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        std::lock_guard<std::mutex> submitLock(m_submitMutex);
+        if (threadCount == thread_count())
+        {
+            return;
+        }
+        stop_workers();
+        start_workers(threadCount - 1);
+    }
+
+    void ThreadPool::start_workers(const size_t workerCount)
+    {
+        m_stop = false;
+        m_workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back(&ThreadPool::worker_loop, this, m_generation);
+        }
+        m_workerCount.store(m_workers.size());
+    }
+
+    void ThreadPool::stop_workers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_workAvailable.notify_all();
+        for (std::thread &worker : m_workers)
+        {
+            worker.join();
+        }
+        m_workers.clear();
+        m_workerCount.store(0);
+    }
+
+    // Marks the current thread as executing a pool task, restores the previous state when destroyed.
+    class InsideTaskScope
+    {
+    private:
+        bool m_wasInsideTask;
+
+    public:
+        InsideTaskScope() : m_wasInsideTask(t_insideTask)
+        {
+            t_insideTask = true;
+        }
+
+        ~InsideTaskScope()
+        {
+            t_insideTask = m_wasInsideTask;
+        }
+    };
+
+    void ThreadPool::execute_tasks()
+    {
+        const InsideTaskScope insideTask;
+        size_t taskIndex;
+        while ((taskIndex = m_nextTask.fetch_add(1)) < m_taskCount)
+        {
+            try
+            {
+                (*m_task)(taskIndex);
+            }
+            catch (...)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_exception)
+                    {
+                        m_exception = std::current_exception();
+                    }
+                }
+                // Remaining tasks are skipped, the threads only drain the indices.
+                m_nextTask.store(m_taskCount);
+            }
+        }
+    }
+
+    void ThreadPool::worker_loop(size_t seenGeneration)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_workAvailable.wait(lock, [&]()
+            { return m_stop || (m_generation != seenGeneration); });
+            if (m_stop)
+            {
+                return;
+            }
+            seenGeneration = m_generation;
+
+            lock.unlock();
+            execute_tasks();
+            lock.lock();
+
+            if (--m_activeWorkers == 0)
+            {
+                m_workDone.notify_one();
+            }
+        }
+    }
+
+    void ThreadPool::run(const size_t taskCount, const std::function<void(size_t)> &task)
+    {
+        if (taskCount == 0)
+        {
+            return;
+        }
+        const auto run_sequentially = [&]()
+        {
+            for (size_t i = 0; i < taskCount; ++i)
+            {
+                task(i);
+            }
+        };
+        if (t_insideTask || m_workerCount.load() == 0 || taskCount == 1)
+        {
+            run_sequentially();
+            return;
+        }
+
+        std::lock_guard<std::mutex> submitLock(m_submitMutex);
+        // Workers could have been stopped by set_thread_count since the check above.
+        if (m_workers.empty())
+        {
+            run_sequentially();
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_task = &task;
+            m_taskCount = taskCount;
+            m_nextTask.store(0);
+            m_activeWorkers = m_workers.size();
+            ++m_generation;
+        }
+        m_workAvailable.notify_all();
+
+        execute_tasks();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_workDone.wait(lock, [&]()
+        { return m_activeWorkers == 0; });
+        m_task = nullptr;
+        m_taskCount = 0;
+        if (m_exception)
+        {
+            std::exception_ptr exception = std::move(m_exception);
+            m_exception = nullptr;
+            lock.unlock();
+            std::rethrow_exception(exception);
+        }
+    }
+}
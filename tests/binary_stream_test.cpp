@@ -0,0 +1,375 @@
+#include <catch2/catch.hpp>
+#include <azgra/io/stream/in_mapped_file_stream.h>
+#include <azgra/io/stream/in_binary_file_stream.h>
+#include <azgra/io/stream/in_binary_buffer_stream.h>
+#include <azgra/io/stream/out_binary_buffer_stream.h>
+#include <azgra/io/stream/out_binary_file_stream.h>
+#include "temporary_file.h"
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+using namespace azgra::io::stream;
+
+static azgra::ByteArray make_test_bytes(const size_t count)
+{
+    azgra::ByteArray bytes(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        bytes[i] = static_cast<azgra::byte>((i * 31) % 251);
+    }
+    return bytes;
+}
+
+static void write_test_file(const std::string &fileName, const azgra::ByteArray &bytes)
+{
+    std::ofstream out(fileName, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+TEST_CASE("mapped file stream reads like the file stream",
+          "[azgra::io::stream::InMappedFileStream]")
+{
+    const std::string fileName = temporary_file("azgra_mapped_stream_test.bin");
+    const azgra::ByteArray bytes = make_test_bytes(10007);
+    write_test_file(fileName, bytes);
+
+    InMappedFileStream mapped(fileName);
+    InBinaryFileStream file(fileName);
+    REQUIRE(mapped.is_open());
+    REQUIRE(mapped.get_size() == static_cast<azgra::i64>(bytes.size()));
+
+    REQUIRE(mapped.consume_byte() == file.consume_byte());
+    REQUIRE(mapped.consume_short16() == file.consume_short16());
+    REQUIRE(mapped.consume_ushort16() == file.consume_ushort16());
+    REQUIRE(mapped.consume_int32() == file.consume_int32());
+    REQUIRE(mapped.consume_uint32() == file.consume_uint32());
+    REQUIRE(mapped.consume_long64() == file.consume_long64());
+    REQUIRE(mapped.consume_ulong64() == file.consume_ulong64());
+    REQUIRE(mapped.consume_bool(3) == file.consume_bool(3));
+    REQUIRE(mapped.get_position() == file.get_position());
+    REQUIRE(mapped.consume_bytes(1000) == file.consume_bytes(1000));
+
+    mapped.move_to(5000);
+    azgra::ByteArray buffer(20, 0);
+    mapped.consume_into(buffer, 10, 10);
+    REQUIRE(std::equal(buffer.begin() + 10, buffer.end(), bytes.begin() + 5000));
+    mapped.move_by(-10);
+    REQUIRE(mapped.get_position() == 5000);
+    REQUIRE(mapped.move_and_consume_bytes(42, 8) == azgra::ByteArray(bytes.begin() + 42, bytes.begin() + 50));
+
+    mapped.close_stream();
+    file.close_stream();
+    std::filesystem::remove(fileName);
+}
+
+TEST_CASE("mapped file stream zero-copy accessors",
+          "[azgra::io::stream::InMappedFileStream]")
+{
+    const std::string fileName = temporary_file("azgra_mapped_span_test.bin");
+    const azgra::ByteArray bytes = make_test_bytes(4096);
+    write_test_file(fileName, bytes);
+
+    InMappedFileStream mapped(fileName.c_str(), azgra::io::MemoryAccessPattern_Random);
+    const azgra::byte *base = mapped.data();
+    mapped.move_to(100);
+    REQUIRE(mapped.current_pointer() == base + 100);
+
+    const azgra::ByteSpan span = mapped.consume_span(256);
+    REQUIRE(span.data() == base + 100);
+    REQUIRE(span.size() == 256);
+    REQUIRE(span[5] == bytes[105]);
+    REQUIRE(mapped.get_position() == 356);
+
+    const azgra::byte *pointer = mapped.consume_pointer(44);
+    REQUIRE(pointer == base + 356);
+    REQUIRE(mapped.get_position() == 400);
+
+    const azgra::ByteSpan tail = mapped.span_at(4000, 96);
+    REQUIRE(tail == azgra::ByteSpan(bytes.data() + 4000, 96));
+    REQUIRE(mapped.get_position() == 400);
+
+    mapped.advise(azgra::io::MemoryAccessPattern_Sequential);
+    mapped.move_to_end();
+    REQUIRE(mapped.get_position() == mapped.get_size());
+    REQUIRE(mapped.consume_span(0).size() == 0);
+
+    mapped.close_stream();
+    REQUIRE_FALSE(mapped.is_open());
+    std::filesystem::remove(fileName);
+}
+
+TEST_CASE("file stream reads whole file and rest of file",
+          "[azgra::io::stream::InBinaryFileStream]")
+{
+    const std::string fileName = temporary_file("azgra_file_stream_test.bin");
+    const azgra::ByteArray bytes = make_test_bytes(300007);
+    write_test_file(fileName, bytes);
+
+    InBinaryFileStream file(fileName);
+    file.move_to(1234);
+    REQUIRE(file.consume_whole_file() == bytes);
+    REQUIRE(file.get_position() == file.get_size());
+
+    file.move_to(100000);
+    REQUIRE(file.consume_int32() == azgra::bytes_to_i32(bytes, 100000));
+    const azgra::ByteArray rest = file.consume_rest_of_file();
+    REQUIRE(rest == azgra::ByteArray(bytes.begin() + 100004, bytes.end()));
+    REQUIRE(file.get_position() == file.get_size());
+    REQUIRE(file.consume_rest_of_file().empty());
+
+    file.move_to_beginning();
+    REQUIRE(file.consume_bytes(10) == azgra::ByteArray(bytes.begin(), bytes.begin() + 10));
+
+#ifndef _WIN32
+    // Stream keeps reading the opened file, after its path was replaced by another file.
+    const std::string replacementName = temporary_file("azgra_file_stream_replacement.bin");
+    write_test_file(replacementName, azgra::ByteArray(bytes.size(), 0xAB));
+    std::filesystem::rename(replacementName, fileName);
+    REQUIRE(file.consume_whole_file() == bytes);
+#endif
+
+    file.close_stream();
+    std::filesystem::remove(fileName);
+}
+
+struct PackedRecord
+{
+    azgra::i32 id;
+    azgra::f32 value;
+};
+
+static void check_typed_reads(InBinaryStreamBase &stream, const azgra::ByteArray &bytes)
+{
+    stream.move_to(0);
+    REQUIRE(stream.read<azgra::u16>() == azgra::bytes_to_u16(bytes, 0));
+    REQUIRE(stream.read<azgra::i32>() == azgra::bytes_to_i32(bytes, 2));
+    REQUIRE(stream.read<azgra::f64>() == azgra::bytes_to_double(bytes, 6));
+    REQUIRE(stream.read<azgra::u32>(azgra::ByteOrder_BigEndian) == azgra::byte_swap(azgra::bytes_to_u32(bytes, 14)));
+    REQUIRE(stream.get_position() == 18);
+
+    const PackedRecord record = stream.read<PackedRecord>();
+    REQUIRE(record.id == azgra::bytes_to_i32(bytes, 18));
+    REQUIRE(record.value == azgra::bytes_to_float(bytes, 22));
+
+    std::vector<azgra::u16> values(100);
+    stream.read_array(values.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        REQUIRE(values[i] == azgra::bytes_to_u16(bytes, 26 + 2 * i));
+    }
+    const std::vector<azgra::i64> swapped = stream.read_array<azgra::i64>(10, azgra::ByteOrder_BigEndian);
+    REQUIRE(swapped[3] == azgra::byte_swap(azgra::bytes_to_i64(bytes, 226 + 3 * 8)));
+    REQUIRE(stream.get_position() == 306);
+    REQUIRE(stream.consume_double() == azgra::bytes_to_double(bytes, 306));
+}
+
+TEST_CASE("typed reads decode the same values in all input streams",
+          "[azgra::io::stream::InBinaryStreamBase]")
+{
+    REQUIRE(azgra::byte_swap<azgra::u32>(0x11223344u) == 0x44332211u);
+    REQUIRE(azgra::byte_swap(azgra::byte_swap(1.5)) == 1.5);
+
+    const std::string fileName = temporary_file("azgra_typed_read_test.bin");
+    const azgra::ByteArray bytes = make_test_bytes(1000);
+    write_test_file(fileName, bytes);
+
+    InMappedFileStream mapped(fileName);
+    check_typed_reads(mapped, bytes);
+
+    InBinaryFileStream file(fileName);
+    check_typed_reads(file, bytes);
+
+    InBinaryBufferStream memory(&bytes);
+    check_typed_reads(memory, bytes);
+
+    InBinaryFileStream bufferedFile(fileName);
+    InBinaryBufferStream buffered(&bufferedFile, 64);
+    buffered.move_to(0);
+    REQUIRE(buffered.read<azgra::u16>() == azgra::bytes_to_u16(bytes, 0));
+    std::vector<azgra::i32> ints(16);
+    buffered.read_array(ints.data(), ints.size());
+    REQUIRE(ints[15] == azgra::bytes_to_i32(bytes, 2 + 15 * 4));
+    REQUIRE(buffered.read<azgra::i64>() == azgra::bytes_to_i64(bytes, 66));
+
+    mapped.close_stream();
+    file.close_stream();
+    bufferedFile.close_stream();
+    std::filesystem::remove(fileName);
+}
+
+TEST_CASE("buffer stream read-ahead reads like the synchronous buffer",
+          "[azgra::io::stream::InBinaryBufferStream]")
+{
+    const std::string fileName = temporary_file("azgra_read_ahead_test.bin");
+    const azgra::ByteArray bytes = make_test_bytes(1000);
+    write_test_file(fileName, bytes);
+
+    for (const azgra::u32 depth : {1u, 2u, 3u})
+    {
+        InBinaryFileStream file(fileName);
+        InBinaryBufferStream buffered(&file, 100, depth);
+
+        // Records of 7 bytes cross the buffer boundaries.
+        for (size_t offset = 0; offset + 7 <= bytes.size(); offset += 7)
+        {
+            REQUIRE(buffered.get_position() == static_cast<azgra::i64>(offset));
+            const azgra::ByteArray record = buffered.consume_bytes(7);
+            REQUIRE(std::equal(record.begin(), record.end(), bytes.begin() + offset));
+        }
+        REQUIRE(buffered.get_position() == 994);
+
+        buffered.move_to(450);
+        REQUIRE(buffered.get_position() == 450);
+        REQUIRE(buffered.consume_int32() == azgra::bytes_to_i32(bytes, 450));
+        buffered.move_by(300);
+        REQUIRE(buffered.consume_int32() == azgra::bytes_to_i32(bytes, 754));
+
+        buffered.move_to_beginning();
+        std::vector<azgra::u16> values(500);
+        for (azgra::u16 &value : values)
+        {
+            value = buffered.read<azgra::u16>();
+        }
+        REQUIRE(values[499] == azgra::bytes_to_u16(bytes, 998));
+
+        if (depth > 1)
+        {
+            // Read-ahead copies reads larger than the buffer from as many buffers as needed.
+            buffered.move_to(30);
+            const azgra::ByteArray large = buffered.consume_bytes(350);
+            REQUIRE(std::equal(large.begin(), large.end(), bytes.begin() + 30));
+            REQUIRE(buffered.get_position() == 380);
+            const azgra::ByteArray rest = buffered.consume_bytes(620);
+            REQUIRE(std::equal(rest.begin(), rest.end(), bytes.begin() + 380));
+        }
+
+        buffered.move_to_end();
+        REQUIRE(buffered.get_position() == 1000);
+        file.close_stream();
+    }
+    std::filesystem::remove(fileName);
+}
+
+// File stream, whose reads fail from the given position on.
+class FailingFileStream : public InBinaryFileStream
+{
+private:
+    azgra::i64 failAt;
+
+public:
+    FailingFileStream(const std::string &file, const azgra::i64 failAt) : InBinaryFileStream(file), failAt(failAt)
+    {}
+
+    azgra::u64 consume_up_to(azgra::byte *dst, const azgra::u64 byteCount) override
+    {
+        if (get_position() >= failAt)
+        {
+            throw std::runtime_error("read failed");
+        }
+        return InBinaryFileStream::consume_up_to(dst, byteCount);
+    }
+};
+
+TEST_CASE("buffer stream read-ahead rethrows errors of the background reads",
+          "[azgra::io::stream::InBinaryBufferStream]")
+{
+    const std::string fileName = temporary_file("azgra_read_ahead_error_test.bin");
+    const azgra::ByteArray bytes = make_test_bytes(1000);
+    write_test_file(fileName, bytes);
+
+    FailingFileStream file(fileName, 500);
+    InBinaryBufferStream buffered(&file, 100, 3);
+    // Buffers read before the failure are consumed first.
+    const azgra::ByteArray head = buffered.consume_bytes(500);
+    REQUIRE(std::equal(head.begin(), head.end(), bytes.begin()));
+    REQUIRE_THROWS_AS(buffered.consume_byte(), std::runtime_error);
+
+    // Read-ahead is restarted by the move.
+    buffered.move_to(0);
+    REQUIRE(buffered.consume_int32() == azgra::bytes_to_i32(bytes, 0));
+
+    // Stops the read-ahead before the file is closed.
+    buffered.move_to_end();
+    file.close_stream();
+    std::filesystem::remove(fileName);
+}
+
+static void write_test_values(OutBinaryStreamBase &stream, const std::vector<azgra::i32> &values)
+{
+    stream.write_int32(-7);
+    stream.write_ushort16(513);
+    stream.write_double(2.5);
+    stream.write<azgra::u32>(0x11223344u, azgra::ByteOrder_BigEndian);
+    stream.write_array(values);
+    stream.write_replicated_bytes(9, 100);
+    stream.write_bytes(azgra::ByteArray{1, 2, 3});
+    stream.write_byte(4);
+}
+
+static void check_test_values(InBinaryStreamBase &stream, const std::vector<azgra::i32> &values)
+{
+    REQUIRE(stream.consume_int32() == -7);
+    REQUIRE(stream.consume_ushort16() == 513);
+    REQUIRE(stream.consume_double() == 2.5);
+    REQUIRE(stream.read<azgra::u32>(azgra::ByteOrder_BigEndian) == 0x11223344u);
+    REQUIRE(stream.read_array<azgra::i32>(values.size()) == values);
+    REQUIRE(stream.consume_bytes(100) == azgra::ByteArray(100, 9));
+    REQUIRE(stream.consume_bytes(4) == azgra::ByteArray{1, 2, 3, 4});
+}
+
+TEST_CASE("output streams grow and write typed values",
+          "[azgra::io::stream::OutBinaryBufferStream]")
+{
+    std::vector<azgra::i32> values(1000);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<azgra::i32>(i * 7919) - 5000;
+    }
+    const size_t writtenSize = 4 + 2 + 8 + 4 + values.size() * 4 + 100 + 4;
+
+    SECTION("buffer grows from small initial size")
+    {
+        OutBinaryBufferStream stream(4);
+        write_test_values(stream, values);
+        REQUIRE(stream.get_position() == writtenSize);
+
+        const azgra::ByteArray copy = stream.get_buffer_data();
+        const azgra::ByteArray released = stream.release_buffer();
+        REQUIRE(released == copy);
+        REQUIRE(stream.get_position() == 0);
+
+        InBinaryBufferStream input(&released);
+        check_test_values(input, values);
+
+        // Released stream can be reused.
+        stream.write_int32(42);
+        REQUIRE(stream.release_buffer() == azgra::int32_to_bytes(42));
+    }
+
+    SECTION("reserved buffer isn't reallocated")
+    {
+        OutBinaryBufferStream stream(0);
+        stream.reserve(writtenSize);
+        const azgra::byte *reserved = stream.get_buffer_pointer();
+        write_test_values(stream, values);
+        REQUIRE(stream.get_buffer_pointer() == reserved);
+        const azgra::ByteArray released = stream.release_buffer();
+        REQUIRE(released.size() == writtenSize);
+        REQUIRE(released.data() == reserved);
+    }
+
+    SECTION("file stream writes the same bytes")
+    {
+        const std::string fileName = temporary_file("azgra_out_stream_test.bin");
+        {
+            OutBinaryFileStream stream(fileName.c_str());
+            write_test_values(stream, values);
+        }
+        InBinaryFileStream input(fileName);
+        REQUIRE(input.get_size() == static_cast<azgra::i64>(writtenSize));
+        check_test_values(input, values);
+        input.close_stream();
+        std::filesystem::remove(fileName);
+    }
+}
@@ -0,0 +1,130 @@
+#include <catch2/catch.hpp>
+#include <azgra/collection/columnar.h>
+#include "parallel_settings.h"
+#include <cmath>
+#include <limits>
+
+using namespace azgra::collection;
+
+struct Measurement
+{
+    azgra::i32 sensor;
+    azgra::f64 value;
+    azgra::f32 quality;
+    std::string label;
+};
+
+static std::vector<Measurement> make_measurements(const size_t count)
+{
+    std::vector<Measurement> measurements(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        measurements[i] = {static_cast<azgra::i32>(i % 10), static_cast<azgra::f64>(i) * 0.5,
+                           static_cast<azgra::f32>(i % 100) / 100.0f, "m" + std::to_string(i)};
+    }
+    return measurements;
+}
+
+TEST_CASE("columnar table filters and aggregates by columns",
+          "[azgra::collection::columnar]")
+{
+    const auto measurements = make_measurements(1000);
+    const auto table = ColumnarTable<azgra::i32, azgra::f64, azgra::f32, std::string>::from_records(
+            measurements, &Measurement::sensor, &Measurement::value, &Measurement::quality, &Measurement::label);
+    REQUIRE(table.size() == 1000);
+    REQUIRE(std::get<3>(table.row(7)) == "m7");
+
+    const auto sensor3 = table.where<0>([](const azgra::i32 sensor)
+                                        { return sensor == 3; });
+    REQUIRE(sensor3.count() == 100);
+    REQUIRE(sensor3.selection()[1] == 13);
+
+    const auto goodSensor3 = sensor3.where<2>([](const azgra::f32 quality)
+                                              { return quality >= 0.5f; });
+    const auto reference = Enumerable<Measurement>(measurements)
+            .where([](const Measurement &m)
+                   { return m.sensor == 3 && m.quality >= 0.5f; });
+    REQUIRE(goodSensor3.count() == reference.count());
+    REQUIRE(goodSensor3.sum<1>() == reference.sum([](const Measurement &m)
+                                                  { return m.value; }));
+    REQUIRE(goodSensor3.select<3>().to_vector() == reference.select([](const Measurement &m)
+                                                                    { return m.label; }).to_vector());
+    REQUIRE(goodSensor3.min_max<1>() == std::make_pair(26.5, 496.5));
+    REQUIRE(goodSensor3.average<0>() == 3.0);
+
+    const auto both = table.where<0, 2>([](const azgra::i32 sensor, const azgra::f32 quality)
+                                        { return sensor == 3 && quality >= 0.5f; });
+    REQUIRE(both.selection() == goodSensor3.selection());
+    REQUIRE(both.bitmap() == sensor3.where_bitmap<2>([](const azgra::f32 quality)
+                                                     { return quality >= 0.5f; }));
+    REQUIRE(both.select<0, 1>([](const azgra::i32 sensor, const azgra::f64 value)
+                              { return sensor + value; }).first() == 3 + 26.5);
+
+    const auto subTable = both.to_table();
+    REQUIRE(subTable.size() == both.count());
+    REQUIRE(subTable.column<3>().front() == "m53");
+
+    REQUIRE(table.query().is_all_rows());
+    REQUIRE(table.query().sum<0>() == 4500);
+    REQUIRE(table.query().min_max<2>() == std::make_pair(0.0f, 0.99f));
+    REQUIRE(table.where<0>([](const azgra::i32 sensor)
+                           { return sensor > 100; }).count() == 0);
+    REQUIRE_THROWS_AS(table.where<0>([](const azgra::i32 sensor)
+                                     { return sensor > 100; }).min<1>(), EnumerableError);
+}
+
+TEST_CASE("columnar parallel filter matches sequential filter",
+          "[azgra::collection::columnar]")
+{
+    const ParallelSettings settings;
+
+    std::vector<azgra::i64> ids(100037);
+    std::vector<azgra::f32> values(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        ids[i] = static_cast<azgra::i64>(i);
+        values[i] = static_cast<azgra::f32>((i * 7919) % 1000);
+    }
+    const ColumnarTable<azgra::i64, azgra::f32> table(ids, values);
+    const auto predicate = [](const azgra::f32 value)
+    { return value < 250.0f; };
+
+    const auto sequential = table.where<1>(predicate);
+    const auto parallel = table.where<1>(predicate, azgra::ExecutionPolicy_Parallel);
+    REQUIRE(parallel.selection() == sequential.selection());
+    REQUIRE(parallel.count() == Enumerable<azgra::f32>(values).count(predicate));
+    REQUIRE(parallel.sum<0>() == sequential.select<0>().sum([](const azgra::i64 id)
+                                                            { return id; }));
+}
+
+TEST_CASE("columnar float aggregates don't depend on the selection",
+          "[azgra::collection::columnar]")
+{
+    std::vector<azgra::i32> ids(1001);
+    std::vector<azgra::f32> values(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        ids[i] = static_cast<azgra::i32>(i);
+        values[i] = 1.0f / static_cast<azgra::f32>(i + 1);
+    }
+    values[500] = -0.0f;
+    const auto all_rows = [](const azgra::i32)
+    { return true; };
+
+    const ColumnarTable<azgra::i32, azgra::f32> table(ids, values);
+    const auto unfiltered = table.query();
+    const auto filtered = table.where<0>(all_rows);
+    REQUIRE_FALSE(filtered.is_all_rows());
+    REQUIRE(filtered.count() == unfiltered.count());
+    REQUIRE(unfiltered.sum<1>() == filtered.sum<1>());
+    REQUIRE(unfiltered.min_max<1>() == filtered.min_max<1>());
+    REQUIRE(std::signbit(unfiltered.min<1>()) == std::signbit(filtered.min<1>()));
+
+    values[7] = std::numeric_limits<azgra::f32>::quiet_NaN();
+    const ColumnarTable<azgra::i32, azgra::f32> nanTable(ids, values);
+    const auto nanFiltered = nanTable.where<0>(all_rows);
+    REQUIRE(std::isnan(nanTable.query().sum<1>()));
+    REQUIRE(std::isnan(nanFiltered.sum<1>()));
+    REQUIRE(nanTable.query().min_max<1>() == nanFiltered.min_max<1>());
+    REQUIRE(nanTable.query().min_max<1>() == std::make_pair(-0.0f, 1.0f));
+}
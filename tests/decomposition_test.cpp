@@ -0,0 +1,175 @@
+#include <catch2/catch.hpp>
+#include <azgra/linalg/decomposition.h>
+#include "parallel_settings.h"
+
+template<typename T, bool RowBased = true>
+static azgra::Matrix<T, RowBased> pseudo_random_matrix(const size_t rows, const size_t cols, const size_t seed)
+{
+    azgra::Matrix<T, RowBased> matrix(rows, cols);
+    size_t state = seed;
+    for (size_t row = 0; row < rows; ++row)
+    {
+        for (size_t col = 0; col < cols; ++col)
+        {
+            state = (state * 6364136223846793005ull) + 1442695040888963407ull;
+            matrix.at(row, col) = static_cast<T>(static_cast<double>((state >> 33) % 2001) / 1000.0 - 1.0);
+        }
+    }
+    return matrix;
+}
+
+// A^T A + nI is symmetric positive definite.
+template<typename T>
+static azgra::Matrix<T> spd_matrix(const size_t size, const size_t seed)
+{
+    const auto a = pseudo_random_matrix<T>(size, size, seed);
+    azgra::Matrix<T> result = a.transpose() * a;
+    for (size_t i = 0; i < size; ++i)
+    {
+        result.at(i, i) += static_cast<T>(size);
+    }
+    return result;
+}
+
+template<typename A, typename B>
+static double max_difference(const A &a, const B &b)
+{
+    REQUIRE(a.rows() == b.rows());
+    REQUIRE(a.cols() == b.cols());
+    double result = 0.0;
+    for (size_t row = 0; row < a.rows(); ++row)
+    {
+        for (size_t col = 0; col < a.cols(); ++col)
+        {
+            result = std::max(result, std::abs(static_cast<double>(a.at(row, col)) - static_cast<double>(b.at(row, col))));
+        }
+    }
+    return result;
+}
+
+template<typename T>
+static void check_decompositions(const size_t size, const azgra::ExecutionPolicy policy)
+{
+    const double epsilon = std::is_same<T, float>::value ? 1e-2 : 1e-8;
+    const auto a = pseudo_random_matrix<T>(size, size, size);
+    const auto b = pseudo_random_matrix<T>(size, 3, size + 1);
+    const auto identity = azgra::linalg::identity_matrix<T>(size);
+
+    const azgra::linalg::LuDecomposition<T> lu(a, policy);
+    REQUIRE_FALSE(lu.is_singular());
+    azgra::Matrix<T> permuted(size, size);
+    for (size_t row = 0; row < size; ++row)
+    {
+        for (size_t col = 0; col < size; ++col)
+        {
+            permuted.at(row, col) = a.at(lu.get_permutation()[row], col);
+        }
+    }
+    REQUIRE(max_difference(lu.lower() * lu.upper(), permuted) < epsilon);
+    REQUIRE(max_difference(a * lu.solve(b, policy), b) < epsilon);
+    REQUIRE(max_difference(a * lu.inverse(policy), identity) < epsilon);
+
+    const auto spd = spd_matrix<T>(size, size + 2);
+    const azgra::linalg::CholeskyDecomposition<T> cholesky(spd, policy);
+    REQUIRE(cholesky.is_positive_definite());
+    REQUIRE(max_difference(cholesky.lower() * cholesky.lower().transpose(), spd) < epsilon * size);
+    REQUIRE(max_difference(spd * cholesky.solve(b, policy), b) < epsilon * size);
+    REQUIRE(cholesky.determinant() == Approx(azgra::linalg::LuDecomposition<T>(spd, policy).determinant()).epsilon(1e-3));
+
+    const auto tall = pseudo_random_matrix<T>(size + 7, size, size + 3);
+    const azgra::linalg::QrDecomposition<T> qr(tall, policy);
+    REQUIRE(qr.is_full_rank());
+    const auto q = qr.q(policy);
+    REQUIRE(max_difference(q * qr.r(), tall) < epsilon);
+    REQUIRE(max_difference(q.transpose() * q, identity) < epsilon);
+
+    // Least squares solution satisfies the normal equations A^T A x = A^T b.
+    const auto tallB = pseudo_random_matrix<T>(size + 7, 2, size + 4);
+    const auto x = qr.solve(tallB, policy);
+    const auto tallT = tall.transpose();
+    REQUIRE(max_difference(tallT * tall * x, tallT * tallB) < epsilon * size);
+}
+
+TEST_CASE("LU decomposition",
+          "[azgra::linalg::decomposition]")
+{
+    const azgra::Matrix<double> a(3, 3, {2, 1, 1,
+                                         4, -6, 0,
+                                         -2, 7, 2});
+    const azgra::linalg::LuDecomposition<double> lu(a);
+    REQUIRE(lu.determinant() == Approx(-16.0));
+    REQUIRE(azgra::linalg::determinant(a) == Approx(-16.0));
+
+    const std::vector<double> x = azgra::linalg::solve(a, std::vector<double>{5, -2, 9});
+    REQUIRE(x[0] == Approx(1.0));
+    REQUIRE(x[1] == Approx(1.0));
+    REQUIRE(x[2] == Approx(2.0));
+
+    const auto inverse = azgra::linalg::inverse(a);
+    REQUIRE(max_difference(a * inverse, azgra::linalg::identity_matrix<double>(3)) < 1e-12);
+
+    // Column based input and result.
+    const auto byCols = a.to_layout<false>();
+    const auto inverseByCols = azgra::linalg::inverse(byCols);
+    REQUIRE(max_difference(inverseByCols, inverse) < 1e-12);
+    const azgra::Matrix<double, false> rhs = azgra::Matrix<double>(3, 1, {5, -2, 9}).to_layout<false>();
+    REQUIRE(max_difference(azgra::linalg::solve(byCols, rhs), azgra::Matrix<double>(3, 1, {1, 1, 2})) < 1e-12);
+
+    const azgra::Matrix<double> singular(3, 3, {1, 2, 3,
+                                                2, 4, 6,
+                                                1, 0, 1});
+    const azgra::linalg::LuDecomposition<double> singularLu(singular);
+    REQUIRE(singularLu.is_singular());
+    REQUIRE(singularLu.determinant() == 0.0);
+}
+
+TEST_CASE("Cholesky and QR decompositions",
+          "[azgra::linalg::decomposition]")
+{
+    const azgra::Matrix<double> spd(3, 3, {4, 12, -16,
+                                           12, 37, -43,
+                                           -16, -43, 98});
+    const azgra::linalg::CholeskyDecomposition<double> cholesky(spd);
+    REQUIRE(cholesky.is_positive_definite());
+    REQUIRE(max_difference(cholesky.lower(), azgra::Matrix<double>(3, 3, {2, 0, 0,
+                                                                          6, 1, 0,
+                                                                          -8, 5, 3})) < 1e-12);
+    REQUIRE(cholesky.determinant() == Approx(36.0));
+
+    const azgra::Matrix<double> indefinite(2, 2, {1, 2,
+                                                  2, 1});
+    REQUIRE_FALSE(azgra::linalg::CholeskyDecomposition<double>(indefinite).is_positive_definite());
+
+    // Fit of the line y = 1 + 2x through the exact points.
+    const azgra::Matrix<double> design(4, 2, {1, 0,
+                                              1, 1,
+                                              1, 2,
+                                              1, 3});
+    const azgra::linalg::QrDecomposition<double> qr(design);
+    const std::vector<double> coefficients = qr.solve(std::vector<double>{1, 3, 5, 7});
+    REQUIRE(coefficients[0] == Approx(1.0));
+    REQUIRE(coefficients[1] == Approx(2.0));
+
+    const azgra::Matrix<double> wide(2, 3, {1, 2, 3,
+                                            4, 5, 6});
+    const azgra::linalg::QrDecomposition<double> wideQr(wide);
+    REQUIRE_FALSE(wideQr.is_full_rank());
+    REQUIRE(max_difference(wideQr.q() * wideQr.r(), wide) < 1e-12);
+}
+
+TEST_CASE("blocked decompositions",
+          "[azgra::linalg::decomposition]")
+{
+    SECTION("sequential")
+    {
+        check_decompositions<double>(150, azgra::ExecutionPolicy_Sequential);
+        check_decompositions<float>(70, azgra::ExecutionPolicy_Sequential);
+    }
+
+    SECTION("parallel")
+    {
+        const ParallelSettings settings;
+
+        check_decompositions<double>(200, azgra::ExecutionPolicy_Parallel);
+    }
+}
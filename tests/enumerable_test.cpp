@@ -0,0 +1,301 @@
+#include <catch2/catch.hpp>
+#include <azgra/collection/enumerable.h>
+#include "parallel_settings.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+
+using azgra::collection::Enumerable;
+
+TEST_CASE("enumerable operators",
+          "[azgra::collection::enumerable]")
+{
+    const Enumerable<int> numbers(std::vector<int>{5, 1, 4, 2, 3, 6});
+
+    REQUIRE(numbers.where([](const int x)
+                          { return x % 2 == 0; }).to_vector() == std::vector<int>{4, 2, 6});
+    REQUIRE(numbers.select([](const int x)
+                           { return std::to_string(x); }).first() == "5");
+    REQUIRE(numbers.take(2).to_vector() == std::vector<int>{5, 1});
+    REQUIRE(numbers.take(100).count() == 6);
+    REQUIRE(numbers.skip(4).to_vector() == std::vector<int>{3, 6});
+    REQUIRE(numbers.skip(10).count() == 0);
+    REQUIRE(numbers.reverse().to_vector() == std::vector<int>{6, 3, 2, 4, 1, 5});
+    REQUIRE(numbers.take_while([](const int x)
+                               { return x != 2; }).to_vector() == std::vector<int>{5, 1, 4});
+    REQUIRE(numbers.last() == 6);
+    REQUIRE(numbers.sum() == 21.0);
+    REQUIRE(numbers.average() == 3.5);
+    REQUIRE(numbers.count([](const int x)
+                          { return x > 3; }) == 3);
+    REQUIRE(numbers.contains(4));
+    REQUIRE_FALSE(numbers.contains(7));
+    REQUIRE(numbers.contains([](const int x)
+                             { return x > 5; }));
+    REQUIRE(numbers.single([](const int x)
+                           { return x > 5; }) == 6);
+    REQUIRE_THROWS_AS(numbers.single([](const int x)
+                                     { return x > 4; }), azgra::collection::EnumerableError);
+    REQUIRE_FALSE(numbers.where([](const int x)
+                                { return x > 10; }).first_or_default().has_value());
+    REQUIRE_THROWS_AS(Enumerable<int>().first(), azgra::collection::EnumerableError);
+
+    const auto query = numbers.where([](const int x)
+                                     { return x > 1; })
+                              .select([](const int x)
+                                      { return x * 10; })
+                              .skip(1)
+                              .reverse()
+                              .take(3);
+    REQUIRE(query.to_vector() == std::vector<int>{60, 30, 20});
+    REQUIRE(query.sum([](const int x)
+                      { return x / 10; }) == 11);
+    REQUIRE(query.last() == 20);
+
+    // Lazy query is materialized into the vector backed Enumerable.
+    const Enumerable<int> materialized = query;
+    REQUIRE(materialized.to_vector() == std::vector<int>{60, 30, 20});
+    REQUIRE(materialized.copy_part(1, 2).to_vector() == std::vector<int>{30, 20});
+    REQUIRE(query.copy_part(1, 2).to_vector() == std::vector<int>{30, 20});
+    REQUIRE_THROWS(query.copy_part(2, 2));
+
+    std::vector<int> iterated;
+    for (const int value : query)
+    {
+        iterated.push_back(value);
+    }
+    REQUIRE(iterated == std::vector<int>{60, 30, 20});
+    REQUIRE(std::vector<int>(query.begin(), query.end()) == iterated);
+
+    REQUIRE(Enumerable<int>::range(3, 7).to_vector() == std::vector<int>{3, 4, 5, 6});
+    REQUIRE(Enumerable<int>::repeat(3, 9).sum() == 27.0);
+    REQUIRE(numbers.distinct().count() == 6);
+    REQUIRE(numbers.except(std::vector<int>{1, 2, 3}).to_vector() == std::vector<int>{5, 4, 6});
+}
+
+TEST_CASE("enumerable evaluation is lazy and short-circuits",
+          "[azgra::collection::enumerable]")
+{
+    size_t predicateCalls = 0;
+    size_t selectorCalls = 0;
+    const auto query = Enumerable<int>::range(0, 1000000)
+            .where([&predicateCalls](const int x)
+                   {
+                       ++predicateCalls;
+                       return x % 3 == 0;
+                   })
+            .select([&selectorCalls](const int x)
+                    {
+                        ++selectorCalls;
+                        return x * 2;
+                    });
+    REQUIRE(predicateCalls == 0);
+    REQUIRE(selectorCalls == 0);
+
+    REQUIRE(query.take(4).to_vector() == std::vector<int>{0, 6, 12, 18});
+    REQUIRE(predicateCalls == 10);
+    REQUIRE(selectorCalls == 4);
+
+    predicateCalls = 0;
+    REQUIRE(query.first() == 0);
+    REQUIRE(predicateCalls == 1);
+
+    predicateCalls = 0;
+    REQUIRE(query.any([](const int x)
+                      { return x > 10; }));
+    REQUIRE(predicateCalls == 7);
+
+    // Practically infinite source, only the taken prefix is generated.
+    const auto huge = Enumerable<long>::range(0, std::numeric_limits<long>::max());
+    REQUIRE(huge.skip(10).take(3).to_vector() == std::vector<long>{10, 11, 12});
+    REQUIRE(huge.take(1000).count() == 1000);
+}
+
+TEST_CASE("enumerable shares and detaches its data",
+          "[azgra::collection::enumerable]")
+{
+    Enumerable<int> original(std::vector<int>{1, 2, 3});
+    const Enumerable<int> copy = original;
+    const auto query = original.select([](const int x)
+                                       { return x + 1; });
+    for (int &value : original)
+    {
+        value *= 10;
+    }
+    REQUIRE(original.to_vector() == std::vector<int>{10, 20, 30});
+    REQUIRE(copy.to_vector() == std::vector<int>{1, 2, 3});
+    REQUIRE(query.to_vector() == std::vector<int>{2, 3, 4});
+}
+
+TEST_CASE("enumerable hash based set operations",
+          "[azgra::collection::enumerable]")
+{
+    const Enumerable<int> numbers(std::vector<int>{5, 1, 4, 1, 2, 5, 3, 6, 4});
+    const Enumerable<int> others(std::vector<int>{7, 4, 4, 1, 8});
+
+    REQUIRE(numbers.distinct().to_vector() == std::vector<int>{5, 1, 4, 2, 3, 6});
+    REQUIRE(numbers.except(others).to_vector() == std::vector<int>{5, 2, 5, 3, 6});
+    REQUIRE(numbers.intersect(others).to_vector() == std::vector<int>{1, 4});
+    REQUIRE(numbers.union_with(others).to_vector() == std::vector<int>{5, 1, 4, 2, 3, 6, 7, 8});
+    REQUIRE(Enumerable<int>().intersect(others).count() == 0);
+
+    const std::vector<int> data = numbers.to_vector();
+    REQUIRE(azgra::collection::distinct(data.begin(), data.end()) == std::vector<int>{5, 1, 4, 2, 3, 6});
+    REQUIRE(azgra::collection::intersect(data.begin(), data.end(), data.rbegin(), data.rend()) ==
+            std::vector<int>{5, 1, 4, 2, 3, 6});
+
+    const auto groups = numbers.group_by([](const int x)
+                                         { return x % 3; }).to_vector();
+    REQUIRE(groups.size() == 3);
+    REQUIRE(groups[0] == std::make_pair(2, std::vector<int>{5, 2, 5}));
+    REQUIRE(groups[1] == std::make_pair(1, std::vector<int>{1, 4, 1, 4}));
+    REQUIRE(groups[2] == std::make_pair(0, std::vector<int>{3, 6}));
+    REQUIRE(azgra::collection::group_by(data.begin(), data.end(), [](const int x)
+    { return x % 3; }) == groups);
+
+    const auto lookup = numbers.to_lookup([](const int x)
+                                          { return x > 3; });
+    REQUIRE(lookup.size() == 2);
+    REQUIRE(lookup.at(true) == std::vector<int>{5, 4, 5, 6, 4});
+    REQUIRE(lookup.at(false) == std::vector<int>{1, 1, 2, 3});
+
+    const Enumerable<std::pair<int, std::string>> names(std::vector<std::pair<int, std::string>>{
+            {1, "one"},
+            {4, "four"},
+            {1, "uno"},
+            {9, "nine"}});
+    const auto joined = numbers.join(names, [](const int x)
+                                     { return x; },
+                                     [](const std::pair<int, std::string> &name)
+                                     { return name.first; },
+                                     [](const int x, const std::pair<int, std::string> &name)
+                                     { return std::to_string(x) + name.second; });
+    REQUIRE(joined.to_vector() == std::vector<std::string>{"1one", "1uno", "4four", "1one", "1uno", "4four"});
+
+    const std::vector<std::pair<int, std::string>> nameData = names.to_vector();
+    REQUIRE(azgra::collection::join(data.begin(), data.end(), nameData.begin(), nameData.end(), [](const int x)
+                                    { return x; },
+                                    [](const std::pair<int, std::string> &name)
+                                    { return name.first; },
+                                    [](const int x, const std::pair<int, std::string> &name)
+                                    { return std::to_string(x) + name.second; }) == joined.to_vector());
+}
+
+TEST_CASE("enumerable ordering",
+          "[azgra::collection::enumerable]")
+{
+    struct Person
+    {
+        std::string name;
+        int age;
+        double height;
+
+        bool operator==(const Person &other) const
+        {
+            return name == other.name && age == other.age && height == other.height;
+        }
+    };
+    const Enumerable<Person> people(std::vector<Person>{
+            {"Eve",   30, 1.70},
+            {"Bob",   25, 1.80},
+            {"Alice", 30, 1.60},
+            {"Dan",   25, 1.75},
+            {"Carl",  40, 1.80}});
+    const auto names = [](const Person &person)
+    { return person.name; };
+
+    const auto byAge = people.order_by([](const Person &person)
+                                       { return person.age; });
+    REQUIRE(byAge.select(names).to_vector() == std::vector<std::string>{"Bob", "Dan", "Eve", "Alice", "Carl"});
+    REQUIRE(byAge.then_by(names).select(names).to_vector() ==
+            std::vector<std::string>{"Bob", "Dan", "Alice", "Eve", "Carl"});
+    REQUIRE(people.order_by_descending([](const Person &person)
+                                       { return person.height; })
+                  .then_by_descending(names)
+                  .select(names).to_vector() == std::vector<std::string>{"Carl", "Bob", "Dan", "Eve", "Alice"});
+    REQUIRE(byAge.take(3).select(names).to_vector() == std::vector<std::string>{"Bob", "Dan", "Eve"});
+    REQUIRE(byAge.take(10).count() == 5);
+    REQUIRE(byAge.take(0).count() == 0);
+    REQUIRE(byAge.take(4).take(2).select(names).to_vector() == std::vector<std::string>{"Bob", "Dan"});
+    REQUIRE_THROWS_AS(byAge.take(3).then_by(names), azgra::collection::EnumerableError);
+
+    // Large inputs use the radix sort and the parallel merge sort, both must match stable std::stable_sort.
+    const ParallelSettings settings(3);
+
+    std::vector<std::pair<int, int>> pairs(5000);
+    for (size_t i = 0; i < pairs.size(); ++i)
+    {
+        pairs[i] = std::make_pair(static_cast<int>((i * 7919) % 101) - 50, static_cast<int>(i));
+    }
+    const auto first = [](const std::pair<int, int> &pair)
+    { return pair.first; };
+    std::vector<std::pair<int, int>> expected = pairs;
+    std::stable_sort(expected.begin(), expected.end(), [](const auto &a, const auto &b)
+    { return a.first < b.first; });
+
+    const Enumerable<std::pair<int, int>> pairEnumerable(pairs);
+    REQUIRE(pairEnumerable.order_by(first).to_vector() == expected);
+    REQUIRE(pairEnumerable.order_by(first).then_by([](const std::pair<int, int> &pair)
+                                                   { return -pair.second; }).first() ==
+            *std::max_element(expected.begin(), expected.begin() + 50));
+    REQUIRE(pairEnumerable.order_by([](const std::pair<int, int> &pair)
+                                    { return std::to_string(pair.first + 500); }).to_vector() == expected);
+    REQUIRE(pairEnumerable.order_by(first).take(700).to_vector() ==
+            std::vector<std::pair<int, int>>(expected.begin(), expected.begin() + 700));
+
+    std::vector<std::pair<int, int>> expectedDescending = pairs;
+    std::stable_sort(expectedDescending.begin(), expectedDescending.end(), [](const auto &a, const auto &b)
+    { return a.first > b.first; });
+    REQUIRE(pairEnumerable.order_by_descending(first).to_vector() == expectedDescending);
+    REQUIRE(pairEnumerable.order_by_descending([](const std::pair<int, int> &pair)
+                                               { return static_cast<float>(pair.first) / 4.0f; }).to_vector() ==
+            expectedDescending);
+}
+
+TEST_CASE("enumerable ordering of signed zeros and NaNs doesn't depend on the input size",
+          "[azgra::collection::Enumerable]")
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float keys[] = {1.0f, -0.0f, nan, 0.0f, -1.0f, -nan, 0.0f, -0.0f, 2.0f, nan};
+    for (const size_t count : {size_t(200), azgra::collection::RadixSortThreshold * 3})
+    {
+        std::vector<std::pair<float, size_t>> items(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            items[i] = std::make_pair(keys[(i * 7) % 10], i);
+        }
+        const auto key = [](const std::pair<float, size_t> &item)
+        { return item.first; };
+        const auto index = [](const std::pair<float, size_t> &item)
+        { return item.second; };
+
+        // Zeros are equal and keep the source order, NaNs are after all numbers.
+        std::vector<std::pair<float, size_t>> expected = items;
+        std::stable_sort(expected.begin(), expected.end(), [](const auto &a, const auto &b)
+        { return azgra::collection::sort_key_less(a.first, b.first); });
+        std::vector<std::pair<float, size_t>> expectedDescending = items;
+        std::stable_sort(expectedDescending.begin(), expectedDescending.end(), [](const auto &a, const auto &b)
+        { return azgra::collection::sort_key_less(b.first, a.first); });
+        REQUIRE(std::isnan(expected.back().first));
+        REQUIRE(std::isnan(expectedDescending.front().first));
+
+        const Enumerable<std::pair<float, size_t>> enumerable(items);
+        const auto indices = [&](const std::vector<std::pair<float, size_t>> &sorted)
+        {
+            return Enumerable<std::pair<float, size_t>>(sorted).select(index).to_vector();
+        };
+        const std::vector<size_t> expectedIndices = indices(expected);
+        REQUIRE(enumerable.order_by(key).select(index).to_vector() == expectedIndices);
+        REQUIRE(enumerable.order_by_descending(key).select(index).to_vector() == indices(expectedDescending));
+        REQUIRE(enumerable.order_by(key).take(count / 2).select(index).to_vector() ==
+                std::vector<size_t>(expectedIndices.begin(), expectedIndices.begin() + count / 2));
+
+        std::vector<float> values = enumerable.select(key).to_vector();
+        azgra::collection::radix_sort(values);
+        for (size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(std::memcmp(&values[i], &expected[i].first, sizeof(float)) == 0);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#include <catch2/catch.hpp>
+#include <azgra/io/file_enumerable.h>
+#include "temporary_file.h"
+#include <cstdio>
+
+using azgra::collection::Enumerable;
+
+struct Record
+{
+    azgra::i32 id;
+    azgra::f32 value;
+};
+
+TEST_CASE("enumerable over text file lines",
+          "[azgra::io::file_enumerable]")
+{
+    const std::string fileName = temporary_file("azgra_file_enumerable_test.txt");
+    {
+        std::ofstream out(fileName);
+        for (int i = 0; i < 1000; ++i)
+        {
+            out << "line " << i << '\n';
+        }
+    }
+
+    const auto lines = azgra::io::enumerate_lines(fileName);
+    REQUIRE(lines.count() == 1000);
+    REQUIRE(lines.first() == "line 0");
+    REQUIRE(lines.where([](const std::string &line)
+                        { return line.back() == '7'; })
+                 .select([](const std::string &line)
+                         { return std::stoi(line.substr(5)); })
+                 .take(3)
+                 .to_vector() == std::vector<int>{7, 17, 27});
+    REQUIRE(lines.select([](const std::string &line)
+                         { return static_cast<double>(std::stoi(line.substr(5))); }).sum() == 499500.0);
+    std::remove(fileName.c_str());
+}
+
+TEST_CASE("enumerable over binary records",
+          "[azgra::io::file_enumerable]")
+{
+    const std::string fileName = temporary_file("azgra_file_enumerable_test.bin");
+    // More records than fit into one read buffer, header of 8 bytes and incomplete record at the end.
+    const int recordCount = 20000;
+    {
+        std::ofstream out(fileName, std::ios::binary);
+        const azgra::i64 header = 42;
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        for (int i = 0; i < recordCount; ++i)
+        {
+            const Record record{i, static_cast<azgra::f32>(i) * 0.5f};
+            out.write(reinterpret_cast<const char *>(&record), sizeof(record));
+        }
+        out.write("xyz", 3);
+    }
+
+    const auto records = azgra::io::enumerate_records<Record>(fileName, sizeof(azgra::i64));
+    REQUIRE(records.count() == recordCount);
+    REQUIRE(records.sum([](const Record &record)
+                        { return static_cast<azgra::i64>(record.id); }) == (static_cast<azgra::i64>(recordCount) * (recordCount - 1)) / 2);
+    REQUIRE(records.single([](const Record &record)
+                           { return record.value == 100.0f; }).id == 200);
+    REQUIRE(records.last().id == recordCount - 1);
+
+    const auto parsed = azgra::io::enumerate_parsed_records(fileName, [](azgra::io::stream::InBinaryStreamBase &stream)
+    {
+        const azgra::i32 id = stream.consume_int32();
+        stream.consume_float();
+        return id;
+    }, sizeof(azgra::i64));
+    REQUIRE(parsed.take(4).to_vector() == std::vector<azgra::i32>{0, 1, 2, 3});
+    std::remove(fileName.c_str());
+}
+
+TEST_CASE("enumerable over generator",
+          "[azgra::collection::enumerable]")
+{
+    const auto fibonacci = Enumerable<azgra::u64>::generate([a = azgra::u64(0), b = azgra::u64(1)]() mutable
+                                                           {
+                                                               const azgra::u64 result = a;
+                                                               a = b;
+                                                               b += result;
+                                                               return std::optional<azgra::u64>(result);
+                                                           });
+    REQUIRE(fibonacci.take(10).to_vector() == std::vector<azgra::u64>{0, 1, 1, 2, 3, 5, 8, 13, 21, 34});
+    // Every traversal starts with the fresh copy of the generator.
+    REQUIRE(fibonacci.first() == 0);
+    REQUIRE(fibonacci.take_while([](const azgra::u64 x)
+                                 { return x < 1000; }).count() == 17);
+
+    const auto countdown = Enumerable<int>::generate([n = 5]() mutable
+                                                     { return (n > 0) ? std::optional<int>(n--) : std::nullopt; });
+    REQUIRE(countdown.to_vector() == std::vector<int>{5, 4, 3, 2, 1});
+    REQUIRE(countdown.order_by([](const int x)
+                               { return x; }).first() == 1);
+}
@@ -0,0 +1,167 @@
+#include <catch2/catch.hpp>
+#include <azgra/fixed_matrix.h>
+
+using Mat2 = azgra::FixedMatrix<int, 2, 2>;
+using Mat3f = azgra::FixedMatrix<double, 3, 3>;
+using Mat4f = azgra::FixedMatrix<double, 4, 4>;
+
+template<typename A, typename B>
+static bool approx_equal(const A &a, const B &b, const double epsilon = 1e-9)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols())
+    {
+        return false;
+    }
+    for (size_t row = 0; row < a.rows(); ++row)
+    {
+        for (size_t col = 0; col < a.cols(); ++col)
+        {
+            if (std::abs(static_cast<double>(a.at(row, col)) - static_cast<double>(b.at(row, col))) > epsilon)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Generic code working with both Matrix and FixedMatrix.
+template<typename M>
+static typename M::ValueType trace(const M &matrix)
+{
+    typename M::ValueType result{};
+    for (size_t i = 0; i < matrix.rows(); ++i)
+    {
+        result += matrix.at(i, i);
+    }
+    return result;
+}
+
+TEST_CASE("fixed matrix constructors and element access",
+          "[azgra::fixed_matrix]")
+{
+    constexpr Mat2 zero;
+    constexpr Mat2 filled(7);
+    constexpr Mat2 listed{1, 2, 3, 4};
+    constexpr azgra::FixedMatrix<int, 2, 2, false> byCols{1, 2, 3, 4};
+
+    static_assert(Mat2::rows() == 2 && Mat2::cols() == 2);
+    static_assert(zero.sum() == 0);
+    static_assert(filled.sum() == 28);
+    static_assert(listed.at(0, 1) == 2 && listed.at(1, 0) == 3);
+    static_assert(byCols.at(0, 1) == 3 && byCols.at(1, 0) == 2);
+    static_assert(Mat2::identity() == Mat2{1, 0, 0, 1});
+
+    REQUIRE(listed.row(1) == std::array<int, 2>{3, 4});
+    REQUIRE(byCols.col(1) == std::array<int, 2>{3, 4});
+    REQUIRE(listed.min() == 1);
+    REQUIRE(listed.max() == 4);
+    REQUIRE(listed.norm() == Approx(std::sqrt(30.0)));
+
+    const azgra::FixedMatrix<int, 2, 3> rect{1, 2, 3, 4, 5, 6};
+    std::vector<int> secondCol(rect.col_cbegin(1), rect.col_cend(1));
+    REQUIRE(secondCol == std::vector<int>{2, 5});
+    std::vector<int> secondRow(rect.row_cbegin(1), rect.row_cend(1));
+    REQUIRE(secondRow == std::vector<int>{4, 5, 6});
+}
+
+TEST_CASE("fixed matrix arithmetic",
+          "[azgra::fixed_matrix]")
+{
+    constexpr Mat2 a{1, 2, 3, 4};
+    constexpr Mat2 b{5, 6, 7, 8};
+
+    static_assert(a + b == Mat2{6, 8, 10, 12});
+    static_assert(b - a == Mat2(4));
+    static_assert(-a == Mat2{-1, -2, -3, -4});
+    static_assert(a * 2 == 2 * a);
+    static_assert(a * 2 == Mat2{2, 4, 6, 8});
+    static_assert((a * 4) / 2 == a * 2);
+    static_assert(a * b == Mat2{19, 22, 43, 50});
+    static_assert(a * Mat2::identity() == a);
+    static_assert(a.transpose() == Mat2{1, 3, 2, 4});
+
+    constexpr azgra::FixedMatrix<int, 2, 3> lhs{1, 2, 3, 4, 5, 6};
+    constexpr azgra::FixedMatrix<int, 3, 2, false> rhs{7, 9, 11, 8, 10, 12};
+    constexpr auto product = lhs * rhs;
+    static_assert(decltype(product)::rows() == 2 && decltype(product)::cols() == 2);
+    static_assert(product == Mat2{58, 64, 139, 154});
+    static_assert(lhs.transpose().at(2, 1) == 6);
+
+    Mat2 accumulated = a;
+    accumulated += b;
+    accumulated -= a;
+    REQUIRE(accumulated == b);
+    REQUIRE(a != b);
+
+    // Same results as the dynamically sized matrix.
+    const auto dynamicProduct = lhs.to_matrix() * rhs.to_matrix();
+    REQUIRE(approx_equal(dynamicProduct, product));
+    REQUIRE(trace(product) == trace(dynamicProduct));
+}
+
+TEST_CASE("fixed matrix determinant and inverse",
+          "[azgra::fixed_matrix]")
+{
+    static_assert(azgra::FixedMatrix<int, 1, 1>{5}.determinant() == 5);
+    static_assert(Mat2{1, 2, 3, 4}.determinant() == -2);
+    static_assert(azgra::FixedMatrix<int, 3, 3>{2, 0, 1, 1, 3, 2, 1, 1, 2}.determinant() == 6);
+    static_assert(azgra::FixedMatrix<int, 4, 4>{1, 0, 2, -1,
+                                                3, 0, 0, 5,
+                                                2, 1, 4, -3,
+                                                1, 0, 5, 0}.determinant() == 30);
+
+    constexpr Mat3f rotation{0.0, -1.0, 0.0,
+                             1.0, 0.0, 0.0,
+                             0.0, 0.0, 1.0};
+    static_assert(rotation.inverse() == rotation.transpose());
+
+    const Mat4f transform{2.0, 0.5, 0.0, 1.0,
+                          0.0, 1.5, -1.0, 2.0,
+                          1.0, 0.0, 3.0, -1.0,
+                          0.0, 2.0, 1.0, 4.0};
+    REQUIRE(approx_equal(transform * transform.inverse(), Mat4f::identity()));
+    REQUIRE(approx_equal(transform.inverse() * transform, Mat4f::identity()));
+    REQUIRE(transform.determinant() == Approx(transform.transpose().determinant()));
+
+    const azgra::FixedMatrix<double, 4, 4, false> transformByCols(transform.transpose().get_data());
+    REQUIRE(approx_equal(transformByCols, transform));
+    REQUIRE(approx_equal(transformByCols.inverse(), transform.inverse()));
+
+    const Mat2 singular{1, 2, 2, 4};
+    REQUIRE(singular.determinant() == 0);
+
+    // Larger matrices use Gaussian elimination.
+    azgra::FixedMatrix<double, 6, 6> large;
+    for (size_t row = 0; row < 6; ++row)
+    {
+        for (size_t col = 0; col < 6; ++col)
+        {
+            large.at(row, col) = (row == col) ? 10.0 : static_cast<double>((row * 7 + col * 3) % 5) - 2.0;
+        }
+    }
+    REQUIRE(approx_equal(large * large.inverse(), azgra::FixedMatrix<double, 6, 6>::identity()));
+    REQUIRE(large.determinant() == Approx(large.transpose().determinant()));
+    constexpr azgra::FixedMatrix<double, 5, 5> diagonal{2, 0, 0, 0, 0,
+                                                        0, 3, 0, 0, 0,
+                                                        0, 0, 1, 0, 0,
+                                                        0, 0, 0, 4, 0,
+                                                        0, 0, 0, 0, 5};
+    static_assert(diagonal.determinant() == 120.0);
+}
+
+TEST_CASE("fixed matrix in matrix expressions",
+          "[azgra::fixed_matrix]")
+{
+    const Mat2 fixed{1, 2, 3, 4};
+    const azgra::Matrix<int> dynamic(2, 2, 10);
+
+    const azgra::Matrix<int> sum = dynamic + fixed * 2;
+    REQUIRE(sum == azgra::Matrix<int>(2, 2, {12, 14, 16, 18}));
+
+    const Mat2 fromExpression(dynamic - fixed.transpose().to_matrix());
+    REQUIRE(fromExpression == Mat2{9, 7, 8, 6});
+
+    const Mat2 fromView(dynamic.transpose_view() + fixed.view());
+    REQUIRE(fromView == Mat2{11, 12, 13, 14});
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch.hpp>
+#include <azgra/io/matrix_file.h>
+#include "temporary_file.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+template<typename T, bool RowBased>
+static azgra::Matrix<T, RowBased> numbered_matrix(const size_t rows, const size_t cols)
+{
+    azgra::Matrix<T, RowBased> matrix(rows, cols);
+    for (size_t row = 0; row < rows; ++row)
+    {
+        for (size_t col = 0; col < cols; ++col)
+        {
+            matrix.at(row, col) = static_cast<T>(row * 1000 + col) / static_cast<T>(4);
+        }
+    }
+    return matrix;
+}
+
+TEST_CASE("matrix file save and map",
+          "[azgra::io::matrix_file]")
+{
+    const std::string fileName = temporary_file("azgra_matrix_file_test.azm");
+
+    SECTION("row based")
+    {
+        const auto matrix = numbered_matrix<double, true>(37, 19);
+        azgra::io::save_matrix(matrix, fileName.c_str());
+
+        const azgra::io::MappedMatrixFile mapped(fileName.c_str());
+        REQUIRE(mapped.rows() == 37);
+        REQUIRE(mapped.cols() == 19);
+        REQUIRE(mapped.is_row_based());
+        REQUIRE(mapped.element_type() == azgra::io::MatrixElementType_F64);
+        REQUIRE(mapped.is_element_type<double>());
+        REQUIRE_FALSE(mapped.is_element_type<float>());
+        REQUIRE(mapped.header().dataOffset % mapped.header().alignment == 0);
+
+        const auto view = mapped.view<double>();
+        REQUIRE(reinterpret_cast<std::uintptr_t>(view.data()) % azgra::SimdAlignment == 0);
+        REQUIRE(view.at(36, 18) == matrix.at(36, 18));
+        REQUIRE(azgra::Matrix<double>(view) == matrix);
+        REQUIRE(mapped.to_matrix<double>() == matrix);
+        REQUIRE(mapped.to_matrix<double, false>() == matrix.to_layout<false>());
+        REQUIRE(azgra::io::load_matrix<double>(fileName.c_str()) == matrix);
+    }
+
+    SECTION("column based")
+    {
+        const auto matrix = numbered_matrix<float, false>(11, 29);
+        azgra::io::save_matrix(matrix, fileName.c_str());
+
+        const azgra::io::MappedMatrixFile mapped(fileName.c_str());
+        REQUIRE_FALSE(mapped.is_row_based());
+        REQUIRE(mapped.view<float>().at(10, 28) == matrix.at(10, 28));
+        REQUIRE(mapped.view<float>().col_stride() == 11);
+        REQUIRE(mapped.to_matrix<float, false>() == matrix);
+        REQUIRE(azgra::io::load_matrix<float, true>(fileName.c_str()) == matrix.to_layout<true>());
+    }
+
+    SECTION("empty matrix")
+    {
+        azgra::io::save_matrix(azgra::Matrix<int>(0, 5), fileName.c_str());
+        const azgra::io::MappedMatrixFile mapped(fileName.c_str());
+        REQUIRE(mapped.rows() == 0);
+        REQUIRE(mapped.cols() == 5);
+        REQUIRE(mapped.to_matrix<int>().get_data().empty());
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST_CASE("matrix file streaming writer",
+          "[azgra::io::matrix_file]")
+{
+    const std::string fileName = temporary_file("azgra_matrix_file_writer_test.azm");
+    const auto expected = numbered_matrix<azgra::i32, true>(100, 7);
+
+    {
+        azgra::io::MatrixFileWriter<azgra::i32> writer(fileName.c_str(), 100, 7);
+        // Write the matrix row by row, as if it was generated on the fly.
+        for (size_t row = 0; row < 100; ++row)
+        {
+            writer.write(std::vector<azgra::i32>(expected.row_cbegin(row), expected.row_cend(row)));
+        }
+        REQUIRE(writer.remaining() == 0);
+        writer.close();
+    }
+
+    const azgra::io::MappedMatrixFile mapped(fileName.c_str());
+    mapped.advise(azgra::io::MemoryAccessPattern_Sequential);
+    REQUIRE(mapped.element_type() == azgra::io::MatrixElementType_I32);
+    REQUIRE(azgra::Matrix<azgra::i32>(mapped.view<azgra::i32>()) == expected);
+
+    std::remove(fileName.c_str());
+}
+
+TEST_CASE("matrix file header validation",
+          "[azgra::io::matrix_file]")
+{
+    using namespace azgra::io;
+    static_assert(matrix_element_type<azgra::byte>() == MatrixElementType_U8);
+    static_assert(matrix_element_type<azgra::i16>() == MatrixElementType_I16);
+    static_assert(matrix_element_type<azgra::u64>() == MatrixElementType_U64);
+    static_assert(matrix_element_type<float>() == MatrixElementType_F32);
+
+    const MatrixFileHeader header = make_matrix_file_header(MatrixElementType_F32, 10, 20, true);
+    const size_t fileSize = header.dataOffset + (10 * 20 * sizeof(float));
+    REQUIRE(is_valid_matrix_file_header(header, fileSize));
+    REQUIRE_FALSE(is_valid_matrix_file_header(header, fileSize - 1));
+
+    MatrixFileHeader badMagic = header;
+    badMagic.magic[0] = 'X';
+    REQUIRE_FALSE(is_valid_matrix_file_header(badMagic, fileSize));
+
+    MatrixFileHeader foreignByteOrder = header;
+    foreignByteOrder.byteOrderMark = 0x04030201;
+    REQUIRE_FALSE(is_valid_matrix_file_header(foreignByteOrder, fileSize));
+
+    MatrixFileHeader overflowingDimensions = header;
+    overflowingDimensions.rowCount = 1ull << 62;
+    overflowingDimensions.colCount = 1ull << 62;
+    REQUIRE_FALSE(is_valid_matrix_file_header(overflowingDimensions, fileSize));
+}
@@ -1,6 +1,9 @@
 #include <catch2/catch.hpp>
 #include <azgra/matrix.h>
+#include "parallel_settings.h"
 #include <algorithm>
+#include <cstdint>
+#include <string>
 
 TEST_CASE("uniform dimension matrix constructor", "[azgra::matrix]")
 {
@@ -233,7 +236,7 @@ TEST_CASE("operator+,operator-",
 
     SECTION("operator+")
     {
-        const auto addResult = matrix + matrix2;
+        const azgra::Matrix<int> addResult = matrix + matrix2;
 
         REQUIRE(addResult.rows() == 2);
         REQUIRE(addResult.cols() == 2);
@@ -246,7 +249,7 @@ TEST_CASE("operator+,operator-",
 
     SECTION("operator-")
     {
-        const auto subResult = matrix - matrix2;
+        const azgra::Matrix<int> subResult = matrix - matrix2;
 
         REQUIRE(subResult.rows() == 2);
         REQUIRE(subResult.cols() == 2);
@@ -293,6 +296,581 @@ TEST_CASE("operator+=,operator-=",
         REQUIRE(matrix.at(1, 1) == (1 - 7));
     }
 }
+template<typename T, bool ResultRowBased, bool LhsRowBased, bool RhsRowBased>
+static azgra::Matrix<T, ResultRowBased> naive_multiply(const azgra::Matrix<T, LhsRowBased> &a,
+                                                      const azgra::Matrix<T, RhsRowBased> &b)
+{
+    azgra::Matrix<T, ResultRowBased> result(a.rows(), b.cols());
+    for (size_t row = 0; row < a.rows(); ++row)
+    {
+        for (size_t col = 0; col < b.cols(); ++col)
+        {
+            T sum{};
+            for (size_t i = 0; i < a.cols(); ++i)
+            {
+                sum += a.at(row, i) * b.at(i, col);
+            }
+            result.at(row, col) = sum;
+        }
+    }
+    return result;
+}
+
+template<typename T, bool RowBased>
+static azgra::Matrix<T, RowBased> sequence_matrix(const size_t rows, const size_t cols, const int modulo)
+{
+    azgra::Matrix<T, RowBased> matrix(rows, cols);
+    for (size_t row = 0; row < rows; ++row)
+    {
+        for (size_t col = 0; col < cols; ++col)
+        {
+            matrix.at(row, col) = static_cast<T>(static_cast<int>((row * 7) + (col * 3)) % modulo - (modulo / 2));
+        }
+    }
+    return matrix;
+}
+
+template<typename T, bool LhsRowBased, bool RhsRowBased>
+static void check_multiply(const size_t m, const size_t k, const size_t n)
+{
+    const auto a = sequence_matrix<T, LhsRowBased>(m, k, 11);
+    const auto b = sequence_matrix<T, RhsRowBased>(k, n, 13);
+
+    const auto expected = naive_multiply<T, LhsRowBased>(a, b);
+    const auto result = a * b;
+
+    REQUIRE(result.rows() == m);
+    REQUIRE(result.cols() == n);
+    // Values are small integers, so floating point products are exact.
+    REQUIRE(result == expected);
+}
+
+TEST_CASE("multiply, operator*",
+          "[azgra::matrix]")
+{
+    SECTION("small known product")
+    {
+        const azgra::Matrix<int> a(2, 3, {1, 2, 3, 4, 5, 6});
+        const azgra::Matrix<int> b(3, 2, {7, 8, 9, 10, 11, 12});
+        const azgra::Matrix<int> expected(2, 2, {58, 64, 139, 154});
+
+        REQUIRE(a.multiply(b) == expected);
+    }
+
+    SECTION("generic kernel, all storage orders")
+    {
+        check_multiply<int, true, true>(37, 53, 29);
+        check_multiply<int, true, false>(37, 53, 29);
+        check_multiply<int, false, true>(37, 53, 29);
+        check_multiply<int, false, false>(37, 53, 29);
+    }
+
+    SECTION("f32 kernel, all storage orders")
+    {
+        check_multiply<azgra::f32, true, true>(101, 300, 67);
+        check_multiply<azgra::f32, true, false>(101, 300, 67);
+        check_multiply<azgra::f32, false, true>(101, 300, 67);
+        check_multiply<azgra::f32, false, false>(101, 300, 67);
+    }
+
+    SECTION("f64 kernel, all storage orders")
+    {
+        check_multiply<azgra::f64, true, true>(6, 16, 32);
+        check_multiply<azgra::f64, true, false>(131, 270, 45);
+        check_multiply<azgra::f64, false, true>(131, 270, 45);
+        check_multiply<azgra::f64, false, false>(1, 9, 1);
+    }
+}
+
+template<typename LhsMatrix, typename RhsMatrix>
+static bool same_elements(const LhsMatrix &a, const RhsMatrix &b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols())
+    {
+        return false;
+    }
+    for (size_t row = 0; row < a.rows(); ++row)
+    {
+        for (size_t col = 0; col < a.cols(); ++col)
+        {
+            if (a.at(row, col) != b.at(row, col))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+TEST_CASE("parallel and sequential execution policy give same results",
+          "[azgra::matrix]")
+{
+    // Force the pool to be used even for these small matrices.
+    const ParallelSettings settings;
+
+    const auto a = sequence_matrix<int, true>(97, 131, 17);
+    const auto b = sequence_matrix<int, true>(97, 131, 23);
+
+    SECTION("fill constructor")
+    {
+        const azgra::Matrix<int> parallel(97, 131, 7, azgra::ExecutionPolicy_Parallel);
+        const azgra::Matrix<int> sequential(97, 131, 7, azgra::ExecutionPolicy_Sequential);
+        REQUIRE(parallel.equals(sequential, azgra::ExecutionPolicy_Sequential));
+    }
+
+    SECTION("equals")
+    {
+        REQUIRE(a.equals(a, azgra::ExecutionPolicy_Parallel));
+        REQUIRE(a.equals(b, azgra::ExecutionPolicy_Parallel) == a.equals(b, azgra::ExecutionPolicy_Sequential));
+    }
+
+    SECTION("add, subtract")
+    {
+        REQUIRE(a.add(b, azgra::ExecutionPolicy_Parallel) == a.add(b, azgra::ExecutionPolicy_Sequential));
+        REQUIRE(a.subtract(b, azgra::ExecutionPolicy_Parallel) == a.subtract(b, azgra::ExecutionPolicy_Sequential));
+    }
+
+    SECTION("add_in_place, subtract_in_place")
+    {
+        auto parallel = sequence_matrix<int, true>(97, 131, 17);
+        auto sequential = sequence_matrix<int, true>(97, 131, 17);
+
+        parallel.add_in_place(b, azgra::ExecutionPolicy_Parallel);
+        sequential.add_in_place(b, azgra::ExecutionPolicy_Sequential);
+        REQUIRE(parallel == sequential);
+
+        parallel.subtract_in_place(a, azgra::ExecutionPolicy_Parallel);
+        sequential.subtract_in_place(a, azgra::ExecutionPolicy_Sequential);
+        REQUIRE(parallel == sequential);
+    }
+
+    SECTION("strided views")
+    {
+        const auto byCols = b.to_layout<false>();
+        const azgra::Matrix<int> parallel(a.block(1, 2, 90, 120) + byCols.block(3, 4, 90, 120),
+                                          azgra::ExecutionPolicy_Parallel);
+        const azgra::Matrix<int> sequential(a.block(1, 2, 90, 120) + byCols.block(3, 4, 90, 120),
+                                            azgra::ExecutionPolicy_Sequential);
+        REQUIRE(parallel == sequential);
+
+        azgra::Matrix<int, false> transposed(131, 97, 0);
+        transposed.view().assign(a.transpose_view(), azgra::ExecutionPolicy_Parallel);
+        REQUIRE(same_elements(transposed, a.transpose()));
+    }
+
+    SECTION("reductions")
+    {
+        REQUIRE(a.sum(azgra::ExecutionPolicy_Parallel) == a.sum(azgra::ExecutionPolicy_Sequential));
+        REQUIRE(a.min(azgra::ExecutionPolicy_Parallel) == a.min(azgra::ExecutionPolicy_Sequential));
+        REQUIRE(a.max(azgra::ExecutionPolicy_Parallel) == a.max(azgra::ExecutionPolicy_Sequential));
+        REQUIRE(a.norm(azgra::ExecutionPolicy_Parallel) ==
+                Approx(a.norm(azgra::ExecutionPolicy_Sequential)));
+
+        const azgra::Matrix<int> known(2, 2, {3, -4, 0, 0});
+        REQUIRE(known.sum() == -1);
+        REQUIRE(known.min() == -4);
+        REQUIRE(known.max() == 3);
+        REQUIRE(known.norm() == Approx(5.0));
+    }
+}
+
+TEST_CASE("lazy matrix expressions",
+          "[azgra::matrix]")
+{
+    std::vector<int> dataA = {1, 2, 3, 4, 5, 6};
+    std::vector<int> dataB = {6, 5, 4, 3, 2, 1};
+    std::vector<int> dataC = {1, 1, 1, 1, 1, 1};
+    azgra::Matrix<int> a(2, 3, dataA);
+    const azgra::Matrix<int> b(2, 3, dataB);
+    const azgra::Matrix<int> c(2, 3, dataC);
+
+    SECTION("chained add, sub and scalar multiplication")
+    {
+        const azgra::Matrix<int> result = a + b - c * 2;
+        REQUIRE(result == azgra::Matrix<int>(2, 3, 5));
+
+        const azgra::Matrix<int> scaled = 3 * (a - c) / 1;
+        REQUIRE(scaled == azgra::Matrix<int>(2, 3, {0, 3, 6, 9, 12, 15}));
+    }
+
+    SECTION("unary functions")
+    {
+        const azgra::Matrix<int> negated = -a;
+        REQUIRE(negated == azgra::Matrix<int>(2, 3, {-1, -2, -3, -4, -5, -6}));
+
+        const azgra::Matrix<double> halves = azgra::apply(a + b, [](const int value)
+        { return value / 2.0; });
+        REQUIRE(halves == azgra::Matrix<double>(2, 3, 3.5));
+    }
+
+    SECTION("aliasing")
+    {
+        a = a + b;
+        REQUIRE(a == azgra::Matrix<int>(2, 3, 7));
+
+        a = b - a * 2;
+        REQUIRE(a == azgra::Matrix<int>(2, 3, {-8, -9, -10, -11, -12, -13}));
+
+        a += a;
+        REQUIRE(a == azgra::Matrix<int>(2, 3, {-16, -18, -20, -22, -24, -26}));
+
+        a -= c - a;
+        REQUIRE(a == azgra::Matrix<int>(2, 3, {-33, -37, -41, -45, -49, -53}));
+    }
+
+    SECTION("assignment changing dimensions")
+    {
+        azgra::Matrix<int> small(1, 1, 0);
+        small = b + c;
+        REQUIRE(small.rows() == 2);
+        REQUIRE(small.cols() == 3);
+        REQUIRE(small == azgra::Matrix<int>(2, 3, {7, 6, 5, 4, 3, 2}));
+    }
+
+    SECTION("column based matrices")
+    {
+        std::vector<int> colDataA = {1, 4, 2, 5, 3, 6};
+        std::vector<int> colDataB = {6, 3, 5, 2, 4, 1};
+        const azgra::Matrix<int, false> colA(2, 3, colDataA);
+        const azgra::Matrix<int, false> colB(2, 3, colDataB);
+
+        const azgra::Matrix<int, false> result = colA * 2 - colB;
+        for (size_t row = 0; row < 2; ++row)
+        {
+            for (size_t col = 0; col < 3; ++col)
+            {
+                REQUIRE(result.at(row, col) == (a.at(row, col) * 2 - b.at(row, col)));
+            }
+        }
+    }
+}
+
+template<typename T, bool RowBased>
+static void check_transpose(const size_t rows, const size_t cols)
+{
+    const auto matrix = sequence_matrix<T, RowBased>(rows, cols, 1000);
+    const auto transposed = matrix.transpose();
+
+    REQUIRE(transposed.rows() == cols);
+    REQUIRE(transposed.cols() == rows);
+    bool allMatch = true;
+    for (size_t row = 0; row < rows; ++row)
+    {
+        for (size_t col = 0; col < cols; ++col)
+        {
+            allMatch &= (transposed.at(col, row) == matrix.at(row, col));
+        }
+    }
+    REQUIRE(allMatch);
+}
+
+TEST_CASE("transpose and storage order conversion",
+          "[azgra::matrix]")
+{
+    SECTION("transpose")
+    {
+        check_transpose<int, true>(1, 1);
+        check_transpose<int, true>(3, 7);
+        check_transpose<int, false>(3, 7);
+        check_transpose<int, true>(129, 67);
+        check_transpose<int, false>(67, 129);
+    }
+
+    SECTION("parallel transpose")
+    {
+        const ParallelSettings settings(3);
+
+        check_transpose<int, true>(301, 77);
+        check_transpose<int, false>(77, 301);
+    }
+
+    SECTION("transpose in place")
+    {
+        for (const size_t size : {1, 2, 31, 32, 33, 100})
+        {
+            auto matrix = sequence_matrix<int, true>(size, size, 1000);
+            const auto expected = matrix.transpose();
+            matrix.transpose_in_place();
+            REQUIRE(matrix == expected);
+        }
+    }
+
+    SECTION("to_layout")
+    {
+        const auto rowMatrix = sequence_matrix<int, true>(45, 71, 1000);
+        const auto colMatrix = rowMatrix.to_layout<false>();
+        REQUIRE(same_elements(rowMatrix, colMatrix));
+        REQUIRE(colMatrix.to_layout<true>() == rowMatrix);
+        REQUIRE(rowMatrix.to_layout<true>() == rowMatrix);
+    }
+
+    SECTION("to_layout in place")
+    {
+        auto square = sequence_matrix<int, true>(70, 70, 1000);
+        const auto expected = square.to_layout<false>();
+        const int *originalData = square.get_data().data();
+
+        const auto converted = std::move(square).to_layout<false>();
+        REQUIRE(converted == expected);
+        REQUIRE(converted.get_data().data() == originalData);
+
+        auto rectangle = sequence_matrix<int, false>(3, 5, 1000);
+        const auto rectangleCopy = rectangle.to_layout<true>();
+        REQUIRE(std::move(rectangle).to_layout<true>() == rectangleCopy);
+    }
+}
+
+TEST_CASE("matrix views",
+          "[azgra::matrix]")
+{
+    SECTION("block, row, column and transposition share the data")
+    {
+        auto matrix = sequence_matrix<int, false>(6, 5, 1000);
+        const auto block = matrix.block(1, 2, 4, 3);
+        REQUIRE(block.rows() == 4);
+        REQUIRE(block.cols() == 3);
+        for (size_t row = 0; row < 4; ++row)
+        {
+            for (size_t col = 0; col < 3; ++col)
+            {
+                REQUIRE(&block.at(row, col) == &matrix.at(row + 1, col + 2));
+            }
+        }
+
+        const auto transposed = matrix.transpose_view();
+        REQUIRE(transposed.rows() == 5);
+        REQUIRE(transposed.cols() == 6);
+        REQUIRE(&transposed.at(4, 2) == &matrix.at(2, 4));
+        REQUIRE(&block.transpose().at(2, 3) == &matrix.at(4, 4));
+
+        REQUIRE(&matrix.row_view(3).at(0, 4) == &matrix.at(3, 4));
+        REQUIRE(&matrix.col_view(1).at(5, 0) == &matrix.at(5, 1));
+
+        block.at(0, 0) = 1234;
+        REQUIRE(matrix.at(1, 2) == 1234);
+    }
+
+    SECTION("row and column iterators")
+    {
+        const auto matrix = sequence_matrix<int, true>(5, 7, 1000);
+        const auto block = matrix.block(1, 2, 3, 4);
+
+        std::vector<int> blockRow(block.row_cbegin(1), block.row_cend(1));
+        REQUIRE(blockRow == std::vector<int>{matrix.at(2, 2), matrix.at(2, 3), matrix.at(2, 4), matrix.at(2, 5)});
+
+        std::vector<int> blockCol(block.col_cbegin(3), block.col_cend(3));
+        REQUIRE(blockCol == std::vector<int>{matrix.at(1, 5), matrix.at(2, 5), matrix.at(3, 5)});
+
+        const auto transposed = matrix.transpose_view();
+        std::vector<int> transposedRow(transposed.row_cbegin(6), transposed.row_cend(6));
+        REQUIRE(transposedRow == matrix.col(6));
+
+        azgra::Matrix<int> target(3, 4, 0);
+        target.row(2, block.row_cbegin(0), block.row_cend(0));
+        REQUIRE(target.row(2) == std::vector<int>(block.row_cbegin(0), block.row_cend(0)));
+
+        auto mutableMatrix = sequence_matrix<int, false>(4, 4, 1000);
+        const auto mutableRow = mutableMatrix.block(1, 1, 2, 3).row_view(1);
+        std::fill(mutableRow.row_begin(0), mutableRow.row_end(0), -1);
+        REQUIRE(mutableMatrix.row(2) == std::vector<int>{mutableMatrix.at(2, 0), -1, -1, -1});
+        std::fill(mutableMatrix.col_view(0).col_begin(0), mutableMatrix.col_view(0).col_end(0), 9);
+        REQUIRE(mutableMatrix.col(0) == std::vector<int>(4, 9));
+    }
+
+    SECTION("element-wise expressions")
+    {
+        const auto a = sequence_matrix<int, true>(40, 30, 101);
+        const auto b = sequence_matrix<int, false>(30, 40, 97);
+
+        const azgra::Matrix<int> mixed = a + b.transpose_view() * 2;
+        const azgra::Matrix<int, false> mixedByCols = a - b.transpose_view();
+        const azgra::Matrix<int> blockSum = a.block(5, 10, 20, 20) + a.block(10, 5, 20, 20);
+        for (size_t row = 0; row < 40; ++row)
+        {
+            for (size_t col = 0; col < 30; ++col)
+            {
+                REQUIRE(mixed.at(row, col) == a.at(row, col) + (b.at(col, row) * 2));
+                REQUIRE(mixedByCols.at(row, col) == a.at(row, col) - b.at(col, row));
+            }
+        }
+        for (size_t row = 0; row < 20; ++row)
+        {
+            for (size_t col = 0; col < 20; ++col)
+            {
+                REQUIRE(blockSum.at(row, col) == a.at(row + 5, col + 10) + a.at(row + 10, col + 5));
+            }
+        }
+
+        // Mixed storage order works without views as well.
+        const azgra::Matrix<int, false> transposedByCols = b.transpose();
+        const azgra::Matrix<int> mixedOrder = a + transposedByCols;
+        REQUIRE(mixedOrder == azgra::Matrix<int>(a + a.block(0, 0, 40, 30) - a + b.transpose_view()));
+    }
+
+    SECTION("assignment into views")
+    {
+        auto matrix = sequence_matrix<int, true>(8, 8, 1000);
+        const auto original = azgra::Matrix<int>(matrix.view());
+        const auto other = sequence_matrix<int, false>(3, 4, 17);
+
+        const auto block = matrix.block(2, 3, 3, 4);
+        block = other * 10;
+        block += other;
+        block.transpose().row_view(0) -= other.col_view(0).transpose();
+        matrix.block(0, 0, 1, 8).fill(-5);
+
+        for (size_t row = 0; row < 8; ++row)
+        {
+            for (size_t col = 0; col < 8; ++col)
+            {
+                int expected = original.at(row, col);
+                if (row == 0)
+                {
+                    expected = -5;
+                }
+                else if (row >= 2 && row < 5 && col >= 3 && col < 7)
+                {
+                    expected = other.at(row - 2, col - 3) * ((col == 3) ? 10 : 11);
+                }
+                REQUIRE(matrix.at(row, col) == expected);
+            }
+        }
+
+        // Assigning transposed view of itself into the matrix goes through new storage.
+        auto square = sequence_matrix<int, true>(50, 50, 1000);
+        const auto expected = square.transpose();
+        square = square.transpose_view();
+        REQUIRE(square == expected);
+
+        // Non-linear expression not reading the matrix is evaluated into the existing storage.
+        const auto source = sequence_matrix<int, true>(50, 50, 7);
+        const int *storage = square.get_data().data();
+        square = source.transpose_view() * 2;
+        REQUIRE(square.get_data().data() == storage);
+        REQUIRE(square == azgra::Matrix<int>(source.transpose() * 2));
+
+        // Mixed expression reading the matrix still sees the original elements.
+        const azgra::Matrix<int> beforeMixed(square);
+        square = square + square.transpose_view();
+        REQUIRE(square == azgra::Matrix<int>(beforeMixed + beforeMixed.transpose()));
+    }
+
+    SECTION("multiply_accumulate on blocks")
+    {
+        const auto a = sequence_matrix<double, true>(40, 50, 11);
+        const auto b = sequence_matrix<double, false>(50, 30, 13);
+        const auto expected = naive_multiply<double, true>(a, b);
+
+        // C = A * B computed as sum of products of the K blocks.
+        azgra::Matrix<double> result(40, 30, 0.0);
+        azgra::multiply_accumulate(a.block(0, 0, 40, 20), b.block(0, 0, 20, 30), result.view());
+        azgra::multiply_accumulate(a.block(0, 20, 40, 30), b.block(20, 0, 30, 30), result.view());
+        REQUIRE(result == expected);
+
+        azgra::Matrix<double, false> transposedResult(30, 40, 0.0);
+        azgra::multiply_accumulate(b.transpose_view(), a.transpose_view(), transposedResult.view());
+        REQUIRE(same_elements(transposedResult, expected.transpose()));
+
+        std::vector<double> strided(40 * 30 * 4, 0.0);
+        const azgra::MatrixView<double> stridedView(strided.data(), 40, 30, 60, 2);
+        azgra::multiply_accumulate(a.view(), b.view(), stridedView);
+        REQUIRE(azgra::Matrix<double>(stridedView) == expected);
+    }
+}
+
+TEST_CASE("matrix storage allocators",
+          "[azgra::matrix]")
+{
+    SECTION("data is aligned for SIMD")
+    {
+        for (size_t size = 1; size < 40; size += 7)
+        {
+            const azgra::AlignedMatrix<float> matrix(size, size + 1, 1.0f);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(matrix.get_data().data()) % azgra::SimdAlignment == 0);
+
+            const azgra::Matrix<float, true, azgra::PoolAllocator<float>> pooled(size + 1, size, 1.0f);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(pooled.get_data().data()) % azgra::SimdAlignment == 0);
+
+            const azgra::Matrix<char, false, azgra::AlignedAllocator<char, 128>> wide(size, size);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(wide.get_data().data()) % 128 == 0);
+        }
+    }
+
+    SECTION("pool recycles buffers of the same size class")
+    {
+        using PooledMatrix = azgra::Matrix<double, true, azgra::PoolAllocator<double>>;
+        azgra::pool_release_thread_cache();
+        REQUIRE(azgra::pool_thread_cached_bytes() == 0);
+
+        const double *firstBuffer;
+        {
+            const PooledMatrix temporary(30, 30, 1.0);
+            firstBuffer = temporary.get_data().data();
+        }
+        REQUIRE(azgra::pool_thread_cached_bytes() >= 30 * 30 * sizeof(double));
+        {
+            // 29 x 31 doubles fall into the same power of two class.
+            const PooledMatrix temporary(29, 31, 2.0);
+            REQUIRE(temporary.get_data().data() == firstBuffer);
+            REQUIRE(azgra::pool_thread_cached_bytes() == 0);
+        }
+
+        const size_t originalLimit = azgra::get_pool_cache_limit();
+        azgra::pool_release_thread_cache();
+        azgra::set_pool_cache_limit(0);
+        {
+            const PooledMatrix temporary(30, 30, 1.0);
+        }
+        REQUIRE(azgra::pool_thread_cached_bytes() == 0);
+        azgra::set_pool_cache_limit(originalLimit);
+    }
+
+    SECTION("uninitialized construction")
+    {
+        azgra::Matrix<int> matrix(17, 13, azgra::MatrixUninitialized);
+        REQUIRE(matrix.rows() == 17);
+        REQUIRE(matrix.cols() == 13);
+        REQUIRE(matrix.get_data().size() == 17 * 13);
+        matrix = sequence_matrix<int, true>(17, 13, 100) * 2;
+        REQUIRE(matrix.at(16, 12) == (((16 * 7) + (12 * 3)) % 100 - 50) * 2);
+
+        const azgra::Matrix<std::string> strings(2, 3, azgra::MatrixUninitialized);
+        REQUIRE(strings.at(1, 2).empty());
+    }
+
+    SECTION("matrices with different allocators work together")
+    {
+        const auto a = sequence_matrix<float, true>(23, 19, 11);
+        azgra::Matrix<float, false, azgra::PoolAllocator<float>> b(19, 23, azgra::MatrixUninitialized);
+        b = a.transpose_view();
+        azgra::Matrix<float, true, std::allocator<float>> c(23, 19, 3.0f);
+
+        const azgra::Matrix<float> sum = a + c - b.transpose_view();
+        REQUIRE(sum == azgra::Matrix<float>(23, 19, 3.0f));
+
+        const auto product = b * a;
+        REQUIRE(product.get_data().size() == 19 * 19);
+        REQUIRE(same_elements(product, naive_multiply<float, true>(a.transpose(), a)));
+
+        std::vector<float> plain(6, 1.0f);
+        const float *plainData = plain.data();
+        const azgra::Matrix<float> moved(2, 3, plain);
+        REQUIRE(moved.get_data().data() == plainData);
+        const std::vector<float> &data = moved.get_data();
+        REQUIRE(data.size() == 6);
+
+        std::vector<float, azgra::AlignedAllocator<float>> aligned(6, 1.0f);
+        const float *alignedData = aligned.data();
+        const azgra::AlignedMatrix<float> alignedMoved(2, 3, aligned);
+        REQUIRE(alignedMoved.get_data().data() == alignedData);
+
+        std::vector<float> copySource(6, 2.0f);
+        const azgra::AlignedMatrix<float> copied(3, 2, copySource);
+        REQUIRE(copied == azgra::AlignedMatrix<float>(3, 2, 2.0f));
+        REQUIRE(copySource.empty());
+    }
+}
+
 // operator*=
 // row copy - row based
 //          - col based
@@ -0,0 +1,113 @@
+#include <catch2/catch.hpp>
+#include <azgra/collection/enumerable.h>
+#include "parallel_settings.h"
+#include <algorithm>
+#include <stdexcept>
+
+using azgra::collection::Enumerable;
+
+TEST_CASE("parallel enumerable matches sequential results",
+          "[azgra::collection::parallel_enumerable]")
+{
+    const ParallelSettings settings;
+
+    std::vector<int> data(10007);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int>((i * 7919) % 1000) - 500;
+    }
+    const Enumerable<int> numbers(data);
+    const auto isEven = [](const int x)
+    { return x % 2 == 0; };
+    const auto square = [](const int x)
+    { return static_cast<long>(x) * x; };
+
+    const auto sequential = numbers.where(isEven).select(square);
+    const auto parallel = numbers.as_parallel().where(isEven).select(square);
+    REQUIRE(parallel.is_ordered());
+    REQUIRE(parallel.to_vector() == sequential.to_vector());
+    REQUIRE(numbers.as_parallel().select(square).to_vector() == numbers.select(square).to_vector());
+    REQUIRE(parallel.count() == sequential.count());
+    REQUIRE(numbers.as_parallel().count(isEven) == numbers.count(isEven));
+    REQUIRE(numbers.as_parallel().sum() == numbers.sum());
+    REQUIRE(numbers.as_parallel().sum(square) == numbers.sum(square));
+    REQUIRE(numbers.as_parallel().average() == Approx(numbers.average()));
+    REQUIRE(numbers.as_parallel().min_max() == numbers.min_max());
+    REQUIRE(numbers.as_parallel().min() == -500);
+    REQUIRE(numbers.as_parallel().max() == 499);
+
+    REQUIRE(numbers.as_parallel().any([](const int x)
+                                      { return x == 499; }));
+    REQUIRE_FALSE(numbers.as_parallel().any([](const int x)
+                                            { return x > 499; }));
+    REQUIRE(numbers.as_parallel().all([](const int x)
+                                      { return x >= -500; }));
+    REQUIRE_FALSE(numbers.as_parallel().all([](const int x)
+                                            { return x < 499; }));
+
+    // Ordered distinct keeps the first occurrence order.
+    std::vector<int> firstOccurrences;
+    for (const int value : data)
+    {
+        if (std::find(firstOccurrences.begin(), firstOccurrences.end(), value) == firstOccurrences.end())
+        {
+            firstOccurrences.push_back(value);
+        }
+    }
+    REQUIRE(numbers.as_parallel().distinct().to_vector() == firstOccurrences);
+
+    // Unordered results contain the same items in any order.
+    std::vector<long> unordered = parallel.as_unordered().to_vector();
+    std::vector<long> expected = sequential.to_vector();
+    std::sort(unordered.begin(), unordered.end());
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(unordered == expected);
+
+    std::vector<int> unorderedDistinct = numbers.as_parallel().as_unordered().distinct().to_vector();
+    std::vector<int> expectedDistinct = numbers.distinct().to_vector();
+    std::sort(unorderedDistinct.begin(), unorderedDistinct.end());
+    std::sort(expectedDistinct.begin(), expectedDistinct.end());
+    REQUIRE(unorderedDistinct == expectedDistinct);
+
+    // Queries, which can't be split, are materialized first.
+    REQUIRE(numbers.take(100).as_parallel().where(isEven).to_vector() == numbers.take(100).where(isEven).to_vector());
+    REQUIRE(Enumerable<int>::range(0, 100000).as_parallel().sum() == 4999950000.0);
+
+    const Enumerable<int> empty;
+    REQUIRE(empty.as_parallel().count() == 0);
+    REQUIRE(empty.as_parallel().to_vector().empty());
+    REQUIRE_FALSE(empty.as_parallel().any());
+    REQUIRE_THROWS_AS(empty.as_parallel().min_max(), azgra::collection::EnumerableError);
+}
+
+TEST_CASE("parallel enumerable rethrows predicate exceptions",
+          "[azgra::collection::parallel_enumerable]")
+{
+    const ParallelSettings settings;
+
+    std::vector<int> data(10007);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int>(i);
+    }
+    const Enumerable<int> numbers(data);
+    const auto failsAtEnd = [](const int x)
+    {
+        if (x == 10000)
+        {
+            throw std::invalid_argument("predicate failed");
+        }
+        return x % 3 == 0;
+    };
+
+    REQUIRE_THROWS_AS(numbers.as_parallel().where(failsAtEnd).to_vector(), std::invalid_argument);
+    REQUIRE_THROWS_AS(numbers.as_parallel().as_unordered().where(failsAtEnd).to_vector(), std::invalid_argument);
+    REQUIRE_THROWS_AS(numbers.as_parallel().count(failsAtEnd), std::invalid_argument);
+    REQUIRE_THROWS_AS(numbers.as_parallel().any([&](const int x)
+                                                 { return failsAtEnd(x) && x < 0; }), std::invalid_argument);
+    REQUIRE_THROWS_AS(numbers.as_parallel().as_unordered().where(failsAtEnd).distinct(), std::invalid_argument);
+
+    // Query is usable after the failure.
+    REQUIRE(numbers.as_parallel().count([](const int x)
+                                        { return x % 3 == 0; }) == 3336);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <azgra/utilities/parallel.h>
+
+// Force the parallel execution of small inputs for the lifetime of the object. Original settings
+// are restored even when the test fails and throws.
+struct ParallelSettings
+{
+    size_t threshold = azgra::get_parallel_threshold();
+    size_t threadCount = azgra::ThreadPool::global().thread_count();
+
+    explicit ParallelSettings(const size_t parallelThreadCount = 4)
+    {
+        azgra::set_parallel_threshold(1);
+        azgra::ThreadPool::global().set_thread_count(parallelThreadCount);
+    }
+
+    ~ParallelSettings()
+    {
+        azgra::set_parallel_threshold(threshold);
+        azgra::ThreadPool::global().set_thread_count(threadCount);
+    }
+
+    ParallelSettings(const ParallelSettings &) = delete;
+
+    ParallelSettings &operator=(const ParallelSettings &) = delete;
+};
@@ -0,0 +1,90 @@
+#include <catch2/catch.hpp>
+#include <azgra/utilities/parallel.h>
+#include "parallel_settings.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+TEST_CASE("thread pool rethrows task exception on the submitting thread",
+          "[azgra::ThreadPool]")
+{
+    const ParallelSettings settings;
+    azgra::ThreadPool &pool = azgra::ThreadPool::global();
+
+    for (const size_t throwingTask : {size_t(0), size_t(7), size_t(999)})
+    {
+        std::atomic<size_t> executed{0};
+        REQUIRE_THROWS_WITH(pool.run(1000, [&](const size_t task)
+        {
+            executed.fetch_add(1);
+            if (task == throwingTask)
+            {
+                throw std::runtime_error("task failed");
+            }
+        }), "task failed");
+        REQUIRE(executed.load() >= 1);
+        REQUIRE(executed.load() <= 1000);
+    }
+
+    // Pool is usable after the failure and tasks submitted from this thread run in parallel again.
+    std::atomic<size_t> sum{0};
+    pool.run(100, [&](const size_t task)
+    {
+        sum.fetch_add(task);
+    });
+    REQUIRE(sum.load() == 4950);
+
+    // Nested run executes sequentially and propagates the exception through the outer run.
+    REQUIRE_THROWS_AS(pool.run(4, [&](const size_t)
+    {
+        pool.run(4, [](const size_t task)
+        {
+            if (task == 2)
+            {
+                throw std::logic_error("nested");
+            }
+        });
+    }), std::logic_error);
+
+    std::vector<int> values(10000, 1);
+    REQUIRE_THROWS_AS(azgra::parallel_for<int>(values.size(), azgra::ExecutionPolicy_Parallel,
+                                               [&](const size_t from, const size_t)
+                                               {
+                                                   if (from > 0)
+                                                   {
+                                                       throw std::out_of_range("chunk");
+                                                   }
+                                               }), std::out_of_range);
+}
+
+TEST_CASE("thread pool can be resized while other threads submit tasks",
+          "[azgra::ThreadPool]")
+{
+    const ParallelSettings settings;
+    azgra::ThreadPool &pool = azgra::ThreadPool::global();
+
+    std::atomic<bool> resizing{true};
+    std::thread resizer([&]()
+    {
+        for (size_t i = 0; i < 50; ++i)
+        {
+            pool.set_thread_count((i % 2 == 0) ? 1 : 3);
+        }
+        resizing.store(false);
+    });
+
+    size_t submissions = 0;
+    while (resizing.load() || submissions < 10)
+    {
+        const size_t threadCount = pool.thread_count();
+        REQUIRE((threadCount >= 1 && threadCount <= 4));
+        std::atomic<size_t> sum{0};
+        pool.run(64, [&](const size_t task)
+        {
+            sum.fetch_add(task);
+        });
+        REQUIRE(sum.load() == 2016);
+        ++submissions;
+    }
+    resizer.join();
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch.hpp>
+#include <azgra/collection/set_utilities.h>
+#include "parallel_settings.h"
+#include <atomic>
+
+using namespace azgra::collection;
+
+TEST_CASE("combinations are lexicographic and reuse the buffer",
+          "[azgra::collection::set_utilities]")
+{
+    const std::vector<int> pool{1, 2, 3, 4, 5};
+    const std::vector<std::vector<int>> expected{{1, 2, 3}, {1, 2, 4}, {1, 2, 5}, {1, 3, 4}, {1, 3, 5},
+                                                 {1, 4, 5}, {2, 3, 4}, {2, 3, 5}, {2, 4, 5}, {3, 4, 5}};
+    REQUIRE(generate_subsets_of_size(pool, 3) == expected);
+    REQUIRE(enumerate_combinations(pool, 3).to_vector() == expected);
+    REQUIRE(enumerate_combinations(pool, 3).count() == 10);
+    REQUIRE(binomial_coefficient(50, 25) == 126410606437752ull);
+    // Results close to the u64 limit, the naive product of the running result overflows for them.
+    REQUIRE(binomial_coefficient(64, 32) == 1832624140942590534ull);
+    REQUIRE(binomial_coefficient(67, 33) == 14226520737620288370ull);
+    REQUIRE(binomial_coefficient(67, 34) == 14226520737620288370ull);
+    REQUIRE(CombinationRange<int>(std::vector<int>(64), 32).size() == 1832624140942590534ull);
+
+    auto cursor = CombinationRange<int>(pool, 2).cursor();
+    REQUIRE(cursor.move_next());
+    const int *buffer = cursor.current().data();
+    size_t count = 1;
+    while (cursor.move_next())
+    {
+        REQUIRE(cursor.current().data() == buffer);
+        REQUIRE(cursor.current()[0] == pool[cursor.indices()[0]]);
+        ++count;
+    }
+    REQUIRE(count == 10);
+
+    REQUIRE(generate_subsets_of_size(pool, 0) == std::vector<std::vector<int>>{{}});
+    REQUIRE(generate_subsets_of_size(pool, 5) == std::vector<std::vector<int>>{pool});
+    REQUIRE(enumerate_combinations(pool, 6).count() == 0);
+}
+
+TEST_CASE("power set in gray code order",
+          "[azgra::collection::set_utilities]")
+{
+    const std::vector<char> pool{'a', 'b', 'c', 'd'};
+    REQUIRE(generate_powerset(pool).size() == 16);
+
+    std::vector<azgra::u64> masks;
+    for_each_subset(pool, [&](const std::vector<char> &subset, const azgra::u64 mask)
+    {
+        std::vector<char> expected;
+        for (size_t i = 0; i < pool.size(); ++i)
+        {
+            if (mask & (1ull << i))
+            {
+                expected.push_back(pool[i]);
+            }
+        }
+        REQUIRE(subset == expected);
+        if (!masks.empty())
+        {
+            REQUIRE(__builtin_popcountll(masks.back() ^ mask) == 1);
+        }
+        masks.push_back(mask);
+    });
+    REQUIRE(masks.size() == 16);
+    std::sort(masks.begin(), masks.end());
+    for (size_t i = 0; i < masks.size(); ++i)
+    {
+        REQUIRE(masks[i] == i);
+    }
+
+    auto lazySubsets = enumerate_power_set(pool).to_vector();
+    auto eagerSubsets = generate_powerset(pool);
+    std::sort(lazySubsets.begin(), lazySubsets.end());
+    std::sort(eagerSubsets.begin(), eagerSubsets.end());
+    REQUIRE(lazySubsets == eagerSubsets);
+}
+
+TEST_CASE("parallel subset enumeration visits every subset once",
+          "[azgra::collection::set_utilities]")
+{
+    const ParallelSettings settings;
+
+    constexpr size_t n = 14;
+    std::vector<int> pool(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        pool[i] = static_cast<int>(i + 1);
+    }
+
+    std::vector<std::atomic<int>> visits(1ull << n);
+    std::atomic<long long> sumOfSums{0};
+    for_each_subset(pool, [&](const std::vector<int> &subset, const azgra::u64 mask)
+    {
+        ++visits[mask];
+        long long sum = 0;
+        for (const int item : subset)
+        {
+            sum += item;
+        }
+        sumOfSums += sum;
+    }, azgra::ExecutionPolicy_Parallel);
+    // Every item is in half of the subsets.
+    REQUIRE(sumOfSums.load() == (1ll << (n - 1)) * static_cast<long long>(n * (n + 1) / 2));
+    REQUIRE(std::all_of(visits.begin(), visits.end(), [](const std::atomic<int> &v)
+    { return v.load() == 1; }));
+
+    std::atomic<azgra::u64> maskXor{0};
+    std::atomic<size_t> maskCount{0};
+    for_each_subset_mask(n, [&](const azgra::u64 mask)
+    {
+        maskXor ^= mask;
+        ++maskCount;
+    }, azgra::ExecutionPolicy_Parallel);
+    REQUIRE(maskCount.load() == (1ull << n));
+    REQUIRE(maskXor.load() == 0);
+
+    REQUIRE(enumerate_power_set(pool).as_parallel().count([](const std::vector<int> &subset)
+                                                          { return subset.size() == 3; }) == binomial_coefficient(n, 3));
+}
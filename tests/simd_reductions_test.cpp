@@ -0,0 +1,118 @@
+#include <catch2/catch.hpp>
+#include <azgra/collection/enumerable.h>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+using namespace azgra;
+using namespace azgra::collection;
+
+template<typename T>
+static std::vector<T> random_values(const size_t count, std::mt19937 &generator)
+{
+    std::vector<T> values(count);
+    std::uniform_int_distribution<int> distribution(-1000, 1000);
+    for (T &value : values)
+    {
+        value = static_cast<T>(distribution(generator));
+    }
+    return values;
+}
+
+template<typename T>
+static void check_reductions(std::mt19937 &generator)
+{
+    // Sizes cover empty input, tails of every length and multiple unrolled iterations.
+    for (size_t count = 0; count < 150; ++count)
+    {
+        const std::vector<T> values = random_values<T>(count, generator);
+        REQUIRE(sum(values.begin(), values.end(), T{}) == std::accumulate(values.begin(), values.end(), T{}));
+        REQUIRE(azgra::collection::count(values.begin(), values.end(), static_cast<T>(7)) ==
+                static_cast<size_t>(std::count(values.begin(), values.end(), static_cast<T>(7))));
+        const T needle = (count > 0) ? values[count - 1] : T{};
+        REQUIRE(contains(values.begin(), values.end(), needle) == (count > 0));
+        REQUIRE_FALSE(contains(values.data(), values.data() + count, static_cast<T>(5000)));
+        if (count > 0)
+        {
+            const auto expected = std::minmax_element(values.begin(), values.end());
+            REQUIRE(min_max(values.begin(), values.end()) == std::make_pair(*expected.first, *expected.second));
+            REQUIRE(azgra::collection::min(values.cbegin(), values.cend()) == *expected.first);
+            REQUIRE(azgra::collection::max(values.data(), values.data() + count) == *expected.second);
+        }
+    }
+}
+
+TEST_CASE("simd reductions match generic algorithms",
+          "[azgra::collection::simd_reductions]")
+{
+    std::mt19937 generator(7);
+    INFO("kernels: " << simd_reduction_kernel_name());
+    check_reductions<i32>(generator);
+    check_reductions<i64>(generator);
+    // Small integral values are summed exactly also in floating point.
+    check_reductions<f32>(generator);
+    check_reductions<f64>(generator);
+
+    const std::vector<i64> extremes = {5, std::numeric_limits<i64>::max(), -3, std::numeric_limits<i64>::min(), 0, 1, 2, 3};
+    REQUIRE(min_max(extremes.begin(), extremes.end()) ==
+            std::make_pair(std::numeric_limits<i64>::min(), std::numeric_limits<i64>::max()));
+
+    const Enumerable<f32> enumerable(random_values<f32>(1000, generator));
+    REQUIRE(enumerable.min_max() == enumerable.where([](const f32)
+                                                     { return true; }).min_max());
+    REQUIRE(enumerable.contains(enumerable.last()));
+}
+
+TEST_CASE("float reductions keep the sequential semantics",
+          "[azgra::collection::simd_reductions]")
+{
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<f32> distribution(-1.0f, 1.0f);
+    std::vector<f32> values(1000);
+    for (f32 &value : values)
+    {
+        value = distribution(generator);
+    }
+    // Sum is bit exact with the sequential summation order.
+    REQUIRE(sum(values.begin(), values.end(), 0.5f) == std::accumulate(values.begin(), values.end(), 0.5f));
+
+    // Signed zeros and NaN are handled as by the std algorithms.
+    std::vector<f64> zeros(100, 0.0);
+    zeros[3] = -0.0;
+    const auto expectedZeros = std::minmax_element(zeros.begin(), zeros.end());
+    REQUIRE(std::signbit(min_max(zeros.begin(), zeros.end()).first) == std::signbit(*expectedZeros.first));
+    REQUIRE(std::signbit(min_max(zeros.begin(), zeros.end()).second) == std::signbit(*expectedZeros.second));
+    REQUIRE(std::signbit(azgra::collection::min(zeros.begin(), zeros.end())) ==
+            std::signbit(*std::min_element(zeros.begin(), zeros.end())));
+
+    std::vector<f64> withNaN(100);
+    std::iota(withNaN.begin(), withNaN.end(), -50.0);
+    withNaN[40] = std::numeric_limits<f64>::quiet_NaN();
+    const auto expectedNaN = std::minmax_element(withNaN.begin(), withNaN.end());
+    const auto actualNaN = min_max(withNaN.begin(), withNaN.end());
+    REQUIRE(std::isnan(actualNaN.first) == std::isnan(*expectedNaN.first));
+    REQUIRE((std::isnan(actualNaN.first) || actualNaN.first == *expectedNaN.first));
+    REQUIRE(std::isnan(actualNaN.second) == std::isnan(*expectedNaN.second));
+    REQUIRE((std::isnan(actualNaN.second) || actualNaN.second == *expectedNaN.second));
+}
+
+TEST_CASE("compensated float summation",
+          "[azgra::collection::simd_reductions]")
+{
+    // One large value followed by many small values, which are lost by the naive summation.
+    std::vector<f32> values(1 << 20, 1e-4f);
+    values[0] = 1e4f;
+    const double exact = 1e4 + (static_cast<double>(values.size() - 1) * static_cast<double>(1e-4f));
+
+    const double fastError = std::abs(sum(values.begin(), values.end(), SummationMode_Fast) - exact);
+    const double pairwiseError = std::abs(sum(values.begin(), values.end(), SummationMode_Pairwise) - exact);
+    const double kahanError = std::abs(sum(values.begin(), values.end(), SummationMode_Kahan) - exact);
+    REQUIRE(pairwiseError < fastError);
+    REQUIRE(kahanError < fastError);
+    REQUIRE(kahanError < 1e-2);
+    REQUIRE(pairwiseError < 1e-1);
+
+    const std::vector<f64> doubles = {1e100, 1.0, -1e100, 1.0};
+    REQUIRE(sum(doubles.begin(), doubles.end(), SummationMode_Kahan) == 2.0);
+    REQUIRE(sum(doubles.begin(), doubles.begin(), SummationMode_Pairwise) == 0.0);
+}
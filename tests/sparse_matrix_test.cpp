@@ -0,0 +1,129 @@
+#include <catch2/catch.hpp>
+#include <azgra/sparse_matrix.h>
+#include "parallel_settings.h"
+
+// Dense matrix with roughly one non-zero element out of five.
+template<typename T, bool RowBased>
+static azgra::Matrix<T, RowBased> sparse_dense_matrix(const size_t rows, const size_t cols, const size_t seed)
+{
+    azgra::Matrix<T, RowBased> matrix(rows, cols);
+    for (size_t row = 0; row < rows; ++row)
+    {
+        for (size_t col = 0; col < cols; ++col)
+        {
+            const size_t hash = (row * 31) + (col * 17) + seed;
+            if (hash % 5 == 0)
+            {
+                matrix.at(row, col) = static_cast<T>(static_cast<int>(hash % 7) - 3 + ((hash % 7 == 3) ? 1 : 0));
+            }
+        }
+    }
+    return matrix;
+}
+
+template<typename T, bool RowBased>
+static void check_sparse_dense_kernels(const size_t rows, const size_t cols, const size_t n,
+                                       const azgra::ExecutionPolicy policy)
+{
+    const auto dense = sparse_dense_matrix<T, RowBased>(rows, cols, 3);
+    const azgra::SparseMatrix<T, RowBased> sparse(dense, policy);
+    REQUIRE(sparse.to_dense(policy) == dense);
+
+    std::vector<T> x(cols);
+    for (size_t i = 0; i < cols; ++i)
+    {
+        x[i] = static_cast<T>(static_cast<int>(i % 9) - 4);
+    }
+    std::vector<T> expectedY(rows, T{});
+    for (size_t row = 0; row < rows; ++row)
+    {
+        for (size_t col = 0; col < cols; ++col)
+        {
+            expectedY[row] += dense.at(row, col) * x[col];
+        }
+    }
+    REQUIRE(sparse.multiply(x, policy) == expectedY);
+
+    const auto rhs = sparse_dense_matrix<T, true>(cols, n, 11);
+    const auto rhsByCols = rhs.template to_layout<false>();
+    const auto expected = dense * rhs;
+    REQUIRE(sparse.multiply(rhs, policy) == expected);
+    REQUIRE(sparse.multiply(rhsByCols, policy) == expected);
+
+    const auto other = sparse_dense_matrix<T, RowBased>(rows, cols, 4);
+    const azgra::SparseMatrix<T, RowBased> otherSparse(other);
+    REQUIRE(sparse.add(otherSparse, policy).to_dense() == azgra::Matrix<T, RowBased>(dense + other));
+    REQUIRE(sparse.subtract(otherSparse, policy).to_dense() == azgra::Matrix<T, RowBased>(dense - other));
+}
+
+TEST_CASE("sparse matrix conversions",
+          "[azgra::sparse_matrix]")
+{
+    const azgra::Matrix<int> dense(3, 4, {0, 5, 0, 0,
+                                          1, 0, 0, 2,
+                                          0, 0, 0, 0});
+    const azgra::CsrMatrix<int> csr(dense);
+    REQUIRE(csr.rows() == 3);
+    REQUIRE(csr.cols() == 4);
+    REQUIRE(csr.non_zero_count() == 3);
+    REQUIRE(csr.get_offsets() == std::vector<size_t>{0, 1, 3, 3});
+    REQUIRE(csr.get_indices() == std::vector<azgra::u32>{1, 0, 3});
+    REQUIRE(csr.get_values() == std::vector<int>{5, 1, 2});
+    REQUIRE(csr.at(0, 1) == 5);
+    REQUIRE(csr.at(1, 3) == 2);
+    REQUIRE(csr.at(2, 2) == 0);
+    REQUIRE(csr.to_dense() == dense);
+
+    const azgra::CscMatrix<int> csc(dense.to_layout<false>());
+    REQUIRE(csc.get_offsets() == std::vector<size_t>{0, 1, 2, 2, 3});
+    REQUIRE(csc.get_indices() == std::vector<azgra::u32>{1, 0, 1});
+    REQUIRE(csc.to_dense() == dense.to_layout<false>());
+
+    const auto transposed = csr.transpose();
+    REQUIRE(transposed.rows() == 4);
+    REQUIRE(transposed.cols() == 3);
+    REQUIRE(transposed.at(3, 1) == 2);
+    REQUIRE(transposed.to_dense() == dense.transpose().to_layout<false>());
+
+    const azgra::SparseMatrix<int, true, azgra::u16> smallIndices(dense);
+    REQUIRE(smallIndices.to_dense() == dense);
+
+    const auto fromTriplets = azgra::CsrMatrix<int>::from_triplets(3, 4, {{1, 3, 1},
+                                                                          {0, 1, 5},
+                                                                          {1, 0, 1},
+                                                                          {1, 3, 1},
+                                                                          {2, 2, 4},
+                                                                          {2, 2, -4}});
+    REQUIRE(fromTriplets == csr);
+    REQUIRE(azgra::CscMatrix<int>::from_triplets(3, 4, {{1, 3, 2}, {1, 0, 1}, {0, 1, 5}}) == csc);
+}
+
+TEST_CASE("sparse matrix kernels",
+          "[azgra::sparse_matrix]")
+{
+    SECTION("sequential")
+    {
+        check_sparse_dense_kernels<int, true>(37, 23, 9, azgra::ExecutionPolicy_Sequential);
+        check_sparse_dense_kernels<int, false>(37, 23, 9, azgra::ExecutionPolicy_Sequential);
+        check_sparse_dense_kernels<double, true>(5, 64, 1, azgra::ExecutionPolicy_Sequential);
+        check_sparse_dense_kernels<double, false>(64, 5, 3, azgra::ExecutionPolicy_Sequential);
+    }
+
+    SECTION("parallel")
+    {
+        const ParallelSettings settings;
+
+        check_sparse_dense_kernels<int, true>(131, 97, 17, azgra::ExecutionPolicy_Parallel);
+        check_sparse_dense_kernels<int, false>(131, 97, 17, azgra::ExecutionPolicy_Parallel);
+    }
+
+    SECTION("sum to zero is not stored")
+    {
+        const auto dense = sparse_dense_matrix<int, true>(10, 10, 0);
+        const azgra::CsrMatrix<int> sparse(dense);
+        const auto zero = sparse - sparse;
+        REQUIRE(zero.non_zero_count() == 0);
+        REQUIRE(zero == azgra::CsrMatrix<int>(10, 10));
+        REQUIRE((sparse + zero) == sparse);
+    }
+}
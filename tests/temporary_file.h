@@ -0,0 +1,10 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+// Path of the file with the given name in the temporary directory, shared by the tests writing files.
+inline std::string temporary_file(const char *name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
@@ -0,0 +1,196 @@
+#include <catch2/catch.hpp>
+#include <azgra/collection/vector_utilities.h>
+#include <azgra/collection/vector_linq.h>
+#include "parallel_settings.h"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+
+using namespace azgra::collection;
+
+TEST_CASE("vector_insert_at copies trivial and non-trivial elements",
+          "[azgra::collection::vector_utilities]")
+{
+    std::vector<int> target(10, 0);
+    const std::vector<int> source = range<int>(10);
+    vector_insert_at(target, source, 2, 5, 4);
+    REQUIRE(target == std::vector<int>{0, 0, 5, 6, 7, 8, 0, 0, 0, 0});
+    vector_insert_at(target, source, 0, 0, 0);
+
+    std::vector<std::string> strings(3, "x");
+    vector_insert_at(strings, std::vector<std::string>{"a", "b", "c"}, 1, 1, 2);
+    REQUIRE(strings == std::vector<std::string>{"x", "b", "c"});
+
+    // Overlapping ranges of the same vector, in both directions.
+    std::vector<int> self = range<int>(8);
+    vector_insert_at(self, self, 2, 0, 5);
+    REQUIRE(self == std::vector<int>{0, 1, 0, 1, 2, 3, 4, 7});
+    vector_insert_at(self, self, 0, 3, 5);
+    REQUIRE(self == std::vector<int>{1, 2, 3, 4, 7, 3, 4, 7});
+
+    std::vector<std::string> selfStrings{"a", "b", "c", "d"};
+    vector_insert_at(selfStrings, selfStrings, 1, 0, 3);
+    REQUIRE(selfStrings == std::vector<std::string>{"a", "a", "b", "c"});
+    vector_insert_at(selfStrings, selfStrings, 0, 1, 3);
+    REQUIRE(selfStrings == std::vector<std::string>{"a", "b", "c", "c"});
+
+    std::vector<bool> bits(5, false);
+    vector_insert_at(bits, std::vector<bool>{true, false, true}, 1, 0, 3);
+    REQUIRE(bits == std::vector<bool>{false, true, false, true, false});
+    vector_insert_at(bits, bits, 2, 1, 3);
+    REQUIRE(bits == std::vector<bool>{false, true, true, false, true});
+}
+
+TEST_CASE("parallel element-wise operations",
+          "[azgra::collection::vector_utilities]")
+{
+    const ParallelSettings settings;
+    const size_t count = 100003;
+    std::vector<int> a(count);
+    std::vector<int> b(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        a[i] = static_cast<int>(i);
+        b[i] = static_cast<int>(3 * i);
+    }
+
+    const auto diff = diff_vectors<int, long>(a, b, azgra::ExecutionPolicy_Parallel);
+    REQUIRE(diff == diff_vectors<int, long>(a, b));
+    REQUIRE(diff[count - 1] == 2 * static_cast<long>(count - 1));
+
+    std::vector<int> sum = a;
+    add_together(sum, b, azgra::ExecutionPolicy_Parallel);
+    REQUIRE(sum[12345] == 4 * 12345);
+    REQUIRE(equals(div_by(sum, 4), a));
+
+    std::vector<double> values(8, 3.0);
+    REQUIRE(div_by(values, 2)[7] == 1.5);
+    // Floats are divided, multiplication by the reciprocal would round 3.0 / 10 differently.
+    std::vector<double> tenths{3.0};
+    REQUIRE(div_by(tenths, 10)[0] == 3.0 / 10.0);
+
+    a[70000] = -1;
+    a[90000] = -1;
+    REQUIRE(get_index(a, -1, azgra::ExecutionPolicy_Parallel) == 70000);
+    REQUIRE(get_index(a, -1) == 70000);
+    REQUIRE(get_index(a, -2, azgra::ExecutionPolicy_Parallel) == -1);
+    REQUIRE(get_index(std::vector<int>(), 0) == -1);
+}
+
+TEST_CASE("sort_vector sorts numbers and custom types",
+          "[azgra::collection::vector_utilities]")
+{
+    const ParallelSettings settings;
+    std::mt19937 random(7);
+
+    std::vector<int> integers(50000);
+    std::uniform_int_distribution<int> intDistribution(-1000000, 1000000);
+    for (int &value : integers)
+    {
+        value = intDistribution(random);
+    }
+    std::vector<int> expectedIntegers = integers;
+    std::sort(expectedIntegers.begin(), expectedIntegers.end());
+    sort_vector(integers);
+    REQUIRE(integers == expectedIntegers);
+
+    std::vector<double> doubles(20000);
+    std::normal_distribution<double> doubleDistribution(0.0, 100.0);
+    for (double &value : doubles)
+    {
+        value = doubleDistribution(random);
+    }
+    std::vector<double> expectedDoubles = doubles;
+    std::sort(expectedDoubles.begin(), expectedDoubles.end());
+    std::vector<double> sequentialDoubles = doubles;
+    sort_vector(doubles);
+    REQUIRE(doubles == expectedDoubles);
+    sort_vector(sequentialDoubles, azgra::ExecutionPolicy_Sequential);
+    REQUIRE(sequentialDoubles == expectedDoubles);
+
+    // Short vectors are sorted by the comparison, in the same order of signed zeros and NaN as the radix sort.
+    for (const size_t size : {size_t(10), RadixSortThreshold})
+    {
+        std::vector<double> special(size, 1.0);
+        special[0] = std::numeric_limits<double>::quiet_NaN();
+        special[1] = -0.0;
+        special[2] = 0.0;
+        special[3] = -1.0;
+        special[4] = -0.0;
+        sort_vector(special);
+        REQUIRE(special[0] == -1.0);
+        REQUIRE(std::signbit(special[1]));
+        REQUIRE_FALSE(std::signbit(special[2]));
+        REQUIRE(std::signbit(special[3]));
+        REQUIRE(std::isnan(special.back()));
+    }
+
+    std::vector<float> floats{3.5f, -0.5f, -100.0f, 0.0f, 42.0f};
+    radix_sort(floats, true);
+    REQUIRE(floats == std::vector<float>{42.0f, 3.5f, 0.0f, -0.5f, -100.0f});
+
+    std::vector<std::string> strings;
+    for (int i = 0; i < 5000; ++i)
+    {
+        strings.push_back(std::to_string(intDistribution(random)));
+    }
+    std::vector<std::string> expectedStrings = strings;
+    std::sort(expectedStrings.begin(), expectedStrings.end(), std::greater<>());
+    sort_vector(strings, std::greater<>(), azgra::ExecutionPolicy_Parallel);
+    REQUIRE(strings == expectedStrings);
+}
+
+TEST_CASE("lower_bound_batch matches std::lower_bound",
+          "[azgra::collection::vector_utilities]")
+{
+    const ParallelSettings settings;
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int> distribution(0, 5000);
+    std::vector<int> sorted(3001);
+    for (int &value : sorted)
+    {
+        value = distribution(random);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<int> queries(20000);
+    for (int &query : queries)
+    {
+        query = distribution(random) - 10;
+    }
+    queries.push_back(6000);
+
+    const auto indices = lower_bound_batch(sorted, queries, azgra::ExecutionPolicy_Parallel);
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        REQUIRE(indices[i] == static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), queries[i]) - sorted.begin()));
+    }
+    REQUIRE(lower_bound_batch(std::vector<int>(), std::vector<int>{1}) == std::vector<size_t>{0});
+    REQUIRE(lower_bound_index(sorted.data(), 1, sorted[0]) == 0);
+}
+
+TEST_CASE("prefix sums",
+          "[azgra::collection::vector_utilities]")
+{
+    const ParallelSettings settings;
+    std::vector<long> values(100001);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<long>(i % 17) - 8;
+    }
+    std::vector<long> expected(values.size());
+    std::partial_sum(values.begin(), values.end(), expected.begin());
+
+    std::vector<long> inclusive = values;
+    REQUIRE(inclusive_prefix_sum(inclusive, azgra::ExecutionPolicy_Parallel) == expected.back());
+    REQUIRE(inclusive == expected);
+
+    std::vector<long> exclusive = values;
+    REQUIRE(exclusive_prefix_sum(exclusive, azgra::ExecutionPolicy_Parallel) == expected.back());
+    REQUIRE(exclusive[0] == 0);
+    REQUIRE(std::equal(exclusive.begin() + 1, exclusive.end(), expected.begin()));
+
+    std::vector<size_t> counts{2, 0, 3, 1};
+    REQUIRE(exclusive_prefix_sum(counts) == 6);
+    REQUIRE(counts == std::vector<size_t>{0, 2, 2, 5});
+}
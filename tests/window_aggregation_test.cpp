@@ -0,0 +1,71 @@
+#include <catch2/catch.hpp>
+#include <azgra/collection/enumerable.h>
+#include <random>
+
+using azgra::collection::Enumerable;
+using azgra::collection::WindowMode_Tumbling;
+
+static std::vector<int> make_series(const size_t count)
+{
+    std::mt19937 random(3);
+    std::uniform_int_distribution<int> distribution(-100, 100);
+    std::vector<int> series(count);
+    for (int &value : series)
+    {
+        value = distribution(random);
+    }
+    return series;
+}
+
+TEST_CASE("sliding window aggregations match the window copies",
+          "[azgra::collection::window]")
+{
+    const std::vector<int> series = make_series(500);
+    const Enumerable<int> values(series);
+    const size_t windowSize = 7;
+
+    const auto sums = values.window_sum(windowSize).to_vector();
+    const auto means = values.window_mean(windowSize).to_vector();
+    const auto minMax = values.window_min_max(windowSize).to_vector();
+    REQUIRE(values.window_sum(windowSize).count() == series.size() - windowSize + 1);
+    REQUIRE(sums.size() == series.size() - windowSize + 1);
+    for (size_t i = 0; i < sums.size(); ++i)
+    {
+        const Enumerable<int> window = values.copy_part(i, windowSize);
+        REQUIRE(sums[i] == window.sum());
+        REQUIRE(means[i] == Approx(window.average()));
+        REQUIRE(minMax[i] == window.min_max());
+    }
+
+    const auto products = Enumerable<double>({1.0, 2.0, 4.0, 0.5, 8.0})
+            .window_aggregate(2, 1.0,
+                              [](const double state, const double item)
+                              { return state * item; },
+                              [](const double state, const double item)
+                              { return state / item; })
+            .to_vector();
+    REQUIRE(products == std::vector<double>{2.0, 8.0, 2.0, 4.0});
+
+    REQUIRE(values.take(3).window_sum(5).count() == 0);
+    REQUIRE(values.window_min_max(1).select([](const std::pair<int, int> &p)
+                                            { return p.first; }).to_vector() == series);
+}
+
+TEST_CASE("tumbling window aggregations",
+          "[azgra::collection::window]")
+{
+    const Enumerable<int> values(std::vector<int>{1, 5, 3, 2, 8, 6, 4});
+    REQUIRE(values.window_sum(3, WindowMode_Tumbling).to_vector() == std::vector<int>{9, 16});
+    REQUIRE(values.window_mean(2, WindowMode_Tumbling).to_vector() == std::vector<double>{3.0, 2.5, 7.0});
+    REQUIRE(values.window_min_max(3, WindowMode_Tumbling).to_vector() ==
+            std::vector<std::pair<int, int>>{{1, 5}, {2, 8}});
+    REQUIRE(values.window_min_max(3, WindowMode_Tumbling).count() == 2);
+    REQUIRE(values.where([](const int v)
+                         { return v > 2; })
+                    .window_aggregate(2, std::string(),
+                                      [](std::string state, const int item)
+                                      { return state + std::to_string(item); },
+                                      [](std::string state, int)
+                                      { return state; }, WindowMode_Tumbling)
+                    .to_vector() == std::vector<std::string>{"53", "86"});
+}